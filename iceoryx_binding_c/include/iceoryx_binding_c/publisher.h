@@ -128,6 +128,26 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief allocates multiple chunks with the same user-payload size in the shared memory
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with at least numberOfChunks elements in which the pointers to the user-payloads of
+///            the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks to allocate
+/// @param[in] userPayloadSize user-payload size of the allocated chunks
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error, in this case none of the chunks is allocated
+/// @note for the user-payload alignment `IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT` is used
+ENUM iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                              void** const userPayloads,
+                                              const uint32_t numberOfChunks,
+                                              const uint32_t userPayloadSize);
+
+/// @brief sends multiple previously allocated chunks in the given order, every subscriber is notified only once
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of chunks to send
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
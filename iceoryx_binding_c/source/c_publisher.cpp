@@ -22,6 +22,8 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
+#include <algorithm>
+
 using namespace iox;
 using namespace iox::cxx;
 using namespace iox::popo;
@@ -160,6 +162,54 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                         void** const userPayloads,
+                                         const uint32_t numberOfChunks,
+                                         const uint32_t userPayloadSize)
+{
+    if (numberOfChunks > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return cpp2c::allocationResult(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    PublisherPortUser publisher(self->m_portData);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto result = publisher.tryAllocateChunk(userPayloadSize,
+                                                 IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                 IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                                 IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT);
+        if (result.has_error())
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                publisher.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[j]));
+                userPayloads[j] = nullptr;
+            }
+            return cpp2c::allocationResult(result.get_error());
+        }
+        userPayloads[i] = result.value()->userPayload();
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks)
+{
+    PublisherPortUser publisher(self->m_portData);
+    ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    for (uint32_t offset = 0U; offset < numberOfChunks; offset += MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        const uint32_t numberOfChunksToSend =
+            std::min(numberOfChunks - offset, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY);
+        for (uint32_t i = 0U; i < numberOfChunksToSend; ++i)
+        {
+            chunkHeaders[i] = ChunkHeader::fromUserPayload(userPayloads[offset + i]);
+        }
+        publisher.sendChunks(chunkHeaders, numberOfChunksToSend);
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
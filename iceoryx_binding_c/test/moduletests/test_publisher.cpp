@@ -319,6 +319,47 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, loanChunksAcquiresAllChunks)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    EXPECT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, 100));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(iox_pub_test, loanChunksFailsWithoutAcquiringMemoryWhenHoldingToManyChunksInParallel)
+{
+    void* chunk = nullptr;
+    EXPECT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
+
+    void* chunks[iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_loan_chunks(&m_sut, chunks, iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, 100));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(iox_pub_test, publishChunksDeliversChunksInOrder)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, 100));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        static_cast<DummySample*>(chunks[i])->dummy = i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy, Eq(i));
+    }
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     auto serviceDescription = iox_pub_get_service_description(&m_sut);
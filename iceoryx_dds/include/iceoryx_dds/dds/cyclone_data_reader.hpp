@@ -23,6 +23,7 @@
 #include <Mempool_DCPS.hpp>
 #include <atomic>
 #include <dds/dds.hpp>
+#include <vector>
 
 namespace iox
 {
@@ -57,12 +58,18 @@ class CycloneDataReader : public DataReader
     iox::cxx::expected<DataReaderError> takeNext(const IoxChunkDatagramHeader datagramHeader,
                                                  uint8_t* const userHeaderBuffer,
                                                  uint8_t* const userPayloadBuffer) noexcept override;
+    iox::cxx::expected<uint64_t, DataReaderError> takeBatch(const uint64_t maxNumberOfSamples,
+                                                            const SampleCallback_t& callback) noexcept override;
 
     capro::IdString_t getServiceId() const noexcept override;
     capro::IdString_t getInstanceId() const noexcept override;
     capro::IdString_t getEventId() const noexcept override;
 
   private:
+    /// @brief checks the size, version and endianess of a received datagram and logs the reason if it is invalid
+    /// @return the IoxChunkDatagramHeader of the datagram if it is valid, otherwise nullopt
+    iox::cxx::optional<IoxChunkDatagramHeader> validateDatagram(const std::vector<uint8_t>& datagram) const noexcept;
+
     capro::IdString_t m_serviceId{""};
     capro::IdString_t m_instanceId{""};
     capro::IdString_t m_eventId{""};
@@ -22,6 +22,7 @@
 
 #include <Mempool_DCPS.hpp>
 #include <dds/dds.hpp>
+#include <vector>
 
 namespace iox
 {
@@ -53,12 +54,21 @@ class CycloneDataWriter : public iox::dds::DataWriter
     void write(iox::dds::IoxChunkDatagramHeader datagramHeader,
                const uint8_t* const userHeaderBytes,
                const uint8_t* const userPayloadBytes) noexcept override;
+    void writeBatch(const mepoo::ChunkHeader* const* chunkHeaders, const uint64_t numberOfChunks) noexcept override;
 
     capro::IdString_t getServiceId() const noexcept override;
     capro::IdString_t getInstanceId() const noexcept override;
     capro::IdString_t getEventId() const noexcept override;
 
   private:
+    /// @brief serializes the datagram into the sample buffer with the provided index, the buffers are reused to
+    /// avoid an allocation for every written chunk
+    /// @return the sample buffer or nullptr if the datagram is invalid
+    Mempool::Chunk* serializeIntoSampleBuffer(const uint64_t index,
+                                              iox::dds::IoxChunkDatagramHeader datagramHeader,
+                                              const uint8_t* const userHeaderBytes,
+                                              const uint8_t* const userPayloadBytes) noexcept;
+
     capro::IdString_t m_serviceId{""};
     capro::IdString_t m_instanceId{""};
     capro::IdString_t m_eventId{""};
@@ -66,6 +76,8 @@ class CycloneDataWriter : public iox::dds::DataWriter
     ::dds::pub::Publisher m_publisher = ::dds::core::null;
     ::dds::topic::Topic<Mempool::Chunk> m_topic = ::dds::core::null;
     ::dds::pub::DataWriter<Mempool::Chunk> m_writer = ::dds::core::null;
+
+    std::vector<Mempool::Chunk> m_sampleBuffers;
 };
 
 } // namespace dds
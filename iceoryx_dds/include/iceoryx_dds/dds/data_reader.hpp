@@ -20,6 +20,7 @@
 
 #include "iceoryx_dds/dds/iox_chunk_datagram_header.hpp"
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -50,6 +51,9 @@ constexpr const char* DataReaderErrorString[] = {"INVALID_STATE",
 class DataReader
 {
   public:
+    using SampleCallback_t = cxx::function_ref<void(
+        const IoxChunkDatagramHeader, const uint8_t* const userHeaderBytes, const uint8_t* const userPayloadBytes)>;
+
     /// @brief Connect the DataReader to the underlying DDS network.
     virtual void connect() noexcept = 0;
 
@@ -70,6 +74,14 @@ class DataReader
                                                          uint8_t* const userHeaderBuffer,
                                                          uint8_t* const userPayloadBuffer) noexcept = 0;
 
+    /// @brief takeBatch Take up to maxNumberOfSamples available samples from the DDS data space in one go.
+    /// @param maxNumberOfSamples the maximum number of samples to take
+    /// @param callback is called for every valid sample in the order of reception, the provided bytes are only valid
+    /// during the call; samples with an invalid datagram are dropped
+    /// @return Either the number of taken samples, including the dropped ones, or an error if unsuccessful.
+    virtual iox::cxx::expected<uint64_t, DataReaderError> takeBatch(const uint64_t maxNumberOfSamples,
+                                                                    const SampleCallback_t& callback) noexcept = 0;
+
     /// @brief get ID of the service
     virtual capro::IdString_t getServiceId() const noexcept = 0;
 
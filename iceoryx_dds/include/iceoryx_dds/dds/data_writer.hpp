@@ -21,6 +21,7 @@
 #include "iceoryx_dds/dds/iox_chunk_datagram_header.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <cstdint>
 
@@ -46,6 +47,12 @@ class DataWriter
                        const uint8_t* const userHeaderBytes,
                        const uint8_t* const userPayloadBytes) noexcept = 0;
 
+    /// @brief writeBatch Write the user-header and user-payload of multiple chunks in one go on the DDS network on
+    /// the topic: serviceId/instanceId/eventId
+    /// @param chunkHeaders of the chunks to write, the chunks are only accessed during the call
+    /// @param numberOfChunks the number of chunk headers in chunkHeaders
+    virtual void writeBatch(const mepoo::ChunkHeader* const* chunkHeaders, const uint64_t numberOfChunks) noexcept = 0;
+
     /// @brief Get ID of the service
     virtual capro::IdString_t getServiceId() const noexcept = 0;
 
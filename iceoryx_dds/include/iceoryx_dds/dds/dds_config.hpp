@@ -27,6 +27,8 @@ using namespace units::duration_literals;
 static constexpr units::Duration DISCOVERY_PERIOD = 1000_ms;
 static constexpr units::Duration FORWARDING_PERIOD = 50_ms;
 static constexpr uint32_t SUBSCRIBER_CACHE_SIZE = 128u;
+/// @brief the maximum number of samples which are taken and written in one go when forwarding
+static constexpr uint32_t MAX_SAMPLES_PER_BATCH = 32u;
 
 } // namespace dds
 } // namespace iox
@@ -54,6 +54,15 @@ struct IoxChunkDatagramHeader
     /// @return the deserialized IoxChunkDatagramHeader
     static IoxChunkDatagramHeader deserialize(const Serialized_t& serializedDatagramHeader);
 
+    /// @brief Deserializes a IoxChunkDatagramHeader directly from the beginning of a received datagram
+    /// @param[in] serializedDatagramHeader points to at least SERIALIZED_SIZE bytes of a serialized
+    /// IoxChunkDatagramHeader
+    /// @return the deserialized IoxChunkDatagramHeader
+    static IoxChunkDatagramHeader deserialize(const uint8_t* const serializedDatagramHeader);
+
+    /// @brief the number of bytes of a serialized IoxChunkDatagramHeader
+    static constexpr uint64_t SERIALIZED_SIZE{16U};
+
     /// @brief From the 1.0 release onward, this must be incremented for each incompatible change, e.g.
     ///            - data width of members changes
     ///            - members are rearranged
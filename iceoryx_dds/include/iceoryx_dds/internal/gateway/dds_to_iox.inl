@@ -22,6 +22,9 @@
 #include "iceoryx_dds/internal/log/logging.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstring>
 
 namespace iox
 {
@@ -62,38 +65,44 @@ inline void DDS2IceoryxGateway<channel_t, gateway_t>::forward(const channel_t& c
     auto publisher = channel.getIceoryxTerminal();
     auto reader = channel.getExternalTerminal();
 
-    while (reader->hasSamples())
+    auto publishSample = [&](const IoxChunkDatagramHeader datagramHeader,
+                             const uint8_t* const userHeaderBytes,
+                             const uint8_t* const userPayloadBytes) {
+        // this is safe, it is just used to check if the alignment doesn't exceed the
+        // alignment of the ChunkHeader but since this is data from a previously valid
+        // chunk, we can assume that the alignment was correct and use this value
+        constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
+        publisher
+            ->loan(datagramHeader.userPayloadSize,
+                   datagramHeader.userPayloadAlignment,
+                   datagramHeader.userHeaderSize,
+                   USER_HEADER_ALIGNMENT)
+            .and_then([&](auto userPayload) {
+                // the sample is deserialized directly into the loaned chunk
+                auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
+                if (datagramHeader.userHeaderSize > 0U)
+                {
+                    std::memcpy(chunkHeader->userHeader(), userHeaderBytes, datagramHeader.userHeaderSize);
+                }
+                std::memcpy(userPayload, userPayloadBytes, datagramHeader.userPayloadSize);
+                publisher->publish(userPayload);
+            })
+            .or_else([](auto& error) {
+                LogError() << "[DDS2IceoryxGateway] Could not loan chunk! Error code: " << static_cast<uint64_t>(error);
+            });
+    };
+
+    uint64_t numberOfSamples{0U};
+    do
     {
-        reader->peekNextIoxChunkDatagramHeader().and_then([&](auto datagramHeader) {
-            // this is safe, it is just used to check if the alignment doesn't exceed the
-            // alignment of the ChunkHeader but since this is data from a previously valid
-            // chunk, we can assume that the alignment was correct and use this value
-            constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
-            publisher
-                ->loan(datagramHeader.userPayloadSize,
-                       datagramHeader.userPayloadAlignment,
-                       datagramHeader.userHeaderSize,
-                       USER_HEADER_ALIGNMENT)
-                .and_then([&](auto userPayload) {
-                    auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
-                    reader
-                        ->takeNext(datagramHeader,
-                                   static_cast<uint8_t*>(chunkHeader->userHeader()),
-                                   static_cast<uint8_t*>(chunkHeader->userPayload()))
-                        .and_then([&]() { publisher->publish(userPayload); })
-                        .or_else([&](DataReaderError err) {
-                            publisher->release(userPayload);
-                            LogWarn() << "[DDS2IceoryxGateway] Encountered error reading from DDS network: "
-                                      << dds::DataReaderErrorString[static_cast<uint8_t>(err)];
-                        });
-                })
-                .or_else([](auto& error) {
-                    LogError() << "[DDS2IceoryxGateway] Could not loan chunk! Error code: "
-                               << static_cast<uint64_t>(error);
-                });
-            ;
-        });
-    }
+        numberOfSamples = 0U;
+        reader->takeBatch(MAX_SAMPLES_PER_BATCH, publishSample)
+            .and_then([&](auto numberOfTakenSamples) { numberOfSamples = numberOfTakenSamples; })
+            .or_else([](DataReaderError err) {
+                LogWarn() << "[DDS2IceoryxGateway] Encountered error reading from DDS network: "
+                          << dds::DataReaderErrorString[static_cast<uint8_t>(err)];
+            });
+    } while (numberOfSamples == MAX_SAMPLES_PER_BATCH);
 }
 
 // ======================================== Private ======================================== //
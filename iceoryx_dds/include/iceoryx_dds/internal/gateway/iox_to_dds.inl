@@ -107,22 +107,28 @@ template <typename channel_t, typename gateway_t>
 inline void Iceoryx2DDSGateway<channel_t, gateway_t>::forward(const channel_t& channel) noexcept
 {
     auto subscriber = channel.getIceoryxTerminal();
-    while (subscriber->hasData())
+    auto dataWriter = channel.getExternalTerminal();
+
+    const mepoo::ChunkHeader* chunkHeaders[MAX_SAMPLES_PER_BATCH];
+    uint32_t numberOfChunks{0U};
+    do
     {
-        subscriber->take().and_then([&](const void* userPayload) {
-            auto dataWriter = channel.getExternalTerminal();
-            auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
-            iox::dds::IoxChunkDatagramHeader datagramHeader;
-            datagramHeader.userHeaderId = chunkHeader->userHeaderId();
-            datagramHeader.userHeaderSize = chunkHeader->userHeaderSize();
-            datagramHeader.userPayloadSize = chunkHeader->userPayloadSize();
-            datagramHeader.userPayloadAlignment = chunkHeader->userPayloadAlignment();
-            dataWriter->write(datagramHeader,
-                              static_cast<const uint8_t*>(chunkHeader->userHeader()),
-                              static_cast<const uint8_t*>(chunkHeader->userPayload()));
-            subscriber->release(userPayload);
+        numberOfChunks = 0U;
+        auto takeResult = subscriber->takeBatch(MAX_SAMPLES_PER_BATCH, [&](const void* userPayload) {
+            chunkHeaders[numberOfChunks++] = mepoo::ChunkHeader::fromUserPayload(userPayload);
         });
-    }
+        if (takeResult.has_error())
+        {
+            break;
+        }
+
+        // the chunks are written directly from the shared memory and released afterwards
+        dataWriter->writeBatch(chunkHeaders, numberOfChunks);
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            subscriber->release(chunkHeaders[i]->userPayload());
+        }
+    } while (numberOfChunks == MAX_SAMPLES_PER_BATCH);
 }
 
 // ======================================== Private ======================================== //
@@ -20,6 +20,9 @@
 #include "iceoryx_dds/internal/log/logging.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
+#include <algorithm>
+#include <limits>
+
 iox::dds::CycloneDataReader::CycloneDataReader(const capro::IdString_t serviceId,
                                                const capro::IdString_t instanceId,
                                                const capro::IdString_t eventId) noexcept
@@ -68,58 +71,11 @@ iox::dds::CycloneDataReader::peekNextIoxChunkDatagramHeader() noexcept
         return NO_VALID_SAMPLE_AVAILABLE;
     }
 
-    auto nextSample = readSamples.begin();
-    auto& nextSamplePayload = nextSample->data().payload();
-    auto nextSampleSize = nextSamplePayload.size();
-
-    auto dropSample = [&] {
-        m_impl.select().max_samples(1U).state(::dds::sub::status::SampleState::any()).take();
-        return NO_VALID_SAMPLE_AVAILABLE;
-    };
-
-    // Ignore samples with no payload
-    if (nextSampleSize == 0)
-    {
-        LogError() << "[CycloneDataReader] received sample with size zero! Dropped sample!";
-        return dropSample();
-    }
-
-    // Ignore Invalid IoxChunkDatagramHeader
-    if (nextSampleSize < sizeof(iox::dds::IoxChunkDatagramHeader))
+    auto datagramHeader = validateDatagram(readSamples.begin()->data().payload());
+    if (!datagramHeader.has_value())
     {
-        auto log = LogError();
-        log << "[CycloneDataReader] invalid sample size! Must be at least sizeof(IoxChunkDatagramHeader) = "
-            << sizeof(iox::dds::IoxChunkDatagramHeader) << " but got " << nextSampleSize;
-        if (nextSampleSize >= 1)
-        {
-            log << "! Potential datagram version is " << static_cast<uint16_t>(nextSamplePayload[0])
-                << "! Dropped sample!";
-        }
-        return dropSample();
-    }
-
-    iox::dds::IoxChunkDatagramHeader::Serialized_t serializedDatagramHeader;
-    for (uint64_t i = 0U; i < serializedDatagramHeader.capacity(); ++i)
-    {
-        serializedDatagramHeader.emplace_back(nextSamplePayload[i]);
-    }
-
-    auto datagramHeader = iox::dds::IoxChunkDatagramHeader::deserialize(serializedDatagramHeader);
-
-    if (datagramHeader.datagramVersion != iox::dds::IoxChunkDatagramHeader::DATAGRAM_VERSION)
-    {
-        LogError() << "[CycloneDataReader] received sample with incompatible IoxChunkDatagramHeader version! Received '"
-                   << static_cast<uint16_t>(datagramHeader.datagramVersion) << "', expected '"
-                   << static_cast<uint16_t>(iox::dds::IoxChunkDatagramHeader::DATAGRAM_VERSION) << "'! Dropped sample!";
-        return dropSample();
-    }
-
-    if (datagramHeader.endianness != getEndianess())
-    {
-        LogError() << "[CycloneDataReader] received sample with incompatible endianess! Received '"
-                   << EndianessString[static_cast<uint64_t>(datagramHeader.endianness)] << "', expected '"
-                   << EndianessString[static_cast<uint64_t>(getEndianess())] << "'! Dropped sample!";
-        return dropSample();
+        // drop the invalid sample
+        m_impl.select().max_samples(1U).state(::dds::sub::status::SampleState::any()).take();
     }
 
     return datagramHeader;
@@ -165,7 +121,8 @@ iox::dds::CycloneDataReader::takeNext(const iox::dds::IoxChunkDatagramHeader dat
 
     // valid size
     auto nextSample = takenSamples.begin();
-    auto samplePayload = nextSample->data().payload();
+    // no copy, the sample stays valid as long as takenSamples
+    auto& samplePayload = nextSample->data().payload();
     auto sampleSize = samplePayload.size();
     if (sampleSize == 0)
     {
@@ -176,13 +133,7 @@ iox::dds::CycloneDataReader::takeNext(const iox::dds::IoxChunkDatagramHeader dat
         return iox::cxx::error<iox::dds::DataReaderError>(iox::dds::DataReaderError::INVALID_DATAGRAM_HEADER_SIZE);
     }
 
-    iox::dds::IoxChunkDatagramHeader::Serialized_t serializedDatagramHeader;
-    for (uint64_t i = 0U; i < serializedDatagramHeader.capacity(); ++i)
-    {
-        serializedDatagramHeader.emplace_back(samplePayload[i]);
-    }
-
-    auto actualDatagramHeader = iox::dds::IoxChunkDatagramHeader::deserialize(serializedDatagramHeader);
+    auto actualDatagramHeader = iox::dds::IoxChunkDatagramHeader::deserialize(samplePayload.data());
 
     iox::cxx::Ensures(datagramHeader.userHeaderId == actualDatagramHeader.userHeaderId);
     iox::cxx::Ensures(datagramHeader.userHeaderSize == actualDatagramHeader.userHeaderSize);
@@ -215,6 +166,99 @@ iox::dds::CycloneDataReader::takeNext(const iox::dds::IoxChunkDatagramHeader dat
     return iox::cxx::success<>();
 }
 
+iox::cxx::expected<uint64_t, iox::dds::DataReaderError>
+iox::dds::CycloneDataReader::takeBatch(const uint64_t maxNumberOfSamples, const SampleCallback_t& callback) noexcept
+{
+    if (!m_isConnected.load())
+    {
+        return iox::cxx::error<iox::dds::DataReaderError>(iox::dds::DataReaderError::NOT_CONNECTED);
+    }
+
+    // the samples are loaned from the reader cache, the bytes are handed to the callback without being copied
+    auto takenSamples = m_impl.select()
+                            .max_samples(static_cast<uint32_t>(std::min<uint64_t>(
+                                maxNumberOfSamples, std::numeric_limits<uint32_t>::max())))
+                            .state(::dds::sub::status::SampleState::any())
+                            .take();
+
+    for (const auto& sample : takenSamples)
+    {
+        if (!sample.info().valid())
+        {
+            continue;
+        }
+
+        auto& datagram = sample.data().payload();
+        validateDatagram(datagram).and_then([&](auto& datagramHeader) {
+            auto dataSize = datagram.size() - sizeof(iox::dds::IoxChunkDatagramHeader);
+            auto expectedDataSize = static_cast<uint64_t>(datagramHeader.userHeaderSize)
+                                    + static_cast<uint64_t>(datagramHeader.userPayloadSize);
+            if (dataSize != expectedDataSize)
+            {
+                LogError() << "[CycloneDataReader] received sample with " << dataSize
+                           << " bytes of user data but the IoxChunkDatagramHeader announces " << expectedDataSize
+                           << " bytes! Dropped sample!";
+                return;
+            }
+
+            auto userHeaderBytes = &datagram.data()[sizeof(iox::dds::IoxChunkDatagramHeader)];
+            auto userPayloadBytes = userHeaderBytes + datagramHeader.userHeaderSize;
+            callback(datagramHeader, userHeaderBytes, userPayloadBytes);
+        });
+    }
+
+    return iox::cxx::success<uint64_t>(takenSamples.length());
+}
+
+iox::cxx::optional<iox::dds::IoxChunkDatagramHeader>
+iox::dds::CycloneDataReader::validateDatagram(const std::vector<uint8_t>& datagram) const noexcept
+{
+    constexpr iox::cxx::nullopt_t INVALID_DATAGRAM;
+
+    auto datagramSize = datagram.size();
+
+    // Ignore samples with no payload
+    if (datagramSize == 0)
+    {
+        LogError() << "[CycloneDataReader] received sample with size zero! Dropped sample!";
+        return INVALID_DATAGRAM;
+    }
+
+    // Ignore Invalid IoxChunkDatagramHeader
+    if (datagramSize < sizeof(iox::dds::IoxChunkDatagramHeader))
+    {
+        auto log = LogError();
+        log << "[CycloneDataReader] invalid sample size! Must be at least sizeof(IoxChunkDatagramHeader) = "
+            << sizeof(iox::dds::IoxChunkDatagramHeader) << " but got " << datagramSize;
+        if (datagramSize >= 1)
+        {
+            log << "! Potential datagram version is " << static_cast<uint16_t>(datagram[0])
+                << "! Dropped sample!";
+        }
+        return INVALID_DATAGRAM;
+    }
+
+    auto datagramHeader = iox::dds::IoxChunkDatagramHeader::deserialize(datagram.data());
+
+    if (datagramHeader.datagramVersion != iox::dds::IoxChunkDatagramHeader::DATAGRAM_VERSION)
+    {
+        LogError() << "[CycloneDataReader] received sample with incompatible IoxChunkDatagramHeader version! Received '"
+                   << static_cast<uint16_t>(datagramHeader.datagramVersion) << "', expected '"
+                   << static_cast<uint16_t>(iox::dds::IoxChunkDatagramHeader::DATAGRAM_VERSION) << "'! Dropped sample!";
+        return INVALID_DATAGRAM;
+    }
+
+    if (datagramHeader.endianness != getEndianess())
+    {
+        LogError() << "[CycloneDataReader] received sample with incompatible endianess! Received '"
+                   << EndianessString[static_cast<uint64_t>(datagramHeader.endianness)] << "', expected '"
+                   << EndianessString[static_cast<uint64_t>(getEndianess())] << "'! Dropped sample!";
+        return INVALID_DATAGRAM;
+    }
+
+    return datagramHeader;
+}
+
 iox::capro::IdString_t iox::dds::CycloneDataReader::getServiceId() const noexcept
 {
     return m_serviceId;
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <Mempool_DCPS.hpp>
+#include <cstddef>
+#include <cstring>
 #include <string>
 
 iox::dds::CycloneDataWriter::CycloneDataWriter(const capro::IdString_t serviceId,
@@ -53,43 +55,89 @@ void iox::dds::CycloneDataWriter::connect() noexcept
 void iox::dds::CycloneDataWriter::write(iox::dds::IoxChunkDatagramHeader datagramHeader,
                                         const uint8_t* const userHeaderBytes,
                                         const uint8_t* const userPayloadBytes) noexcept
+{
+    auto sample = serializeIntoSampleBuffer(0U, datagramHeader, userHeaderBytes, userPayloadBytes);
+    if (sample != nullptr)
+    {
+        m_writer.write(*sample);
+    }
+}
+
+void iox::dds::CycloneDataWriter::writeBatch(const mepoo::ChunkHeader* const* chunkHeaders,
+                                             const uint64_t numberOfChunks) noexcept
+{
+    uint64_t numberOfSamples{0U};
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto chunkHeader = chunkHeaders[i];
+        iox::dds::IoxChunkDatagramHeader datagramHeader;
+        datagramHeader.userHeaderId = chunkHeader->userHeaderId();
+        datagramHeader.userHeaderSize = chunkHeader->userHeaderSize();
+        datagramHeader.userPayloadSize = chunkHeader->userPayloadSize();
+        datagramHeader.userPayloadAlignment = chunkHeader->userPayloadAlignment();
+
+        if (serializeIntoSampleBuffer(numberOfSamples,
+                                      datagramHeader,
+                                      static_cast<const uint8_t*>(chunkHeader->userHeader()),
+                                      static_cast<const uint8_t*>(chunkHeader->userPayload()))
+            != nullptr)
+        {
+            ++numberOfSamples;
+        }
+    }
+
+    if (numberOfSamples > 0U)
+    {
+        m_writer.write(m_sampleBuffers.begin(), m_sampleBuffers.begin() + static_cast<std::ptrdiff_t>(numberOfSamples));
+    }
+}
+
+Mempool::Chunk* iox::dds::CycloneDataWriter::serializeIntoSampleBuffer(const uint64_t index,
+                                                                     iox::dds::IoxChunkDatagramHeader datagramHeader,
+                                                                     const uint8_t* const userHeaderBytes,
+                                                                     const uint8_t* const userPayloadBytes) noexcept
 {
     if (datagramHeader.userHeaderSize > 0
         && (datagramHeader.userHeaderId == iox::mepoo::ChunkHeader::NO_USER_HEADER || userHeaderBytes == nullptr))
     {
         LogError() << "[CycloneDataWriter] invalid user-header parameter! Dropping chunk!";
-        return;
+        return nullptr;
     }
     if (datagramHeader.userPayloadSize > 0 && userPayloadBytes == nullptr)
     {
         LogError() << "[CycloneDataWriter] invalid user-payload parameter! Dropping chunk!";
-        return;
+        return nullptr;
     }
 
     datagramHeader.endianness = getEndianess();
 
+    if (index >= m_sampleBuffers.size())
+    {
+        m_sampleBuffers.resize(index + 1U);
+    }
+
     auto serializedDatagramHeader = iox::dds::IoxChunkDatagramHeader::serialize(datagramHeader);
     auto datagramSize =
         serializedDatagramHeader.size() + datagramHeader.userHeaderSize + datagramHeader.userPayloadSize;
 
-    auto chunk = Mempool::Chunk();
-    chunk.payload().reserve(datagramSize);
+    // the capacity of the buffer is kept, only the first datagrams which exceed it cause an allocation
+    auto& datagram = m_sampleBuffers[index].payload();
+    datagram.resize(datagramSize);
 
-    std::copy(serializedDatagramHeader.data(),
-              serializedDatagramHeader.data() + serializedDatagramHeader.size(),
-              std::back_inserter(chunk.payload()));
-    if (datagramHeader.userHeaderSize > 0 && userHeaderBytes != nullptr)
+    auto position = datagram.data();
+    std::memcpy(position, serializedDatagramHeader.data(), serializedDatagramHeader.size());
+    position += serializedDatagramHeader.size();
+    if (datagramHeader.userHeaderSize > 0)
     {
-        std::copy(
-            userHeaderBytes, userHeaderBytes + datagramHeader.userHeaderSize, std::back_inserter(chunk.payload()));
+        std::memcpy(position, userHeaderBytes, datagramHeader.userHeaderSize);
+        position += datagramHeader.userHeaderSize;
     }
-    if (datagramHeader.userPayloadSize > 0 && userPayloadBytes != nullptr)
+    if (datagramHeader.userPayloadSize > 0)
     {
-        std::copy(
-            userPayloadBytes, userPayloadBytes + datagramHeader.userPayloadSize, std::back_inserter(chunk.payload()));
+        std::memcpy(position, userPayloadBytes, datagramHeader.userPayloadSize);
     }
 
-    m_writer.write(chunk);
+    return &m_sampleBuffers[index];
 }
 
 iox::capro::IdString_t iox::dds::CycloneDataWriter::getServiceId() const noexcept
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace dds
 {
+constexpr uint64_t IoxChunkDatagramHeader::SERIALIZED_SIZE;
+
 Endianess getEndianess()
 {
     uint32_t endianDetector{0x01020304};
@@ -69,7 +71,15 @@ IoxChunkDatagramHeader::Serialized_t IoxChunkDatagramHeader::serialize(const Iox
 IoxChunkDatagramHeader
 IoxChunkDatagramHeader::deserialize(const IoxChunkDatagramHeader::Serialized_t& serializedDatagramHeader)
 {
-    iox::cxx::Expects(serializedDatagramHeader.size() == 16U && "Expects valid IoxChunkDatagramHeader serialization!");
+    iox::cxx::Expects(serializedDatagramHeader.size() == SERIALIZED_SIZE
+                      && "Expects valid IoxChunkDatagramHeader serialization!");
+
+    return deserialize(serializedDatagramHeader.data());
+}
+
+IoxChunkDatagramHeader IoxChunkDatagramHeader::deserialize(const uint8_t* const serializedDatagramHeader)
+{
+    iox::cxx::Expects(serializedDatagramHeader != nullptr && "Expects valid IoxChunkDatagramHeader serialization!");
 
     IoxChunkDatagramHeader datagramHeader;
 
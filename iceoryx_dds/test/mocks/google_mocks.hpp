@@ -75,6 +75,9 @@ class MockDataReader
                  iox::cxx::expected<iox::dds::DataReaderError>(const iox::dds::IoxChunkDatagramHeader,
                                                                uint8_t* const,
                                                                uint8_t* const));
+    MOCK_METHOD2(takeBatch,
+                 iox::cxx::expected<uint64_t, iox::dds::DataReaderError>(
+                     const uint64_t, const iox::dds::DataReader::SampleCallback_t&));
     MOCK_CONST_METHOD0(getServiceId, std::string(void));
     MOCK_CONST_METHOD0(getInstanceId, std::string(void));
     MOCK_CONST_METHOD0(getEventId, std::string(void));
@@ -86,6 +89,7 @@ class MockDataWriter
     MockDataWriter(const iox::capro::ServiceDescription&){};
     MOCK_METHOD0(connect, void(void));
     MOCK_METHOD3(write, bool(iox::dds::IoxChunkDatagramHeader, const uint8_t* const, const uint8_t* const));
+    MOCK_METHOD2(writeBatch, void(const iox::mepoo::ChunkHeader* const*, const uint64_t));
     MOCK_CONST_METHOD0(getServiceId, std::string(void));
     MOCK_CONST_METHOD0(getInstanceId, std::string(void));
     MOCK_CONST_METHOD0(getEventId, std::string(void));
@@ -17,11 +17,21 @@
 
 #include "test.hpp"
 
+#include <cstdlib>
+
 using namespace ::testing;
 using ::testing::_;
 
 int main(int argc, char* argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);
+
+    // keep the DDS traffic of the tests on the loopback interface unless a configuration is explicitly provided
+    constexpr int DO_NOT_OVERWRITE{0};
+    setenv("CYCLONEDDS_URI",
+           "<CycloneDDS><Domain><General><NetworkInterfaceAddress>127.0.0.1</NetworkInterfaceAddress>"
+           "<AllowMulticast>false</AllowMulticast></General></Domain></CycloneDDS>",
+           DO_NOT_OVERWRITE);
+
     return RUN_ALL_TESTS();
 }
@@ -16,11 +16,17 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_dds/dds/cyclone_data_reader.hpp"
+#include "iceoryx_dds/dds/cyclone_data_writer.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
 
 #include <Mempool_DCPS.hpp>
+#include <chrono>
+#include <cstring>
 #include <dds/dds.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
 
 using namespace ::testing;
 using ::testing::_;
@@ -97,5 +103,69 @@ TEST_F(CycloneDataReaderTest, ReturnsErrorWhenAttemptingToReadIntoANullBuffer)
     EXPECT_EQ(iox::dds::DataReaderError::INVALID_BUFFER_PARAMETER_FOR_USER_PAYLOAD, takeNextResult2.get_error());
 }
 
+TEST_F(CycloneDataReaderTest, TakeBatchReturnsErrorWhenDisconnected)
+{
+    TestDataReader reader{"", "", ""};
+
+    auto takeBatchResult = reader.takeBatch(1U, [](auto, auto, auto) {});
+
+    ASSERT_EQ(true, takeBatchResult.has_error());
+    EXPECT_EQ(iox::dds::DataReaderError::NOT_CONNECTED, takeBatchResult.get_error());
+}
+
+TEST_F(CycloneDataReaderTest, TakeBatchProvidesAllSamplesOfAWrittenBatch)
+{
+    // ===== Setup
+    constexpr uint64_t NUMBER_OF_CHUNKS{8U};
+    std::vector<std::unique_ptr<ChunkMock<DummyPayload, DummyUserHeader>>> chunkMocks;
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunkMocks.emplace_back(new ChunkMock<DummyPayload, DummyUserHeader>());
+        *chunkMocks.back()->sample() = DummyPayload{i, 2U * i, 3U * i};
+        chunkMocks.back()->userHeader()->a = i;
+        chunkHeaders[i] = chunkMocks.back()->chunkHeader();
+    }
+
+    TestDataReader reader{"Radar", "FrontLeft", "Batch"};
+    reader.connect();
+    CycloneDataWriter writer{"Radar", "FrontLeft", "Batch"};
+    writer.connect();
+
+    // ===== Test
+    writer.writeBatch(chunkHeaders, NUMBER_OF_CHUNKS);
+
+    std::vector<DummyPayload> receivedPayloads;
+    std::vector<DummyUserHeader> receivedUserHeaders;
+    auto collect = [&](const IoxChunkDatagramHeader datagramHeader,
+                       const uint8_t* const userHeaderBytes,
+                       const uint8_t* const userPayloadBytes) {
+        ASSERT_EQ(sizeof(DummyUserHeader), datagramHeader.userHeaderSize);
+        ASSERT_EQ(sizeof(DummyPayload), datagramHeader.userPayloadSize);
+        DummyUserHeader userHeader;
+        std::memcpy(&userHeader, userHeaderBytes, sizeof(DummyUserHeader));
+        receivedUserHeaders.push_back(userHeader);
+        DummyPayload payload;
+        std::memcpy(&payload, userPayloadBytes, sizeof(DummyPayload));
+        receivedPayloads.push_back(payload);
+    };
+
+    constexpr uint64_t MAX_NUMBER_OF_ATTEMPTS{100U};
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_ATTEMPTS && receivedPayloads.size() < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_FALSE(reader.takeBatch(NUMBER_OF_CHUNKS, collect).has_error());
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(NUMBER_OF_CHUNKS, receivedPayloads.size());
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_EQ(i, receivedUserHeaders[i].a);
+        EXPECT_EQ(i, receivedPayloads[i].a);
+        EXPECT_EQ(2U * i, receivedPayloads[i].b);
+        EXPECT_EQ(3U * i, receivedPayloads[i].c);
+    }
+}
+
 } // namespace dds
 } // namespace iox
@@ -16,16 +16,33 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "base.hpp"
 
+#include <vector>
 
-void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
+namespace
 {
-    sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
+uint64_t nanosecondsSince(const std::chrono::high_resolution_clock::time_point start) noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start)
+            .count());
 }
+} // namespace
 
-void IcePerfBase::postLatencyPerfTestLeader() noexcept
+void IcePerfBase::initLeader(const uint32_t numberOfFollowers) noexcept
 {
-    // Wait for the last response
-    receivePerfTopic();
+    m_numberOfFollowers = numberOfFollowers;
+    setupLeader();
+}
+
+void IcePerfBase::initFollower(const uint32_t followerId) noexcept
+{
+    m_followerId = followerId;
+    setupFollower();
+}
+
+bool IcePerfBase::isSupported(const Benchmark) const noexcept
+{
+    return true;
 }
 
 void IcePerfBase::releaseFollower() noexcept
@@ -33,38 +50,98 @@ void IcePerfBase::releaseFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+LatencyResult IcePerfBase::latencyPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                 const uint64_t numberOfRoundTrips) noexcept
+{
+    std::vector<uint64_t> latenciesInNanoseconds;
+    latenciesInNanoseconds.reserve(numberOfRoundTrips);
+
+    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+    for (uint64_t i = 0U; i < numberOfRoundTrips; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
+        // with multiple followers the round trip ends with the reply of the slowest one
+        for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+        {
+            receivePerfTopic();
+        }
+
+        latenciesInNanoseconds.push_back(nanosecondsSince(start) / TRANSMISSIONS_PER_ROUNDTRIP);
+    }
+
+    return LatencyResult::fromSamples(latenciesInNanoseconds);
+}
+
+ThroughputResult IcePerfBase::throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                       const uint64_t numberOfSamples) noexcept
 {
     auto start = std::chrono::high_resolution_clock::now();
 
-    // run the performance test
-    for (auto i = 0U; i < numRoundTrips; ++i)
+    for (uint64_t i = 1U; i < numberOfSamples; ++i)
     {
-        auto perfTopic = receivePerfTopic();
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        sendPerfTopic(payloadSizeInBytes, RunFlag::BURST);
     }
+    sendPerfTopic(payloadSizeInBytes, RunFlag::BURST_END);
 
-    auto finish = std::chrono::high_resolution_clock::now();
+    // the followers acknowledge the last sample, afterwards all samples are received
+    for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
+    }
 
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds =
-        (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    return iox::units::Duration::fromNanoseconds(latencyInNanoSeconds);
+    ThroughputResult result;
+    result.duration = iox::units::Duration::fromNanoseconds(nanosecondsSince(start));
+    result.numberOfMessages = numberOfSamples * m_numberOfFollowers;
+    result.numberOfBytes = result.numberOfMessages * payloadSizeInBytes;
+    return result;
+}
+
+ThroughputResult IcePerfBase::multiProducerPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                          const uint64_t numberOfSamplesPerFollower) noexcept
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    sendPerfTopic(payloadSizeInBytes, RunFlag::PRODUCE);
+
+    const uint64_t numberOfSamples = numberOfSamplesPerFollower * m_numberOfFollowers;
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        receivePerfTopic();
+    }
+
+    ThroughputResult result;
+    result.duration = iox::units::Duration::fromNanoseconds(nanosecondsSince(start));
+    result.numberOfMessages = numberOfSamples;
+    result.numberOfBytes = numberOfSamples * payloadSizeInBytes;
+    return result;
 }
 
-void IcePerfBase::latencyPerfTestFollower() noexcept
+void IcePerfBase::perfTestFollower(const uint64_t numberOfSamples) noexcept
 {
     while (true)
     {
         auto perfTopic = receivePerfTopic();
 
-        // stop replying when no more run
-        if (perfTopic.runFlag == RunFlag::STOP)
+        switch (perfTopic.runFlag)
         {
+        case RunFlag::STOP:
+            return;
+        case RunFlag::RUN:
+            sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+            break;
+        case RunFlag::BURST:
+            break;
+        case RunFlag::BURST_END:
+            sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+            break;
+        case RunFlag::PRODUCE:
+            for (uint64_t i = 0U; i < numberOfSamples; ++i)
+            {
+                sendPerfTopic(perfTopic.payloadSize, RunFlag::BURST);
+            }
             break;
         }
-
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
     }
 }
@@ -18,6 +18,7 @@
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
 #include "example_common.hpp"
+#include "perf_result.hpp"
 #include "topic_data.hpp"
 
 #include "iceoryx_hoofs/internal/units/duration.hpp"
@@ -25,6 +26,9 @@
 #include <chrono>
 #include <iostream>
 
+/// @brief the benchmark protocol which is shared by all IPC technologies. The leader drives the benchmarks with the
+/// RunFlag of the sent PerfTopic and the followers react on it, see perfTestFollower. The technologies only have to
+/// implement the setup, the transmission of a PerfTopic and the shutdown.
 class IcePerfBase
 {
   public:
@@ -32,17 +36,59 @@ class IcePerfBase
 
     virtual ~IcePerfBase() = default;
 
-    virtual void initLeader() noexcept = 0;
-    virtual void initFollower() noexcept = 0;
+    /// @brief sets up the communication with all followers, returns when every follower registered
+    /// @param[in] numberOfFollowers the number of follower applications, at most MAX_NUMBER_OF_FOLLOWERS
+    void initLeader(const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief sets up the communication with the leader and registers with it
+    /// @param[in] followerId the unique id of this follower, must be smaller than the number of followers
+    void initFollower(const uint32_t followerId) noexcept;
+
     virtual void shutdown() noexcept = 0;
 
-    void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
-    void postLatencyPerfTestLeader() noexcept;
+    /// @brief technologies which cannot run all benchmarks are skipped by the leader for those
+    /// @param[in] benchmark the benchmark to check
+    /// @return true if the technology can run the benchmark
+    virtual bool isSupported(const Benchmark benchmark) const noexcept;
+
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
-    void latencyPerfTestFollower() noexcept;
+
+    /// @brief sends a sample to all followers and waits for all replies, the one-way latency of every round trip is
+    /// recorded
+    /// @param[in] payloadSizeInBytes the payload size of the samples in both directions
+    /// @param[in] numberOfRoundTrips the number of round trips
+    /// @return the distribution of the one-way latencies
+    LatencyResult latencyPerfTestLeader(const uint32_t payloadSizeInBytes, const uint64_t numberOfRoundTrips) noexcept;
+
+    /// @brief sends the samples to all followers as fast as possible and waits until every follower received the last
+    /// one
+    /// @param[in] payloadSizeInBytes the payload size of the samples
+    /// @param[in] numberOfSamples the number of samples every follower receives
+    /// @return the number of samples and bytes received by all followers together and the duration of the transmission
+    ThroughputResult throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                              const uint64_t numberOfSamples) noexcept;
+
+    /// @brief lets all followers send their samples concurrently to the leader as fast as possible
+    /// @param[in] payloadSizeInBytes the payload size of the samples
+    /// @param[in] numberOfSamplesPerFollower the number of samples every follower sends
+    /// @return the number of samples and bytes received by the leader and the duration of the transmission
+    ThroughputResult multiProducerPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                 const uint64_t numberOfSamplesPerFollower) noexcept;
+
+    /// @brief reacts on the samples of the leader until it sends RunFlag::STOP
+    /// @param[in] numberOfSamples the number of samples to send on RunFlag::PRODUCE
+    void perfTestFollower(const uint64_t numberOfSamples) noexcept;
+
+  protected:
+    uint32_t m_numberOfFollowers{1U};
+    uint32_t m_followerId{0U};
 
   private:
+    /// @brief the leader has to receive a PerfTopic from every follower before it returns
+    virtual void setupLeader() noexcept = 0;
+    /// @brief the follower has to send a PerfTopic to the leader when it is ready to receive
+    virtual void setupFollower() noexcept = 0;
+    /// @brief the leader sends the PerfTopic to all followers, a follower to the leader
     virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
     virtual PerfTopic receivePerfTopic() noexcept = 0;
 };
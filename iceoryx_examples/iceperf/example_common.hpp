@@ -17,26 +17,57 @@
 #ifndef IOX_EXAMPLES_ICEPERF_EXAMPLE_COMMON_HPP
 #define IOX_EXAMPLES_ICEPERF_EXAMPLE_COMMON_HPP
 
+#include <cstdint>
+
 enum class Benchmark
 {
     ALL,
     LATENCY,
-    THROUGHPUT
+    THROUGHPUT,
+    MULTI_PRODUCER
 };
 
+constexpr const char* BenchmarkString[] = {"all", "latency", "throughput", "multi-producer"};
+
 enum class Technology
 {
     ALL,
     ICEORYX_CPP_API,
     ICEORYX_C_API,
     POSIX_MESSAGE_QUEUE,
-    UNIX_DOMAIN_SOCKET
+    UNIX_DOMAIN_SOCKET,
+    ICEORYX_REQUEST_RESPONSE
 };
 
+constexpr const char* TechnologyString[] = {"all",
+                                            "iceoryx-cpp-api",
+                                            "iceoryx-c-api",
+                                            "posix-message-queue",
+                                            "unix-domain-sockets",
+                                            "iceoryx-request-response"};
+
+/// @brief tells the follower what to do with a received PerfTopic
 enum class RunFlag
 {
+    /// @brief the benchmark is finished
     STOP,
-    RUN
+    /// @brief reply with a PerfTopic of the same payload size
+    RUN,
+    /// @brief part of a one-way transmission, no reply
+    BURST,
+    /// @brief last sample of a one-way transmission, reply with a small PerfTopic
+    BURST_END,
+    /// @brief send the configured number of samples with the payload size to the leader
+    PRODUCE
 };
 
+enum class OutputFormat
+{
+    JSON,
+    CSV
+};
+
+/// @brief the same limit for all technologies, the mempools of iceperf-roudi are sized for it
+constexpr uint32_t MAX_NUMBER_OF_FOLLOWERS{8U};
+
 #endif
@@ -21,22 +21,48 @@
 #include <thread>
 
 Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
-    : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
+    : m_publisher({"IcePerf", publisherName, "C++-API"}, publisherOptions())
+    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, subscriberOptions())
 {
 }
 
-void Iceoryx::initLeader() noexcept
+iox::popo::PublisherOptions Iceoryx::publisherOptions() noexcept
 {
-    init();
+    // no sample must be lost in the throughput benchmarks, therefore the publisher waits for the subscribers
+    iox::popo::PublisherOptions options;
+    options.subscriberTooSlowPolicy = iox::popo::SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+    return options;
 }
 
-void Iceoryx::initFollower() noexcept
+iox::popo::SubscriberOptions Iceoryx::subscriberOptions() noexcept
 {
-    init();
+    iox::popo::SubscriberOptions options;
+    options.queueCapacity = QUEUE_CAPACITY;
+    options.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PUBLISHER;
+    return options;
 }
 
-void Iceoryx::init() noexcept
+void Iceoryx::setupLeader() noexcept
+{
+    waitForConnection();
+
+    std::cout << "Waiting for: " << m_numberOfFollowers << " follower(s)" << std::flush;
+    for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void Iceoryx::setupFollower() noexcept
+{
+    waitForConnection();
+
+    // the leader is subscribed to this follower and this follower to the leader, now it can register
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+}
+
+void Iceoryx::waitForConnection() noexcept
 {
     std::cout << "Waiting for: subscription" << std::flush;
     while (m_subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
@@ -57,7 +83,8 @@ void Iceoryx::shutdown() noexcept
     m_subscriber.unsubscribe();
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!m_publisher.hasSubscribers())
+    // the other side unsubscribes as well, every follower respectively the leader has to be done with the samples
+    while (m_publisher.hasSubscribers())
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -69,14 +96,29 @@ void Iceoryx::shutdown() noexcept
 
 void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
-    m_publisher.loan(payloadSizeInBytes).and_then([&](auto& userPayload) {
-        auto sendSample = static_cast<PerfTopic*>(userPayload);
-        sendSample->payloadSize = payloadSizeInBytes;
-        sendSample->runFlag = runFlag;
-        sendSample->subPackets = 1;
-
-        m_publisher.publish(userPayload);
-    });
+    bool hasSentSample{false};
+
+    do
+    {
+        m_publisher.loan(payloadSizeInBytes)
+            .and_then([&](auto& userPayload) {
+                auto sendSample = static_cast<PerfTopic*>(userPayload);
+                sendSample->payloadSize = payloadSizeInBytes;
+                sendSample->runFlag = runFlag;
+                sendSample->subPackets = 1;
+
+                m_publisher.publish(userPayload);
+                hasSentSample = true;
+            })
+            .or_else([](auto& error) {
+                // the chunks of the samples in flight are released by the subscribers, all other errors are fatal
+                if (error != iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS)
+                {
+                    std::cerr << "Could not loan a chunk! Error code: " << static_cast<uint64_t>(error) << std::endl;
+                    exit(1);
+                }
+            });
+    } while (!hasSentSample);
 }
 
 PerfTopic Iceoryx::receivePerfTopic() noexcept
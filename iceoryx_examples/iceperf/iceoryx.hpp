@@ -26,12 +26,17 @@ class Iceoryx : public IcePerfBase
 {
   public:
     Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
-    void initLeader() noexcept override;
-    void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
-    void init() noexcept;
+    /// @brief the queues are small since every sample of a throughput benchmark blocks a chunk of the mempool
+    static constexpr uint64_t QUEUE_CAPACITY{4U};
+
+    static iox::popo::PublisherOptions publisherOptions() noexcept;
+    static iox::popo::SubscriberOptions subscriberOptions() noexcept;
+    void setupLeader() noexcept override;
+    void setupFollower() noexcept override;
+    void waitForConnection() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
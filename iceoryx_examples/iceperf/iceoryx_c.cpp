@@ -23,13 +23,14 @@ IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro
 {
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
-    publisherOptions.historyCapacity = 1U;
+    // no sample must be lost in the throughput benchmarks, therefore the publisher waits for the subscribers
+    publisherOptions.subscriberTooSlowPolicy = SubscriberTooSlowPolicy_WAIT_FOR_SUBSCRIBER;
     m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), "C-API", &publisherOptions);
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
-    subscriberOptions.queueCapacity = 1U;
-    subscriberOptions.historyRequest = 1U;
+    subscriberOptions.queueCapacity = QUEUE_CAPACITY;
+    subscriberOptions.queueFullPolicy = QueueFullPolicy_BLOCK_PUBLISHER;
     m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
 }
 
@@ -39,17 +40,27 @@ IceoryxC::~IceoryxC()
     iox_sub_deinit(m_subscriber);
 }
 
-void IceoryxC::initLeader() noexcept
+void IceoryxC::setupLeader() noexcept
 {
-    init();
+    waitForConnection();
+
+    std::cout << "Waiting for: " << m_numberOfFollowers << " follower(s)" << std::flush;
+    for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
+    }
+    std::cout << " [ success ]" << std::endl;
 }
 
-void IceoryxC::initFollower() noexcept
+void IceoryxC::setupFollower() noexcept
 {
-    init();
+    waitForConnection();
+
+    // the leader is subscribed to this follower and this follower to the leader, now it can register
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
 }
 
-void IceoryxC::init() noexcept
+void IceoryxC::waitForConnection() noexcept
 {
     iox_pub_offer(m_publisher);
     iox_sub_subscribe(m_subscriber);
@@ -73,7 +84,8 @@ void IceoryxC::shutdown() noexcept
     iox_sub_unsubscribe(m_subscriber);
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!iox_pub_has_subscribers(m_publisher))
+    // the other side unsubscribes as well, every follower respectively the leader has to be done with the samples
+    while (iox_pub_has_subscribers(m_publisher))
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -86,14 +98,24 @@ void IceoryxC::shutdown() noexcept
 void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
     void* userPayload = nullptr;
-    if (iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes) == AllocationResult_SUCCESS)
+    auto result = AllocationResult_SUCCESS;
+    // the chunks of the samples in flight are released by the subscribers, all other errors are fatal
+    while ((result = iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes))
+           == AllocationResult_RUNNING_OUT_OF_CHUNKS)
     {
-        auto sendSample = static_cast<PerfTopic*>(userPayload);
-        sendSample->payloadSize = payloadSizeInBytes;
-        sendSample->runFlag = runFlag;
-        sendSample->subPackets = 1;
-        iox_pub_publish_chunk(m_publisher, userPayload);
     }
+
+    if (result != AllocationResult_SUCCESS)
+    {
+        std::cerr << "Could not loan a chunk! Error code: " << static_cast<uint64_t>(result) << std::endl;
+        exit(1);
+    }
+
+    auto sendSample = static_cast<PerfTopic*>(userPayload);
+    sendSample->payloadSize = payloadSizeInBytes;
+    sendSample->runFlag = runFlag;
+    sendSample->subPackets = 1;
+    iox_pub_publish_chunk(m_publisher, userPayload);
 }
 
 PerfTopic IceoryxC::receivePerfTopic() noexcept
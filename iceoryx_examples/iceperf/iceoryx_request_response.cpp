@@ -0,0 +1,193 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_request_response.hpp"
+
+#include <chrono>
+#include <thread>
+
+IceoryxRequestResponse::IceoryxRequestResponse(const iox::capro::IdString_t& serviceName) noexcept
+    : m_service({"IcePerf", serviceName, "RequestResponse"})
+{
+}
+
+bool IceoryxRequestResponse::isSupported(const Benchmark benchmark) const noexcept
+{
+    // requests and responses which do not fit into the queues are discarded, only the ping pong does not lose any
+    return benchmark == Benchmark::LATENCY;
+}
+
+void IceoryxRequestResponse::setupLeader() noexcept
+{
+    iox::popo::ClientOptions options;
+    options.responseQueueCapacity = QUEUE_CAPACITY;
+    m_client.emplace(m_service, options);
+
+    // the server is offered on creation, when the client is connected the follower is ready
+    std::cout << "Waiting for: server" << std::flush;
+    while (m_client->getConnectionState() != iox::ConnectionState::CONNECTED)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxRequestResponse::setupFollower() noexcept
+{
+    iox::popo::ServerOptions options;
+    options.requestQueueCapacity = QUEUE_CAPACITY;
+    m_server.emplace(m_service, options);
+
+    std::cout << "Waiting for: client" << std::flush;
+    while (!m_server->hasClients())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxRequestResponse::shutdown() noexcept
+{
+    if (m_client.has_value())
+    {
+        m_client->disconnect();
+        m_client.reset();
+    }
+
+    if (m_server.has_value())
+    {
+        if (m_lastRequest != nullptr)
+        {
+            m_server->release(m_lastRequest);
+            m_lastRequest = nullptr;
+        }
+
+        std::cout << "Waiting for: disconnect " << std::flush;
+        while (m_server->hasClients())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        m_server->stopOffer();
+        m_server.reset();
+        std::cout << " [ finished ]" << std::endl;
+    }
+}
+
+void IceoryxRequestResponse::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    if (m_client.has_value())
+    {
+        sendRequest(payloadSizeInBytes, runFlag);
+    }
+    else
+    {
+        sendResponse(payloadSizeInBytes, runFlag);
+    }
+}
+
+PerfTopic IceoryxRequestResponse::receivePerfTopic() noexcept
+{
+    return m_client.has_value() ? takeResponse() : takeRequest();
+}
+
+void IceoryxRequestResponse::sendRequest(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    bool hasSentRequest{false};
+
+    do
+    {
+        m_client->loan(payloadSizeInBytes)
+            .and_then([&](auto& requestPayload) {
+                auto request = static_cast<PerfTopic*>(requestPayload);
+                request->payloadSize = payloadSizeInBytes;
+                request->runFlag = runFlag;
+                request->subPackets = 1;
+
+                m_client->send(requestPayload).or_else([](auto& error) {
+                    std::cerr << "Could not send a request! Error code: " << static_cast<uint64_t>(error) << std::endl;
+                    exit(1);
+                });
+                hasSentRequest = true;
+            })
+            .or_else([](auto& error) {
+                if (error != iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS)
+                {
+                    std::cerr << "Could not loan a request! Error code: " << static_cast<uint64_t>(error) << std::endl;
+                    exit(1);
+                }
+            });
+    } while (!hasSentRequest);
+}
+
+void IceoryxRequestResponse::sendResponse(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    bool hasSentResponse{false};
+
+    do
+    {
+        m_server->loan(m_lastRequest, payloadSizeInBytes)
+            .and_then([&](auto& responsePayload) {
+                auto response = static_cast<PerfTopic*>(responsePayload);
+                response->payloadSize = payloadSizeInBytes;
+                response->runFlag = runFlag;
+                response->subPackets = 1;
+
+                // the client disconnects after the STOP request, the response is released by the server in this case
+                m_server->send(responsePayload).or_else([](auto&) {});
+                hasSentResponse = true;
+            })
+            .or_else([](auto& error) {
+                if (error != iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS)
+                {
+                    std::cerr << "Could not loan a response! Error code: " << static_cast<uint64_t>(error) << std::endl;
+                    exit(1);
+                }
+            });
+    } while (!hasSentResponse);
+}
+
+PerfTopic IceoryxRequestResponse::takeResponse() noexcept
+{
+    bool hasReceivedResponse{false};
+    PerfTopic receivedResponse;
+
+    do
+    {
+        m_client->take().and_then([&](const void* responsePayload) {
+            receivedResponse = *(static_cast<const PerfTopic*>(responsePayload));
+            hasReceivedResponse = true;
+            m_client->release(responsePayload);
+        });
+    } while (!hasReceivedResponse);
+
+    return receivedResponse;
+}
+
+PerfTopic IceoryxRequestResponse::takeRequest() noexcept
+{
+    if (m_lastRequest != nullptr)
+    {
+        m_server->release(m_lastRequest);
+        m_lastRequest = nullptr;
+    }
+
+    do
+    {
+        m_server->take().and_then([&](const void* requestPayload) { m_lastRequest = requestPayload; });
+    } while (m_lastRequest == nullptr);
+
+    return *(static_cast<const PerfTopic*>(m_lastRequest));
+}
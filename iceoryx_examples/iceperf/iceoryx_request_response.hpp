@@ -0,0 +1,55 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_REQUEST_RESPONSE_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_REQUEST_RESPONSE_HPP
+
+#include "base.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+
+/// @brief the leader is the client which sends the PerfTopic as request, the follower is the server which replies
+/// with a response. A client is connected to exactly one server, therefore only one follower is supported.
+class IceoryxRequestResponse : public IcePerfBase
+{
+  public:
+    IceoryxRequestResponse(const iox::capro::IdString_t& serviceName) noexcept;
+    void shutdown() noexcept override;
+    bool isSupported(const Benchmark benchmark) const noexcept override;
+
+  private:
+    /// @brief there is only one request respectively response in flight in the latency benchmark
+    static constexpr uint64_t QUEUE_CAPACITY{4U};
+
+    void setupLeader() noexcept override;
+    void setupFollower() noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+    void sendRequest(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept;
+    void sendResponse(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept;
+    PerfTopic takeResponse() noexcept;
+    PerfTopic takeRequest() noexcept;
+
+    iox::capro::ServiceDescription m_service;
+    iox::cxx::optional<iox::popo::UntypedClient> m_client;
+    iox::cxx::optional<iox::popo::UntypedServer> m_server;
+    /// @brief the follower keeps the last request until it is replaced, a response can only be loaned for a request
+    const void* m_lastRequest{nullptr};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_REQUEST_RESPONSE_HPP
@@ -18,12 +18,15 @@
 #include "iceperf_follower.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_request_response.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
 
 #include <iostream>
+#include <string>
 
 //! [use constants instead of magic values]
 constexpr const char APP_NAME[]{"iceperf-bench-follower"};
@@ -31,12 +34,18 @@ constexpr const char PUBLISHER[]{"Follower"};
 constexpr const char SUBSCRIBER[]{"Leader"};
 //! [use constants instead of magic values]
 
+IcePerfFollower::IcePerfFollower(const uint32_t followerId, const SchedulingSettings& scheduling) noexcept
+    : m_followerId(followerId)
+    , m_scheduling(scheduling)
+{
+}
+
 //! [do the measurement for a single technology]
 void IcePerfFollower::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 {
-    ipcTechnology.initFollower();
+    ipcTechnology.initFollower(m_followerId);
 
-    ipcTechnology.latencyPerfTestFollower();
+    ipcTechnology.perfTestFollower(m_settings.numberOfSamples);
 
     ipcTechnology.shutdown();
 }
@@ -73,7 +82,9 @@ PerfSettings IcePerfFollower::getSettings(iox::popo::Subscriber<PerfSettings>& s
 //! [run all technologies]
 int IcePerfFollower::run() noexcept
 {
-    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+    // every follower needs a unique runtime name
+    iox::runtime::PoshRuntime::initRuntime(
+        iox::RuntimeName_t(iox::cxx::TruncateToCapacity, APP_NAME + std::to_string(m_followerId)));
 
     //! [get settings from leader]
     iox::capro::ServiceDescription serviceDescription{"IcePerf", "Settings", "Generic"};
@@ -84,6 +95,15 @@ int IcePerfFollower::run() noexcept
     m_settings = getSettings(settingsSubscriber);
     //! [get settings from leader]
 
+    if (m_followerId >= m_settings.numberOfFollowers)
+    {
+        std::cerr << "The follower id " << m_followerId << " is out of range, the leader expects "
+                  << m_settings.numberOfFollowers << " follower(s)!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    applySchedulingSettings(m_scheduling);
+
     //! [create an run technologies]
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
@@ -119,6 +139,14 @@ int IcePerfFollower::run() noexcept
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if ((m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_REQUEST_RESPONSE)
+        && m_settings.numberOfFollowers == 1U)
+    {
+        std::cout << std::endl << "*** ICEORYX REQUEST RESPONSE ****" << std::endl;
+        IceoryxRequestResponse iceoryxRequestResponse(SUBSCRIBER);
+        doMeasurement(iceoryxRequestResponse);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
@@ -19,6 +19,7 @@
 
 #include "base.hpp"
 #include "example_common.hpp"
+#include "scheduling.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
@@ -26,7 +27,10 @@
 class IcePerfFollower
 {
   public:
-    IcePerfFollower() noexcept = default;
+    /// @param[in] followerId the unique id of this follower, the leader has to be started with more followers than
+    /// the highest id
+    /// @param[in] scheduling the scheduling of the benchmark thread
+    IcePerfFollower(const uint32_t followerId, const SchedulingSettings& scheduling) noexcept;
 
     int run() noexcept;
 
@@ -35,6 +39,8 @@ class IcePerfFollower
     void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
 
   private:
+    const uint32_t m_followerId;
+    const SchedulingSettings m_scheduling;
     PerfSettings m_settings;
 };
 
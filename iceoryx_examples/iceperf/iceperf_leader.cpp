@@ -18,6 +18,7 @@
 #include "iceperf_leader.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_request_response.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
@@ -26,7 +27,7 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
-#include <iomanip>
+#include <fstream>
 #include <iostream>
 
 //! [use constants instead of magic values]
@@ -35,8 +36,9 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+IcePerfLeader::IcePerfLeader(const PerfSettings settings, const LeaderSettings& leaderSettings) noexcept
     : m_settings(settings)
+    , m_leaderSettings(leaderSettings)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -46,47 +48,77 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
     //! [cleanup outdated resources]
 }
 
-//! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+bool IcePerfLeader::isSelected(const Benchmark benchmark) const noexcept
 {
-    ipcTechnology.initLeader();
+    return m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == benchmark;
+}
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
-    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
-    std::cout << "Measurement for:";
-    const char* separator = " ";
-    for (const auto payloadSizeInKB : payloadSizesInKB)
+//! [measure a single payload size]
+PerfResult IcePerfLeader::measure(const Benchmark benchmark,
+                                  IcePerfBase& ipcTechnology,
+                                  const uint32_t payloadSizeInKB) noexcept
+{
+    PerfResult result;
+    result.benchmark = benchmark;
+    result.numberOfFollowers = m_settings.numberOfFollowers;
+    result.numberOfSamples = m_settings.numberOfSamples;
+    result.payloadSizeInKB = payloadSizeInKB;
+
+    auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
+    switch (benchmark)
     {
-        std::cout << separator << payloadSizeInKB << " kB" << std::flush;
-        separator = ", ";
-        auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
+    case Benchmark::LATENCY:
+        result.latency = ipcTechnology.latencyPerfTestLeader(payloadSizeInBytes, m_settings.numberOfSamples);
+        break;
+    case Benchmark::THROUGHPUT:
+        result.throughput = ipcTechnology.throughputPerfTestLeader(payloadSizeInBytes, m_settings.numberOfSamples);
+        break;
+    case Benchmark::MULTI_PRODUCER:
+        result.throughput = ipcTechnology.multiProducerPerfTestLeader(payloadSizeInBytes, m_settings.numberOfSamples);
+        break;
+    case Benchmark::ALL:
+        break;
+    }
+    return result;
+}
+//! [measure a single payload size]
 
-        ipcTechnology.preLatencyPerfTestLeader(payloadSizeInBytes);
+//! [do the measurement for a single technology]
+void IcePerfLeader::doMeasurement(const Technology technology, IcePerfBase& ipcTechnology) noexcept
+{
+    ipcTechnology.initLeader(m_settings.numberOfFollowers);
 
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
+    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    std::vector<std::vector<PerfResult>> resultsOfBenchmarks;
+    for (const auto benchmark : {Benchmark::LATENCY, Benchmark::THROUGHPUT, Benchmark::MULTI_PRODUCER})
+    {
+        if (!isSelected(benchmark) || !ipcTechnology.isSupported(benchmark))
+        {
+            continue;
+        }
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSizeInKB, latency));
+        resultsOfBenchmarks.emplace_back();
+        std::cout << "Measurement " << BenchmarkString[static_cast<uint32_t>(benchmark)] << " for:";
+        const char* separator = " ";
+        for (const auto payloadSizeInKB : payloadSizesInKB)
+        {
+            std::cout << separator << payloadSizeInKB << " kB" << std::flush;
+            separator = ", ";
 
-        ipcTechnology.postLatencyPerfTestLeader();
+            resultsOfBenchmarks.back().push_back(measure(benchmark, ipcTechnology, payloadSizeInKB));
+            resultsOfBenchmarks.back().back().technology = technology;
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
 
     ipcTechnology.releaseFollower();
 
     ipcTechnology.shutdown();
 
-    std::cout << std::endl;
-    std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
-    std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+    for (const auto& results : resultsOfBenchmarks)
     {
-        auto payloadSizeInKB = std::get<0>(latencyMeasuement);
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        std::cout << "| " << std::setw(17) << payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroseconds << " |" << std::endl;
+        printResults(results.front().benchmark, results);
+        m_results.insert(m_results.end(), results.begin(), results.end());
     }
 
     std::cout << std::endl;
@@ -94,11 +126,60 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 }
 //! [do the measurement for a single technology]
 
+void IcePerfLeader::printResults(const Benchmark benchmark, const std::vector<PerfResult>& results) const noexcept
+{
+    std::cout << std::endl;
+    switch (benchmark)
+    {
+    case Benchmark::LATENCY:
+        std::cout << "#### Latency Result ####" << std::endl;
+        std::cout << m_settings.numberOfSamples << " round trips for each payload with " << m_settings.numberOfFollowers
+                  << " follower(s)." << std::endl;
+        break;
+    case Benchmark::THROUGHPUT:
+        std::cout << "#### Throughput Result ####" << std::endl;
+        std::cout << m_settings.numberOfSamples << " samples for each payload sent to each of "
+                  << m_settings.numberOfFollowers << " follower(s)." << std::endl;
+        break;
+    case Benchmark::MULTI_PRODUCER:
+        std::cout << "#### Multi-Producer Throughput Result ####" << std::endl;
+        std::cout << m_settings.numberOfSamples << " samples for each payload sent by each of "
+                  << m_settings.numberOfFollowers << " follower(s)." << std::endl;
+        break;
+    case Benchmark::ALL:
+        break;
+    }
+    std::cout << std::endl;
+    printResultTable(std::cout, results);
+}
+
+bool IcePerfLeader::writeResults() const noexcept
+{
+    if (m_leaderSettings.outputFile.empty())
+    {
+        return true;
+    }
+
+    std::ofstream outputFile(m_leaderSettings.outputFile);
+    if (!outputFile)
+    {
+        std::cerr << "Could not open '" << m_leaderSettings.outputFile << "' to write the results!" << std::endl;
+        return false;
+    }
+
+    ::writeResults(outputFile, m_results, m_leaderSettings.outputFormat);
+    std::cout << "The results are written to '" << m_leaderSettings.outputFile << "'" << std::endl;
+    return true;
+}
+
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
 {
     iox::runtime::PoshRuntime::initRuntime(APP_NAME);
 
+    // after the runtime is initialized, its threads shall not inherit the scheduling of the benchmark thread
+    applySchedulingSettings(m_leaderSettings.scheduling);
+
     //! [send setting to follower application]
     iox::capro::ServiceDescription serviceDescription{"IcePerf", "Settings", "Generic"};
     iox::popo::PublisherOptions options;
@@ -117,7 +198,7 @@ int IcePerfLeader::run() noexcept
 #ifndef __APPLE__
         std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
         MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        doMeasurement(Technology::POSIX_MESSAGE_QUEUE, mq);
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -130,24 +211,39 @@ int IcePerfLeader::run() noexcept
     {
         std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
         UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        doMeasurement(Technology::UNIX_DOMAIN_SOCKET, uds);
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
         Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurement(Technology::ICEORYX_CPP_API, iceoryx);
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurement(Technology::ICEORYX_C_API, iceoryxc);
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_REQUEST_RESPONSE)
+    {
+        // a client is connected to exactly one server, fan-out setups are not possible
+        if (m_settings.numberOfFollowers == 1U)
+        {
+            std::cout << std::endl << "*** ICEORYX REQUEST RESPONSE ****" << std::endl;
+            IceoryxRequestResponse iceoryxRequestResponse(PUBLISHER);
+            doMeasurement(Technology::ICEORYX_REQUEST_RESPONSE, iceoryxRequestResponse);
+        }
+        else if (m_settings.technology == Technology::ICEORYX_REQUEST_RESPONSE)
+        {
+            std::cout << "Request-response supports only one follower and will be skipped!" << std::endl;
+        }
     }
     //! [create an run technologies]
 
-    return EXIT_SUCCESS;
+    return writeResults() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 //! [run all technologies]
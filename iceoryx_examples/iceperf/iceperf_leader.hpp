@@ -19,21 +19,41 @@
 
 #include "base.hpp"
 #include "example_common.hpp"
+#include "perf_result.hpp"
+#include "scheduling.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <string>
+#include <vector>
+
+/// @brief the settings which only concern the leader and are therefore not sent to the followers
+struct LeaderSettings
+{
+    SchedulingSettings scheduling;
+    /// @brief the file the results of all benchmarks are written to, nothing is written if empty
+    std::string outputFile;
+    OutputFormat outputFormat{OutputFormat::JSON};
+};
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    IcePerfLeader(const PerfSettings settings, const LeaderSettings& leaderSettings) noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    void doMeasurement(const Technology technology, IcePerfBase& ipcTechnology) noexcept;
+    bool isSelected(const Benchmark benchmark) const noexcept;
+    PerfResult measure(const Benchmark benchmark, IcePerfBase& ipcTechnology, const uint32_t payloadSizeInKB) noexcept;
+    void printResults(const Benchmark benchmark, const std::vector<PerfResult>& results) const noexcept;
+    bool writeResults() const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const LeaderSettings m_leaderSettings;
+    std::vector<PerfResult> m_results;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
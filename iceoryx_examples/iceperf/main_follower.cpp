@@ -23,11 +23,18 @@
 
 int main(int argc, char* argv[])
 {
-    constexpr option longOptions[] = {
-        {"help", no_argument, nullptr, 'h'}, {"moo", required_argument, nullptr, 'm'}, {nullptr, 0, nullptr, 0}};
+    uint32_t followerId{0U};
+    SchedulingSettings scheduling;
+
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"follower-id", required_argument, nullptr, 'i'},
+                                      {"cpu-core", required_argument, nullptr, 'c'},
+                                      {"priority", required_argument, nullptr, 'p'},
+                                      {"moo", required_argument, nullptr, 'm'},
+                                      {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hm:";
+    constexpr const char* shortOptions = "hi:c:p:m:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -38,11 +45,49 @@ int main(int argc, char* argv[])
             std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "-h, --help                        Display help" << std::endl;
+            std::cout << "-i, --follower-id <N>             The unique id of this follower when the leader is started"
+                      << std::endl;
+            std::cout << "                                  with multiple followers" << std::endl;
+            std::cout << "                                  default = '0'" << std::endl;
+            std::cout << "-c, --cpu-core <N>                Pin the benchmark thread to the CPU core (Linux only)"
+                      << std::endl;
+            std::cout << "-p, --priority <N>                Run the benchmark thread with SCHED_FIFO and the priority"
+                      << std::endl;
             std::cout << "-m, --moo <intensity>             Prints 'Moo!' with the specified intensity" << std::endl;
             std::cout << "                                  range = '0' to '100'" << std::endl;
             std::cout << "                                  default = '0'" << std::endl;
 
             return EXIT_SUCCESS;
+        case 'i':
+            if (!iox::cxx::convert::fromString(optarg, followerId) || followerId >= MAX_NUMBER_OF_FOLLOWERS)
+            {
+                std::cerr << "The 'follower-id' must be in the range from '0' to '" << MAX_NUMBER_OF_FOLLOWERS - 1U
+                          << "'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'c':
+        {
+            uint32_t cpuCore{0U};
+            if (!iox::cxx::convert::fromString(optarg, cpuCore))
+            {
+                std::cerr << "Could not parse 'cpu-core' parameter!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            scheduling.cpuCore.emplace(cpuCore);
+            break;
+        }
+        case 'p':
+        {
+            int32_t priority{0};
+            if (!iox::cxx::convert::fromString(optarg, priority))
+            {
+                std::cerr << "Could not parse 'priority' parameter!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            scheduling.priority.emplace(priority);
+            break;
+        }
         case 'm':
         {
             constexpr decltype(EXIT_SUCCESS) MOO{EXIT_SUCCESS};
@@ -73,6 +118,6 @@ int main(int argc, char* argv[])
         }
     }
 
-    IcePerfFollower app;
+    IcePerfFollower app(followerId, scheduling);
     return app.run();
 }
@@ -28,15 +28,21 @@
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    LeaderSettings leaderSettings;
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"number-of-followers", required_argument, nullptr, 'f'},
+                                      {"cpu-core", required_argument, nullptr, 'c'},
+                                      {"priority", required_argument, nullptr, 'p'},
+                                      {"output-file", required_argument, nullptr, 'o'},
+                                      {"output-format", required_argument, nullptr, 'F'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:f:c:p:o:F:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -48,18 +54,36 @@ int main(int argc, char* argv[])
             std::cout << "Options:" << std::endl;
             std::cout << "-h, --help                        Display help" << std::endl;
             std::cout << "-b, --benchmark <TYPE>            Selects the type of benchmark to run" << std::endl;
-            std::cout << "                                  <TYPE> {all, latency, throughput}" << std::endl;
+            std::cout << "                                  <TYPE> {all, latency, throughput, multi-producer}"
+                      << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
             std::cout << "-t, --technology <TYPE>           Selects the type of technology to benchmark" << std::endl;
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
-            std::cout << "                                          unix-domain-sockets}" << std::endl;
+            std::cout << "                                          unix-domain-sockets," << std::endl;
+            std::cout << "                                          iceoryx-request-response}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-f, --number-of-followers <N>     Set the number of follower applications, each one has to"
+                      << std::endl;
+            std::cout << "                                  be started with a unique id from '0' to 'N - 1'"
+                      << std::endl;
+            std::cout << "                                  range = '1' to '" << MAX_NUMBER_OF_FOLLOWERS << "'"
+                      << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
+            std::cout << "-c, --cpu-core <N>                Pin the benchmark thread to the CPU core (Linux only)"
+                      << std::endl;
+            std::cout << "-p, --priority <N>                Run the benchmark thread with SCHED_FIFO and the priority"
+                      << std::endl;
+            std::cout << "-o, --output-file <FILE>          Write the results of all benchmarks to the file"
+                      << std::endl;
+            std::cout << "-F, --output-format <FORMAT>      Selects the format of the output file" << std::endl;
+            std::cout << "                                  <FORMAT> {json, csv}" << std::endl;
+            std::cout << "                                  default = 'json'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -75,9 +99,14 @@ int main(int argc, char* argv[])
             {
                 settings.benchmark = Benchmark::THROUGHPUT;
             }
+            else if (strcmp(optarg, "multi-producer") == 0)
+            {
+                settings.benchmark = Benchmark::MULTI_PRODUCER;
+            }
             else
             {
-                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'off'!" << std::endl;
+                std::cerr << "Options for 'benchmark' are 'all', 'latency', 'throughput' and 'multi-producer'!"
+                          << std::endl;
                 return EXIT_FAILURE;
             }
             break;
@@ -102,10 +131,14 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::UNIX_DOMAIN_SOCKET;
             }
+            else if (strcmp(optarg, "iceoryx-request-response") == 0)
+            {
+                settings.technology = Technology::ICEORYX_REQUEST_RESPONSE;
+            }
             else
             {
                 std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                             "'posix-message-queue', 'unix-domain-sockets' and 'iceoryx-request-response'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -116,12 +149,70 @@ int main(int argc, char* argv[])
                 std::cerr << "Could not parse 'number-of-samples' paramater!" << std::endl;
                 return EXIT_FAILURE;
             }
+            if (settings.numberOfSamples == 0U)
+            {
+                std::cerr << "The 'number-of-samples' must not be zero!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfFollowers))
+            {
+                std::cerr << "Could not parse 'number-of-followers' parameter!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (settings.numberOfFollowers == 0U || settings.numberOfFollowers > MAX_NUMBER_OF_FOLLOWERS)
+            {
+                std::cerr << "The 'number-of-followers' must be in the range from '1' to '" << MAX_NUMBER_OF_FOLLOWERS
+                          << "'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'c':
+        {
+            uint32_t cpuCore{0U};
+            if (!iox::cxx::convert::fromString(optarg, cpuCore))
+            {
+                std::cerr << "Could not parse 'cpu-core' parameter!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            leaderSettings.scheduling.cpuCore.emplace(cpuCore);
+            break;
+        }
+        case 'p':
+        {
+            int32_t priority{0};
+            if (!iox::cxx::convert::fromString(optarg, priority))
+            {
+                std::cerr << "Could not parse 'priority' parameter!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            leaderSettings.scheduling.priority.emplace(priority);
+            break;
+        }
+        case 'o':
+            leaderSettings.outputFile = optarg;
+            break;
+        case 'F':
+            if (strcmp(optarg, "json") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::JSON;
+            }
+            else if (strcmp(optarg, "csv") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::CSV;
+            }
+            else
+            {
+                std::cerr << "Options for 'output-format' are 'json' and 'csv'!" << std::endl;
+                return EXIT_FAILURE;
+            }
             break;
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    IcePerfLeader app(settings, leaderSettings);
     return app.run();
 }
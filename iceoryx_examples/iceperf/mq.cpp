@@ -25,51 +25,62 @@
 #include <thread>
 
 MQ::MQ(const std::string& publisherName, const std::string& subscriberName) noexcept
-    : m_publisherMqName(PREFIX + publisherName)
-    , m_subscriberMqName(PREFIX + subscriberName)
+    : m_publisherName(publisherName)
+    , m_subscriberName(subscriberName)
 {
     initMqAttributes();
 }
 
-void MQ::cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept
+void MQ::unlinkMq(const std::string& mqName) noexcept
 {
-    auto publisherMqName = PREFIX + publisherName;
-    iox::posix::posixCall(mq_unlink)(publisherMqName.c_str())
+    iox::posix::posixCall(mq_unlink)(mqName.c_str())
         .failureReturnValue(ERROR_CODE)
         .evaluateWithIgnoredErrnos(ENOENT)
         .or_else([&](auto& r) {
-            std::cout << "mq_unlink error for " << publisherMqName << ", " << r.getHumanReadableErrnum() << std::endl;
+            std::cout << "mq_unlink error for " << mqName << ", " << r.getHumanReadableErrnum() << std::endl;
             exit(1);
         });
+}
 
-    auto subscriberMqName = PREFIX + subscriberName;
-    iox::posix::posixCall(mq_unlink)(subscriberMqName.c_str())
-        .failureReturnValue(ERROR_CODE)
-        .evaluateWithIgnoredErrnos(ENOENT)
-        .or_else([&](auto& r) {
-            std::cout << "mq_unlink error for " << subscriberMqName << ", " << r.getHumanReadableErrnum() << std::endl;
-            exit(1);
-        });
+void MQ::cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept
+{
+    // the previous test could have had any number of followers
+    for (uint32_t followerId = 0U; followerId < MAX_NUMBER_OF_FOLLOWERS; ++followerId)
+    {
+        unlinkMq(PREFIX + publisherName + std::to_string(followerId));
+    }
+
+    unlinkMq(PREFIX + subscriberName);
 }
 
-void MQ::initLeader() noexcept
+void MQ::setupLeader() noexcept
 {
-    open(m_subscriberMqName, iox::posix::IpcChannelSide::SERVER);
+    m_subscriberMqName = PREFIX + m_subscriberName;
+    m_mqDescriptorSubscriber = open(m_subscriberMqName, iox::posix::IpcChannelSide::SERVER);
 
-    std::cout << "waiting for follower" << std::endl;
+    std::cout << "waiting for " << m_numberOfFollowers << " follower(s)" << std::endl;
 
-    receivePerfTopic();
+    for (uint32_t followerId = 0U; followerId < m_numberOfFollowers; ++followerId)
+    {
+        receivePerfTopic();
+    }
 
-    open(m_publisherMqName, iox::posix::IpcChannelSide::CLIENT);
+    for (uint32_t followerId = 0U; followerId < m_numberOfFollowers; ++followerId)
+    {
+        m_publisherMqNames.emplace_back(PREFIX + m_publisherName + std::to_string(followerId));
+        m_mqDescriptorPublishers.emplace_back(open(m_publisherMqNames.back(), iox::posix::IpcChannelSide::CLIENT));
+    }
 }
 
-void MQ::initFollower() noexcept
+void MQ::setupFollower() noexcept
 {
-    open(m_subscriberMqName, iox::posix::IpcChannelSide::SERVER);
+    m_subscriberMqName = PREFIX + m_subscriberName + std::to_string(m_followerId);
+    m_mqDescriptorSubscriber = open(m_subscriberMqName, iox::posix::IpcChannelSide::SERVER);
 
     std::cout << "registering with the leader" << std::endl;
 
-    open(m_publisherMqName, iox::posix::IpcChannelSide::CLIENT);
+    m_publisherMqNames.emplace_back(PREFIX + m_publisherName);
+    m_mqDescriptorPublishers.emplace_back(open(m_publisherMqNames.back(), iox::posix::IpcChannelSide::CLIENT));
 
     sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
 }
@@ -90,54 +101,52 @@ void MQ::initMqAttributes() noexcept
 
 void MQ::shutdown() noexcept
 {
-    iox::posix::posixCall(mq_close)(m_mqDescriptorSubscriber)
-        .failureReturnValue(ERROR_CODE)
-        .evaluate()
-        .or_else([&](auto& r) {
-            std::cout << "mq_close error for " << m_subscriberMqName << ", " << r.getHumanReadableErrnum() << std::endl;
-            exit(1);
-        });
+    close(m_mqDescriptorSubscriber, m_subscriberMqName);
+    unlinkMq(m_subscriberMqName);
 
-    iox::posix::posixCall(mq_unlink)(m_subscriberMqName.c_str())
-        .failureReturnValue(ERROR_CODE)
-        .evaluateWithIgnoredErrnos(ENOENT)
-        .or_else([&](auto& r) {
-            std::cout << "mq_unlink error for " << m_subscriberMqName << ", " << r.getHumanReadableErrnum()
-                      << std::endl;
-            exit(1);
-        });
+    for (uint64_t i = 0U; i < m_mqDescriptorPublishers.size(); ++i)
+    {
+        close(m_mqDescriptorPublishers[i], m_publisherMqNames[i]);
+    }
+}
 
-    iox::posix::posixCall(mq_close)(m_mqDescriptorPublisher)
+void MQ::close(const mqd_t mqDescriptor, const std::string& name) noexcept
+{
+    iox::posix::posixCall(mq_close)(mqDescriptor)
         .failureReturnValue(ERROR_CODE)
         .evaluate()
         .or_else([&](auto& r) {
-            std::cout << "mq_close error for " << m_publisherMqName << ", " << r.getHumanReadableErrnum() << std::endl;
+            std::cout << "mq_close error for " << name << ", " << r.getHumanReadableErrnum() << std::endl;
             exit(1);
         });
 }
 
 void MQ::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
-    char* buffer = new char[payloadSizeInBytes];
-    auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
+    auto sample = reinterpret_cast<PerfTopic*>(&m_sendBuffer[0]);
 
     // Specify the payload size for the measurement
     sample->payloadSize = payloadSizeInBytes;
     sample->runFlag = runFlag;
+    uint32_t packetSize = payloadSizeInBytes;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
-        send(&buffer[0], payloadSizeInBytes);
     }
     else
     {
         sample->subPackets = payloadSizeInBytes / MAX_MESSAGE_SIZE;
+        packetSize = MAX_MESSAGE_SIZE;
+    }
+
+    // every follower has its own message queue, the leader has to copy the payload into each of them
+    for (const auto mqDescriptor : m_mqDescriptorPublishers)
+    {
         for (uint32_t i = 0U; i < sample->subPackets; ++i)
         {
-            send(&buffer[0], MAX_MESSAGE_SIZE);
+            send(mqDescriptor, &m_sendBuffer[0], packetSize);
         }
     }
-    delete[] buffer;
 }
 
 PerfTopic MQ::receivePerfTopic() noexcept
@@ -157,7 +166,7 @@ PerfTopic MQ::receivePerfTopic() noexcept
     return *receivedSample;
 }
 
-void MQ::open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept
+mqd_t MQ::open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept
 {
     int32_t openFlags = O_RDWR;
     if (channelSide == iox::posix::IpcChannelSide::SERVER)
@@ -165,8 +174,8 @@ void MQ::open(const std::string& name, const iox::posix::IpcChannelSide channelS
         openFlags |= O_CREAT;
     }
 
-    constexpr bool TRY_TO_OPEN{true};
-    while (TRY_TO_OPEN)
+    mqd_t mqDescriptor{INVALID_DESCRIPTOR};
+    while (mqDescriptor == INVALID_DESCRIPTOR)
     {
         // the mask will be applied to the permissions, therefore we need to set it to 0
         mode_t umaskSaved = umask(0);
@@ -188,27 +197,19 @@ void MQ::open(const std::string& name, const iox::posix::IpcChannelSide channelS
             continue;
         }
 
-        if (channelSide == iox::posix::IpcChannelSide::SERVER)
-        {
-            m_mqDescriptorSubscriber = mqCall->value;
-        }
-        else
-        {
-            m_mqDescriptorPublisher = mqCall->value;
-        }
-
-        break;
+        mqDescriptor = mqCall->value;
     }
+
+    return mqDescriptor;
 }
 
-void MQ::send(const char* buffer, uint32_t length) noexcept
+void MQ::send(const mqd_t mqDescriptor, const char* buffer, uint32_t length) noexcept
 {
-    iox::posix::posixCall(mq_send)(m_mqDescriptorPublisher, buffer, length, 1U)
+    iox::posix::posixCall(mq_send)(mqDescriptor, buffer, length, 1U)
         .failureReturnValue(ERROR_CODE)
         .evaluate()
         .or_else([&](auto& r) {
-            std::cout << std::endl
-                      << "send error for " << m_publisherMqName << ", " << r.getHumanReadableErrnum() << std::endl;
+            std::cout << std::endl << "send error, " << r.getHumanReadableErrnum() << std::endl;
             exit(1);
         });
 }
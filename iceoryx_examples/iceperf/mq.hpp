@@ -28,6 +28,7 @@
 #include "iceoryx_hoofs/platform/stat.hpp"
 
 #include <string>
+#include <vector>
 
 class MQ : public IcePerfBase
 {
@@ -37,32 +38,40 @@ class MQ : public IcePerfBase
     static constexpr int32_t ERROR_CODE = -1;
     static constexpr mqd_t INVALID_DESCRIPTOR = -1;
 
+    /// @brief The leader receives from all followers with one message queue and sends to every follower with its
+    /// own message queue, whose name is the publisher name of the leader with the id of the follower appended.
     MQ(const std::string& publisherName, const std::string& subscriberName) noexcept;
     /// @brief Cleans up outdated message queues, e.g. from a previous test
     /// @attention only leader is allowed to call this
     static void cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept;
 
-    void initLeader() noexcept override;
-    void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
     static constexpr const char* PREFIX{"/"};
+    static void unlinkMq(const std::string& mqName) noexcept;
+    void setupLeader() noexcept override;
+    void setupFollower() noexcept override;
     void initMqAttributes() noexcept;
-    void open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept;
-    void send(const char* buffer, uint32_t length) noexcept;
+    mqd_t open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept;
+    void close(const mqd_t mqDescriptor, const std::string& name) noexcept;
+    void send(const mqd_t mqDescriptor, const char* buffer, uint32_t length) noexcept;
     void receive(char* buffer) noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
-    const std::string m_publisherMqName;
-    const std::string m_subscriberMqName;
+    const std::string m_publisherName;
+    const std::string m_subscriberName;
+    std::string m_subscriberMqName;
+    std::vector<std::string> m_publisherMqNames;
     struct mq_attr m_attributes;
-    mqd_t m_mqDescriptorPublisher = INVALID_DESCRIPTOR;
+    std::vector<mqd_t> m_mqDescriptorPublishers;
     mqd_t m_mqDescriptorSubscriber = INVALID_DESCRIPTOR;
     // read/write permissions
     static constexpr mode_t m_filemode{S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH};
     char m_message[MAX_MESSAGE_SIZE];
+    // only the PerfTopic at the beginning is relevant, the same buffer is sent for every sub-packet
+    char m_sendBuffer[MAX_MESSAGE_SIZE];
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_MQ_HPP
@@ -0,0 +1,190 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "perf_result.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+namespace
+{
+constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+constexpr double NANOSECONDS_PER_SECOND{1000.0 * 1000.0 * 1000.0};
+constexpr double BYTES_PER_GIGABYTE{1000.0 * 1000.0 * 1000.0};
+
+/// @brief nearest-rank percentile of sorted samples
+uint64_t percentile(const std::vector<uint64_t>& sortedSamples, const double fraction) noexcept
+{
+    auto rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(sortedSamples.size())));
+    auto index = (rank == 0U) ? 0U : rank - 1U;
+    return sortedSamples[std::min<uint64_t>(index, sortedSamples.size() - 1U)];
+}
+
+double toMicroseconds(const iox::units::Duration duration) noexcept
+{
+    return static_cast<double>(duration.toNanoseconds()) / NANOSECONDS_PER_MICROSECOND;
+}
+
+bool isLatencyBenchmark(const PerfResult& result) noexcept
+{
+    return result.benchmark == Benchmark::LATENCY;
+}
+} // namespace
+
+LatencyResult LatencyResult::fromSamples(std::vector<uint64_t>& latenciesInNanoseconds) noexcept
+{
+    LatencyResult result;
+    if (latenciesInNanoseconds.empty())
+    {
+        return result;
+    }
+
+    std::sort(latenciesInNanoseconds.begin(), latenciesInNanoseconds.end());
+
+    uint64_t sum{0U};
+    for (const auto latency : latenciesInNanoseconds)
+    {
+        sum += latency;
+    }
+
+    result.average = iox::units::Duration::fromNanoseconds(sum / latenciesInNanoseconds.size());
+    result.minimum = iox::units::Duration::fromNanoseconds(latenciesInNanoseconds.front());
+    result.p50 = iox::units::Duration::fromNanoseconds(percentile(latenciesInNanoseconds, 0.5));
+    result.p99 = iox::units::Duration::fromNanoseconds(percentile(latenciesInNanoseconds, 0.99));
+    result.p99_9 = iox::units::Duration::fromNanoseconds(percentile(latenciesInNanoseconds, 0.999));
+    result.maximum = iox::units::Duration::fromNanoseconds(latenciesInNanoseconds.back());
+    return result;
+}
+
+double ThroughputResult::messagesPerSecond() const noexcept
+{
+    auto durationInNanoseconds = static_cast<double>(duration.toNanoseconds());
+    return (durationInNanoseconds > 0.0)
+               ? static_cast<double>(numberOfMessages) * NANOSECONDS_PER_SECOND / durationInNanoseconds
+               : 0.0;
+}
+
+double ThroughputResult::gigabytesPerSecond() const noexcept
+{
+    auto durationInNanoseconds = static_cast<double>(duration.toNanoseconds());
+    return (durationInNanoseconds > 0.0) ? static_cast<double>(numberOfBytes) / BYTES_PER_GIGABYTE
+                                               * NANOSECONDS_PER_SECOND / durationInNanoseconds
+                                         : 0.0;
+}
+
+void printResultTable(std::ostream& stream, const std::vector<PerfResult>& results) noexcept
+{
+    if (results.empty())
+    {
+        return;
+    }
+
+    if (isLatencyBenchmark(results.front()))
+    {
+        stream << "| Payload Size [kB] | Average Latency [µs] |   p50 [µs] |   p99 [µs] | p99.9 [µs] |   Max [µs] |"
+               << std::endl;
+        stream << "|------------------:|---------------------:|-----------:|-----------:|-----------:|-----------:|"
+               << std::endl;
+        for (const auto& result : results)
+        {
+            stream << "| " << std::setw(17) << result.payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
+                   << toMicroseconds(result.latency.average) << " | " << std::setw(10)
+                   << toMicroseconds(result.latency.p50) << " | " << std::setw(10) << toMicroseconds(result.latency.p99)
+                   << " | " << std::setw(10) << toMicroseconds(result.latency.p99_9) << " | " << std::setw(10)
+                   << toMicroseconds(result.latency.maximum) << " |" << std::endl;
+        }
+    }
+    else
+    {
+        stream << "| Payload Size [kB] | Throughput [Messages/s] | Throughput [GB/s] |" << std::endl;
+        stream << "|------------------:|------------------------:|------------------:|" << std::endl;
+        for (const auto& result : results)
+        {
+            stream << "| " << std::setw(17) << result.payloadSizeInKB << " | " << std::setw(23) << std::setprecision(3)
+                   << result.throughput.messagesPerSecond() << " | " << std::setw(17)
+                   << result.throughput.gigabytesPerSecond() << " |" << std::endl;
+        }
+    }
+}
+
+void writeResults(std::ostream& stream, const std::vector<PerfResult>& results, const OutputFormat format) noexcept
+{
+    stream << std::setprecision(6);
+
+    switch (format)
+    {
+    case OutputFormat::JSON:
+    {
+        stream << "[" << std::endl;
+        const char* separator = "";
+        for (const auto& result : results)
+        {
+            stream << separator << "  {\"technology\": \""
+                   << TechnologyString[static_cast<uint32_t>(result.technology)] << "\", \"benchmark\": \""
+                   << BenchmarkString[static_cast<uint32_t>(result.benchmark)]
+                   << "\", \"numberOfFollowers\": " << result.numberOfFollowers
+                   << ", \"numberOfSamples\": " << result.numberOfSamples
+                   << ", \"payloadSizeInKB\": " << result.payloadSizeInKB << ", ";
+            if (isLatencyBenchmark(result))
+            {
+                stream << "\"latencyInMicroseconds\": {\"average\": " << toMicroseconds(result.latency.average)
+                       << ", \"min\": " << toMicroseconds(result.latency.minimum)
+                       << ", \"p50\": " << toMicroseconds(result.latency.p50)
+                       << ", \"p99\": " << toMicroseconds(result.latency.p99)
+                       << ", \"p99.9\": " << toMicroseconds(result.latency.p99_9)
+                       << ", \"max\": " << toMicroseconds(result.latency.maximum) << "}}";
+            }
+            else
+            {
+                stream << "\"messagesPerSecond\": " << result.throughput.messagesPerSecond()
+                       << ", \"gigabytesPerSecond\": " << result.throughput.gigabytesPerSecond() << "}";
+            }
+            separator = ",\n";
+        }
+        stream << std::endl << "]" << std::endl;
+        break;
+    }
+    case OutputFormat::CSV:
+    {
+        stream << "technology,benchmark,number_of_followers,number_of_samples,payload_size_kb,"
+                  "average_latency_us,min_latency_us,p50_latency_us,p99_latency_us,p99_9_latency_us,max_latency_us,"
+                  "messages_per_second,gigabytes_per_second"
+               << std::endl;
+        for (const auto& result : results)
+        {
+            stream << TechnologyString[static_cast<uint32_t>(result.technology)] << ","
+                   << BenchmarkString[static_cast<uint32_t>(result.benchmark)] << ","
+                   << result.numberOfFollowers << "," << result.numberOfSamples << "," << result.payloadSizeInKB
+                   << ",";
+            if (isLatencyBenchmark(result))
+            {
+                stream << toMicroseconds(result.latency.average) << "," << toMicroseconds(result.latency.minimum)
+                       << "," << toMicroseconds(result.latency.p50) << "," << toMicroseconds(result.latency.p99)
+                       << "," << toMicroseconds(result.latency.p99_9) << "," << toMicroseconds(result.latency.maximum)
+                       << ",,";
+            }
+            else
+            {
+                stream << ",,,,,," << result.throughput.messagesPerSecond() << ","
+                       << result.throughput.gigabytesPerSecond();
+            }
+            stream << std::endl;
+        }
+        break;
+    }
+    }
+}
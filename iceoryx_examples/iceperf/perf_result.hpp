@@ -0,0 +1,73 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_PERF_RESULT_HPP
+#define IOX_EXAMPLES_ICEPERF_PERF_RESULT_HPP
+
+#include "example_common.hpp"
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/// @brief the distribution of the one-way latencies of a latency measurement
+struct LatencyResult
+{
+    /// @brief calculates the statistics from the latency of every single round trip
+    /// @param[in] latenciesInNanoseconds the latencies, they are sorted by this function
+    static LatencyResult fromSamples(std::vector<uint64_t>& latenciesInNanoseconds) noexcept;
+
+    iox::units::Duration average{iox::units::Duration::fromNanoseconds(0U)};
+    iox::units::Duration minimum{iox::units::Duration::fromNanoseconds(0U)};
+    iox::units::Duration p50{iox::units::Duration::fromNanoseconds(0U)};
+    iox::units::Duration p99{iox::units::Duration::fromNanoseconds(0U)};
+    iox::units::Duration p99_9{iox::units::Duration::fromNanoseconds(0U)};
+    iox::units::Duration maximum{iox::units::Duration::fromNanoseconds(0U)};
+};
+
+/// @brief the number of messages and bytes which were received within the duration of a throughput measurement
+struct ThroughputResult
+{
+    double messagesPerSecond() const noexcept;
+    double gigabytesPerSecond() const noexcept;
+
+    uint64_t numberOfMessages{0U};
+    uint64_t numberOfBytes{0U};
+    iox::units::Duration duration{iox::units::Duration::fromNanoseconds(0U)};
+};
+
+/// @brief the result of a single benchmark for a single payload size; depending on the benchmark either latency or
+/// throughput is set
+struct PerfResult
+{
+    Technology technology{Technology::ALL};
+    Benchmark benchmark{Benchmark::LATENCY};
+    uint32_t numberOfFollowers{1U};
+    uint64_t numberOfSamples{0U};
+    uint32_t payloadSizeInKB{0U};
+    LatencyResult latency;
+    ThroughputResult throughput;
+};
+
+/// @brief prints the results of one benchmark as markdown table
+void printResultTable(std::ostream& stream, const std::vector<PerfResult>& results) noexcept;
+
+/// @brief writes the results of all benchmarks in a machine readable format
+void writeResults(std::ostream& stream, const std::vector<PerfResult>& results, const OutputFormat format) noexcept;
+
+#endif // IOX_EXAMPLES_ICEPERF_PERF_RESULT_HPP
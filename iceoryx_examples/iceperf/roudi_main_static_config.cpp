@@ -47,7 +47,9 @@ int main(int argc, char* argv[])
     mepooConfig.addMemPool({ONE_KILOBYTE * 128, 200});
     mepooConfig.addMemPool({ONE_KILOBYTE * 512, 50});
     mepooConfig.addMemPool({ONE_MEGABYTE, 30});
-    mepooConfig.addMemPool({ONE_MEGABYTE * 4, 10});
+    // the throughput benchmarks keep a few samples in flight for each follower
+    // the requests and responses of the request-response benchmark need additional space for their user-header
+    mepooConfig.addMemPool({ONE_MEGABYTE * 4 + ONE_KILOBYTE, 24});
 
     /// We want to use the Shared Memory Segment for the current user
     auto currentGroup = iox::posix::PosixGroup::getGroupOfCurrentProcess();
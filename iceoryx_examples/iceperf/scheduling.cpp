@@ -0,0 +1,50 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "scheduling.hpp"
+
+#include "iceoryx_hoofs/platform/pthread.hpp"
+
+#include <cstring>
+#include <iostream>
+
+void applySchedulingSettings(const SchedulingSettings& settings) noexcept
+{
+    settings.cpuCore.and_then([](auto& cpuCore) {
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpuCore, &cpuSet);
+        auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+        if (result != 0)
+        {
+            std::cerr << "Could not pin the thread to core " << cpuCore << ": " << strerror(result) << std::endl;
+        }
+#else
+        std::cerr << "Pinning the thread to core " << cpuCore << " is only supported on Linux!" << std::endl;
+#endif
+    });
+
+    settings.priority.and_then([](auto& priority) {
+        sched_param parameter;
+        parameter.sched_priority = priority;
+        auto result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameter);
+        if (result != 0)
+        {
+            std::cerr << "Could not set the SCHED_FIFO priority " << priority << ": " << strerror(result) << std::endl;
+        }
+    });
+}
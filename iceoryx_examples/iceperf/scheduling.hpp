@@ -0,0 +1,38 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_SCHEDULING_HPP
+#define IOX_EXAMPLES_ICEPERF_SCHEDULING_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <cstdint>
+
+/// @brief the scheduling of the thread which runs the benchmark, pinning the leader and the followers to different
+/// cores and running them with a real-time priority reduces the jitter of the measurement
+struct SchedulingSettings
+{
+    /// @brief the core the thread is pinned to, only supported on Linux
+    iox::cxx::optional<uint32_t> cpuCore;
+    /// @brief the SCHED_FIFO priority of the thread, requires the permission to use real-time scheduling
+    iox::cxx::optional<int32_t> priority;
+};
+
+/// @brief applies the scheduling settings to the calling thread, settings which cannot be applied are reported and
+/// skipped
+void applySchedulingSettings(const SchedulingSettings& settings) noexcept;
+
+#endif // IOX_EXAMPLES_ICEPERF_SCHEDULING_HPP
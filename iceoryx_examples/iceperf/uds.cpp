@@ -23,11 +23,9 @@
 #include <thread>
 
 UDS::UDS(const std::string& publisherName, const std::string& subscriberName) noexcept
-    : m_publisherSocketName(PREFIX + publisherName)
-    , m_subscriberSocketName(PREFIX + subscriberName)
+    : m_publisherName(publisherName)
+    , m_subscriberName(subscriberName)
 {
-    initSocketAddress(m_sockAddrPublisher, m_publisherSocketName);
-    initSocketAddress(m_sockAddrSubscriber, m_subscriberSocketName);
 }
 
 void UDS::initSocketAddress(sockaddr_un& socketAddr, const std::string& socketName)
@@ -39,45 +37,50 @@ void UDS::initSocketAddress(sockaddr_un& socketAddr, const std::string& socketNa
     strncpy(socketAddr.sun_path, socketName.c_str(), socketName.size());
 }
 
-void UDS::cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept
+void UDS::unlinkSocket(const std::string& socketName) noexcept
 {
-    auto publisherSocketName = PREFIX + publisherName;
-    sockaddr_un sockAddrPublisher;
-    initSocketAddress(sockAddrPublisher, publisherSocketName);
-    iox::posix::posixCall(unlink)(sockAddrPublisher.sun_path)
+    sockaddr_un sockAddr;
+    initSocketAddress(sockAddr, socketName);
+    iox::posix::posixCall(unlink)(sockAddr.sun_path)
         .failureReturnValue(ERROR_CODE)
         .evaluateWithIgnoredErrnos(ENOENT)
         .or_else([](auto& r) {
             std::cout << "unlink error " << r.getHumanReadableErrnum() << std::endl;
             exit(1);
         });
+}
 
-    auto subscriberSocketName = PREFIX + subscriberName;
-    sockaddr_un sockAddrSubscriber;
-    initSocketAddress(sockAddrSubscriber, subscriberSocketName);
+void UDS::cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept
+{
+    // the previous test could have had any number of followers
+    for (uint32_t followerId = 0U; followerId < MAX_NUMBER_OF_FOLLOWERS; ++followerId)
+    {
+        unlinkSocket(PREFIX + publisherName + std::to_string(followerId));
+    }
 
-    iox::posix::posixCall(unlink)(sockAddrSubscriber.sun_path)
-        .failureReturnValue(ERROR_CODE)
-        .evaluateWithIgnoredErrnos(ENOENT)
-        .or_else([](auto& r) {
-            std::cout << "unlink error " << r.getHumanReadableErrnum() << std::endl;
-            exit(1);
-        });
+    unlinkSocket(PREFIX + subscriberName);
 }
 
-void UDS::initLeader() noexcept
+void UDS::setupLeader() noexcept
 {
-    init();
+    init(PREFIX + m_subscriberName);
 
-    std::cout << "waiting for follower" << std::endl;
-    waitForFollower();
+    for (uint32_t followerId = 0U; followerId < m_numberOfFollowers; ++followerId)
+    {
+        m_sockAddrPublishers.emplace_back();
+        initSocketAddress(m_sockAddrPublishers.back(), PREFIX + m_publisherName + std::to_string(followerId));
+    }
 
-    receivePerfTopic();
+    std::cout << "waiting for " << m_numberOfFollowers << " follower(s)" << std::endl;
+    waitForFollower();
 }
 
-void UDS::initFollower() noexcept
+void UDS::setupFollower() noexcept
 {
-    init();
+    init(PREFIX + m_subscriberName + std::to_string(m_followerId));
+
+    m_sockAddrPublishers.emplace_back();
+    initSocketAddress(m_sockAddrPublishers.back(), PREFIX + m_publisherName);
 
     std::cout << "registering with the leader" << std::endl;
     waitForLeader();
@@ -85,8 +88,10 @@ void UDS::initFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
 }
 
-void UDS::init() noexcept
+void UDS::init(const std::string& subscriberSocketName) noexcept
 {
+    initSocketAddress(m_sockAddrSubscriber, subscriberSocketName);
+
     // init subscriber
     iox::posix::posixCall(socket)(AF_LOCAL, SOCK_DGRAM, 0)
         .failureReturnValue(ERROR_CODE)
@@ -127,8 +132,8 @@ void UDS::waitForLeader() noexcept
                                                       nullptr,
                                                       0,
                                                       0,
-                                                      reinterpret_cast<struct sockaddr*>(&m_sockAddrPublisher),
-                                                      sizeof(m_sockAddrPublisher))
+                                                      reinterpret_cast<struct sockaddr*>(&m_sockAddrPublishers[0]),
+                                                      sizeof(m_sockAddrPublishers[0]))
                             .failureReturnValue(ERROR_CODE)
                             .evaluateWithIgnoredErrnos(ENOENT)
                             .or_else([](auto& r) {
@@ -150,8 +155,11 @@ void UDS::waitForLeader() noexcept
 
 void UDS::waitForFollower() noexcept
 {
-    // try to receive the empty message
-    receive(m_message);
+    // every follower sends an empty message and a PerfTopic to register, they can arrive interleaved
+    for (uint32_t i = 0U; i < 2U * m_numberOfFollowers; ++i)
+    {
+        receive(m_message);
+    }
 }
 
 void UDS::shutdown() noexcept
@@ -189,26 +197,30 @@ void UDS::shutdown() noexcept
 
 void UDS::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
-    char* buffer = new char[payloadSizeInBytes];
-    auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
+    auto sample = reinterpret_cast<PerfTopic*>(&m_sendBuffer[0]);
 
     // Specify the payload size for the measurement
     sample->payloadSize = payloadSizeInBytes;
     sample->runFlag = runFlag;
+    uint32_t packetSize = payloadSizeInBytes;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
-        send(&buffer[0], payloadSizeInBytes);
     }
     else
     {
         sample->subPackets = payloadSizeInBytes / MAX_MESSAGE_SIZE;
+        packetSize = MAX_MESSAGE_SIZE;
+    }
+
+    // every follower has its own socket, the leader has to copy the payload into each of them
+    for (const auto& sockAddr : m_sockAddrPublishers)
+    {
         for (uint32_t i = 0U; i < sample->subPackets; ++i)
         {
-            send(&buffer[0], MAX_MESSAGE_SIZE);
+            send(sockAddr, &m_sendBuffer[0], packetSize);
         }
     }
-    delete[] buffer;
 }
 
 PerfTopic UDS::receivePerfTopic() noexcept
@@ -228,7 +240,7 @@ PerfTopic UDS::receivePerfTopic() noexcept
     return *receivedSample;
 }
 
-void UDS::send(const char* buffer, uint32_t length) noexcept
+void UDS::send(const sockaddr_un& sockAddr, const char* buffer, uint32_t length) noexcept
 {
     // only return from this loop when the message could be send successfully
     // if the OS socket message buffer if full, retry until it is free'd by
@@ -237,8 +249,8 @@ void UDS::send(const char* buffer, uint32_t length) noexcept
                                          buffer,
                                          length,
                                          0,
-                                         reinterpret_cast<struct sockaddr*>(&m_sockAddrPublisher),
-                                         sizeof(m_sockAddrPublisher))
+                                         reinterpret_cast<const struct sockaddr*>(&sockAddr),
+                                         sizeof(sockAddr))
                .failureReturnValue(ERROR_CODE)
                .evaluateWithIgnoredErrnos(ENOBUFS)
                .or_else([](auto& r) {
@@ -27,6 +27,7 @@
 #include "iceoryx_hoofs/platform/unistd.hpp"
 
 #include <string>
+#include <vector>
 
 class UDS : public IcePerfBase
 {
@@ -42,19 +43,22 @@ class UDS : public IcePerfBase
     static constexpr int32_t ERROR_CODE = -1;
     static constexpr int32_t INVALID_FD = -1;
 
+    /// @brief The leader receives from all followers with one socket and sends to every follower with its own socket,
+    /// whose name is the publisher name of the leader with the id of the follower appended.
     UDS(const std::string& publisherName, const std::string& subscriberName) noexcept;
     /// @brief Cleans up outdated sockets, e.g. from a previous test
     /// @attention only leader is allowed to call this
     static void cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept;
 
-    void initLeader() noexcept override;
-    void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
     static constexpr const char* PREFIX{"/tmp/"};
-    void init() noexcept;
-    void send(const char* buffer, uint32_t length) noexcept;
+    static void unlinkSocket(const std::string& socketName) noexcept;
+    void setupLeader() noexcept override;
+    void setupFollower() noexcept override;
+    void init(const std::string& subscriberSocketName) noexcept;
+    void send(const sockaddr_un& sockAddr, const char* buffer, uint32_t length) noexcept;
     void receive(char* buffer) noexcept;
     void waitForLeader() noexcept;
     void waitForFollower() noexcept;
@@ -63,13 +67,15 @@ class UDS : public IcePerfBase
 
     static void initSocketAddress(sockaddr_un& sockAddr, const std::string& socketName);
 
-    const std::string m_publisherSocketName;
-    const std::string m_subscriberSocketName;
+    const std::string m_publisherName;
+    const std::string m_subscriberName;
     int m_sockfdPublisher{INVALID_FD};
     int m_sockfdSubscriber{INVALID_FD};
-    struct sockaddr_un m_sockAddrPublisher;
+    std::vector<sockaddr_un> m_sockAddrPublishers;
     struct sockaddr_un m_sockAddrSubscriber;
     char m_message[MAX_MESSAGE_SIZE];
+    // only the PerfTopic at the beginning is relevant, the same buffer is sent for every sub-packet
+    char m_sendBuffer[MAX_MESSAGE_SIZE];
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_UDS_HPP
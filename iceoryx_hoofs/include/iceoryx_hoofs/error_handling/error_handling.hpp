@@ -38,12 +38,18 @@ namespace iox
     error(POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE) \
     error(POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNDEFINED_BEHAVIOR) \
     error(POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNDEFINED_BEHAVIOR) \
+    error(POSH__RUNTIME_CLIENT_PORT_CREATION_UNDEFINED_BEHAVIOR) \
+    error(POSH__RUNTIME_SERVER_PORT_CREATION_UNDEFINED_BEHAVIOR) \
     error(POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL) \
+    error(POSH__RUNTIME_ROUDI_CLIENT_LIST_FULL) \
+    error(POSH__RUNTIME_ROUDI_SERVER_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_EVENT_VARIABLE_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_EVENT_VARIABLE_WRONG_MESSAGE_QUEUE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE) \
@@ -78,8 +84,11 @@ namespace iox
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_STATE_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
+    error(POPO__CHUNK_DISTRIBUTOR_QUEUE_SNAPSHOT_NOT_RELEASED_BY_SENDER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER) \
     error(POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER) \
@@ -87,10 +96,8 @@ namespace iox
     error(POPO__CHUNK_UNLOCKING_ERROR) \
     error(POPO__CAPRO_PROTOCOL_ERROR) \
     error(POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
-    error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAS_TRIGGERED) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
-    error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
@@ -118,6 +125,8 @@ namespace iox
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
     error(PORT_POOL__PUBLISHERLIST_OVERFLOW) \
     error(PORT_POOL__SUBSCRIBERLIST_OVERFLOW) \
+    error(PORT_POOL__CLIENTLIST_OVERFLOW) \
+    error(PORT_POOL__SERVERLIST_OVERFLOW) \
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__APPLICATIONLIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
@@ -127,6 +136,8 @@ namespace iox
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
     error(PORT_MANAGER__HANDLE_SUBSCRIBER_PORTS_INVALID_CAPRO_MESSAGE) \
+    error(PORT_MANAGER__HANDLE_CLIENT_PORTS_INVALID_CAPRO_MESSAGE) \
+    error(PORT_MANAGER__HANDLE_SERVER_PORTS_INVALID_CAPRO_MESSAGE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONPORTSERVICE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONPORTTHROUGHPUTSERVICE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONCHANGINGDATASERVICE) \
@@ -0,0 +1,103 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_CACHE_LINE_ISOLATED_HPP
+#define IOX_HOOFS_CONCURRENT_CACHE_LINE_ISOLATED_HPP
+
+#include "iceoryx_hoofs/cxx/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief the size of a cache line of the supported platforms
+constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+/// @brief the minimal distance of two objects which are modified by different threads to prevent false sharing; it
+/// is two cache lines since the adjacent line prefetcher of x86 and the caches of some ARM CPUs work on 128 byte
+/// blocks
+constexpr uint64_t FALSE_SHARING_RANGE{2U * CACHE_LINE_SIZE};
+
+/// @brief Surrounds an object with FALSE_SHARING_RANGE bytes of padding on each side, therefore it never shares a
+/// cache line with another object. This is used to separate the state of the producer from the state of the consumer
+/// of the concurrent queues, which are usually accessed from different processes.
+/// @note The padding is used instead of alignas since an over-aligned type is neither supported by operator new
+/// before C++17 nor by the allocators of the shared memory. The isolation therefore does not depend on the
+/// alignment of the surrounding object at the cost of a larger memory footprint.
+/// @code
+///     struct Producer
+///     {
+///         std::atomic<uint64_t> writePosition{0U};
+///         uint64_t cachedReadPosition{0U};
+///     };
+///     CacheLineIsolated<Producer> m_producer;
+///
+///     m_producer->writePosition.store(1U, std::memory_order_release);
+/// @endcode
+template <typename T>
+class CacheLineIsolated
+{
+  public:
+    template <typename... Targs>
+    explicit CacheLineIsolated(Targs&&... args) noexcept
+        : m_value(std::forward<Targs>(args)...)
+    {
+        static_assert(offsetof(CacheLineIsolated, m_value) >= FALSE_SHARING_RANGE,
+                      "The isolated object must be preceded by at least FALSE_SHARING_RANGE bytes");
+        static_assert(sizeof(CacheLineIsolated) - offsetof(CacheLineIsolated, m_value) - sizeof(T)
+                          >= FALSE_SHARING_RANGE,
+                      "The isolated object must be followed by at least FALSE_SHARING_RANGE bytes");
+    }
+
+    CacheLineIsolated(const CacheLineIsolated&) = delete;
+    CacheLineIsolated(CacheLineIsolated&&) = delete;
+    CacheLineIsolated& operator=(const CacheLineIsolated&) = delete;
+    CacheLineIsolated& operator=(CacheLineIsolated&&) = delete;
+    ~CacheLineIsolated() noexcept = default;
+
+    T* operator->() noexcept
+    {
+        return &m_value;
+    }
+
+    const T* operator->() const noexcept
+    {
+        return &m_value;
+    }
+
+    T& operator*() noexcept
+    {
+        return m_value;
+    }
+
+    const T& operator*() const noexcept
+    {
+        return m_value;
+    }
+
+  private:
+    cxx::byte_t m_paddingFront[FALSE_SHARING_RANGE];
+    T m_value;
+    cxx::byte_t m_paddingBack[FALSE_SHARING_RANGE];
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_CACHE_LINE_ISOLATED_HPP
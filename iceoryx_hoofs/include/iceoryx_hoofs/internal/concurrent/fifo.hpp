@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_FIFO_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
 
 #include <atomic>
 
@@ -50,12 +51,27 @@ class FiFo
     static constexpr uint64_t capacity() noexcept;
 
   private:
-    bool is_full() const noexcept;
+    /// @brief the state of the producer; the cached read position is a lower bound of the read position which is only
+    /// reloaded when the fifo seems to be full
+    struct ProducerState
+    {
+        std::atomic<uint64_t> m_write_pos{0};
+        uint64_t m_cachedReadPos{0};
+    };
+
+    /// @brief the state of the consumer; the cached write position is a lower bound of the write position which is
+    /// only reloaded when the fifo seems to be empty
+    struct ConsumerState
+    {
+        std::atomic<uint64_t> m_read_pos{0};
+        uint64_t m_cachedWritePos{0};
+    };
 
   private:
     ValueType m_data[Capacity];
-    std::atomic<uint64_t> m_write_pos{0};
-    std::atomic<uint64_t> m_read_pos{0};
+    // producer and consumer are usually in different processes and do not share a cache line
+    CacheLineIsolated<ProducerState> m_producer;
+    CacheLineIsolated<ConsumerState> m_consumer;
 };
 
 } // namespace concurrent
@@ -23,37 +23,45 @@ namespace iox
 {
 namespace concurrent
 {
+// The FiFo is usually accessed via the pointer of cxx::variant::get_at_index, which is a nullptr for a mismatching
+// type index. After inlining, GCC 12 analyzes the atomic accesses on this unreachable path as accesses to the fixed
+// offsets of m_producer and m_consumer from address 0 and reports them as writes into a region of size 0.
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#endif
 template <class ValueType, uint64_t Capacity>
 inline bool FiFo<ValueType, Capacity>::push(const ValueType& f_param_r) noexcept
 {
-    if (is_full())
+    auto currentWritePos = m_producer->m_write_pos.load(std::memory_order_relaxed);
+
+    // the read position only grows, therefore it is sufficient to load it when
+    // the fifo seems to be full with the cached read position; the acquire
+    // ensures that the pop'ed values were read before they are overwritten
+    if (currentWritePos == m_producer->m_cachedReadPos + Capacity)
     {
-        return false;
+        m_producer->m_cachedReadPos = m_consumer->m_read_pos.load(std::memory_order_acquire);
+        if (currentWritePos == m_producer->m_cachedReadPos + Capacity)
+        {
+            return false;
+        }
     }
-    else
-    {
-        auto currentWritePos = m_write_pos.load(std::memory_order_relaxed);
-        m_data[currentWritePos % Capacity] = f_param_r;
 
-        // m_write_pos must be increased after writing the new value otherwise
-        // it is possible that the value is read by pop while it is written.
-        // this fifo is a single producer, single consumer fifo therefore
-        // store is allowed.
-        m_write_pos.store(currentWritePos + 1, std::memory_order_release);
-        return true;
-    }
-}
+    m_data[currentWritePos % Capacity] = f_param_r;
 
-template <class ValueType, uint64_t Capacity>
-inline bool FiFo<ValueType, Capacity>::is_full() const noexcept
-{
-    return m_write_pos.load(std::memory_order_relaxed) == m_read_pos.load(std::memory_order_relaxed) + Capacity;
+    // m_write_pos must be increased after writing the new value otherwise
+    // it is possible that the value is read by pop while it is written.
+    // this fifo is a single producer, single consumer fifo therefore
+    // store is allowed.
+    m_producer->m_write_pos.store(currentWritePos + 1, std::memory_order_release);
+    return true;
 }
 
 template <class ValueType, uint64_t Capacity>
 inline uint64_t FiFo<ValueType, Capacity>::size() const noexcept
 {
-    return m_write_pos.load(std::memory_order_relaxed) - m_read_pos.load(std::memory_order_relaxed);
+    return m_producer->m_write_pos.load(std::memory_order_relaxed)
+           - m_consumer->m_read_pos.load(std::memory_order_relaxed);
 }
 
 template <class ValueType, uint64_t Capacity>
@@ -65,17 +73,24 @@ inline constexpr uint64_t FiFo<ValueType, Capacity>::capacity() noexcept
 template <class ValueType, uint64_t Capacity>
 inline bool FiFo<ValueType, Capacity>::empty() const noexcept
 {
-    return m_read_pos.load(std::memory_order_relaxed) == m_write_pos.load(std::memory_order_relaxed);
+    return m_consumer->m_read_pos.load(std::memory_order_relaxed)
+           == m_producer->m_write_pos.load(std::memory_order_relaxed);
 }
 
 template <class ValueType, uint64_t Capacity>
 inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
 {
-    auto currentReadPos = m_read_pos.load(std::memory_order_relaxed);
-    bool isEmpty = (currentReadPos ==
-                    // we are not allowed to use the empty method since we have to sync with
-                    // the producer pop - this is done here
-                    m_write_pos.load(std::memory_order_acquire));
+    auto currentReadPos = m_consumer->m_read_pos.load(std::memory_order_relaxed);
+
+    // we are not allowed to use the empty method since we have to sync with
+    // the producer pop - this is done here when the cached write position is
+    // reached, the values up to the cached write position are already synced
+    if (currentReadPos == m_consumer->m_cachedWritePos)
+    {
+        m_consumer->m_cachedWritePos = m_producer->m_write_pos.load(std::memory_order_acquire);
+    }
+
+    bool isEmpty = (currentReadPos == m_consumer->m_cachedWritePos);
     if (isEmpty)
     {
         return cxx::nullopt_t();
@@ -87,10 +102,13 @@ inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
         // m_read_pos must be increased after reading the pop'ed value otherwise
         // it is possible that the pop'ed value is overwritten by push while it is read.
         // Implementing a single consumer fifo here allows us to use store.
-        m_read_pos.store(currentReadPos + 1, std::memory_order_relaxed);
+        m_consumer->m_read_pos.store(currentReadPos + 1, std::memory_order_release);
         return out;
     }
 }
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 } // namespace concurrent
 } // namespace iox
 
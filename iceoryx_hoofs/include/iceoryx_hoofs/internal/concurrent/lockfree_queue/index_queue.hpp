@@ -19,6 +19,7 @@
 #define IOX_HOOFS_LOCKFREE_QUEUE_INDEX_QUEUE_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/buffer.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/cyclic_index.hpp"
 
@@ -118,8 +119,11 @@ class IndexQueue
     ///    See, http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0883r0.pdf
     Cell m_cells[Capacity];
 
-    std::atomic<Index> m_readPosition;
-    std::atomic<Index> m_writePosition;
+    /// @brief the positions are modified by different threads, usually in different processes, and do not share a
+    /// cache line with each other or with the cells; the push does not access the read position and the pop does not
+    /// access the write position, therefore there is nothing to cache
+    CacheLineIsolated<std::atomic<Index>> m_readPosition;
+    CacheLineIsolated<std::atomic<Index>> m_writePosition;
 
     /// @brief load the value from m_cells at a position with a given memory order
     /// @param position position to load the value from
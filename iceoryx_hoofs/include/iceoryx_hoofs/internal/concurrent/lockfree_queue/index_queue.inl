@@ -71,7 +71,7 @@ void IndexQueue<Capacity, ValueType>::push(const ValueType index) noexcept
 
     constexpr bool NotPublished = true;
 
-    auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    auto writePosition = m_writePosition->load(std::memory_order_relaxed);
     do
     {
         auto oldValue = loadvalueAt(writePosition, std::memory_order_relaxed);
@@ -105,7 +105,7 @@ void IndexQueue<Capacity, ValueType>::push(const ValueType index) noexcept
             // (note that we do not care if it fails, then a retry or another push will handle it)
 
             Index newWritePosition(writePosition + 1U);
-            m_writePosition.compare_exchange_strong(
+            m_writePosition->compare_exchange_strong(
                 writePosition, newWritePosition, std::memory_order_relaxed, std::memory_order_relaxed);
         }
         else
@@ -113,7 +113,7 @@ void IndexQueue<Capacity, ValueType>::push(const ValueType index) noexcept
             // case (3) and (4)
             // note: we do not update with CAS here, the CAS is bound to fail anyway
             // (since our value of writePosition is not up to date so needs to be loaded again)
-            writePosition = m_writePosition.load(std::memory_order_relaxed);
+            writePosition = m_writePosition->load(std::memory_order_relaxed);
         }
 
     } while (NotPublished);
@@ -125,7 +125,7 @@ void IndexQueue<Capacity, ValueType>::push(const ValueType index) noexcept
     // no one else except popIfFull requires this update:
     // In this case it is also ok: the push is only complete once this update of m_writePosition was executed,
     // and the queue (logically) cannot be full until this happens.
-    m_writePosition.compare_exchange_strong(
+    m_writePosition->compare_exchange_strong(
         writePosition, newWritePosition, std::memory_order_relaxed, std::memory_order_relaxed);
 }
 
@@ -151,7 +151,7 @@ bool IndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
 
     bool ownershipGained = false;
     Index value;
-    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    auto readPosition = m_readPosition->load(std::memory_order_relaxed);
     do
     {
         value = loadvalueAt(readPosition, std::memory_order_relaxed);
@@ -163,7 +163,7 @@ bool IndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
         {
             // case (1)
             Index newReadPosition(readPosition + 1U);
-            ownershipGained = m_readPosition.compare_exchange_weak(
+            ownershipGained = m_readPosition->compare_exchange_weak(
                 readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed);
         }
         else
@@ -178,7 +178,7 @@ bool IndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
             }
 
             // case (3) and (4) requires loading readPosition again
-            readPosition = m_readPosition.load(std::memory_order_relaxed);
+            readPosition = m_readPosition->load(std::memory_order_relaxed);
         }
 
         // readPosition is outdated, retry operation
@@ -202,8 +202,8 @@ bool IndexQueue<Capacity, ValueType>::popIfFull(ValueType& index) noexcept
     // unfortunately it seems impossible in this design to check this condition without loading
     // write posiion and read position (which causes more contention)
 
-    const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
-    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = m_writePosition->load(std::memory_order_relaxed);
+    auto readPosition = m_readPosition->load(std::memory_order_relaxed);
     const auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
 
     auto isFull = writePosition.getIndex() == readPosition.getIndex() && readPosition.isOneCycleBehind(writePosition);
@@ -211,7 +211,7 @@ bool IndexQueue<Capacity, ValueType>::popIfFull(ValueType& index) noexcept
     if (isFull)
     {
         Index newReadPosition(readPosition + 1U);
-        auto ownershipGained = m_readPosition.compare_exchange_strong(
+        auto ownershipGained = m_readPosition->compare_exchange_strong(
             readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed);
 
         if (ownershipGained)
@@ -235,8 +235,8 @@ bool IndexQueue<Capacity, ValueType>::popIfSizeIsAtLeast(const uint64_t required
     // which to load first should make no difference for correctness
     // but for performance it might
     // note that without sync mechanisms (such as seq_cst), reordering is possible
-    const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
-    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = m_writePosition->load(std::memory_order_relaxed);
+    auto readPosition = m_readPosition->load(std::memory_order_relaxed);
 
     // if readPosition + n = readPosition for some n>=0, the queue contains n elements
     // at this instant (!) but slightly later may contain more or less elements
@@ -261,7 +261,7 @@ bool IndexQueue<Capacity, ValueType>::popIfSizeIsAtLeast(const uint64_t required
     {
         auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
         Index newReadPosition(readPosition + 1U);
-        auto ownershipGained = m_readPosition.compare_exchange_strong(
+        auto ownershipGained = m_readPosition->compare_exchange_strong(
             readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed);
         if (ownershipGained)
         {
@@ -309,7 +309,7 @@ cxx::optional<ValueType> IndexQueue<Capacity, ValueType>::popIfSizeIsAtLeast(con
 template <uint64_t Capacity, typename ValueType>
 bool IndexQueue<Capacity, ValueType>::empty() const noexcept
 {
-    const auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    const auto readPosition = m_readPosition->load(std::memory_order_relaxed);
     const auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
 
     // if m_readPosition is ahead by one cycle compared to the value stored at head,
@@ -89,6 +89,18 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap
+    /// @param [out] indices memory for at least maxNumberOfIndices elements to use
+    /// @param [in] maxNumberOfIndices the maximum number of elements to pop
+    /// @return the number of popped elements, which are stored at the beginning of indices
+    uint32_t popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously poped elements with a single compare-and-swap
+    /// @param [in] indices to previously poped elements
+    /// @param [in] numberOfIndices the number of elements to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in this case nothing is pushed
+    bool pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
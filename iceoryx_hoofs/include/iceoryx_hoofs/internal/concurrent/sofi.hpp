@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_CONCURRENT_SOFI_HPP
 #define IOX_HOOFS_CONCURRENT_SOFI_HPP
 
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
 #include "iceoryx_hoofs/platform/platform_correction.hpp"
 
 #include <atomic>
@@ -154,10 +155,28 @@ class SoFi
     ValueType m_data[INTERNAL_SOFI_SIZE];
     uint64_t m_size = INTERNAL_SOFI_SIZE;
 
+    /// @brief The state of the consumer. The read position is also advanced by the producer in case of an overflow.
+    /// The cached write position is a lower bound of the write position, which is only reloaded when the consumer
+    /// reaches it. This way the consumer does not need to load the cache line of the producer on every pop.
+    struct ConsumerState
+    {
+        std::atomic<uint64_t> m_readPosition{0u};
+        uint64_t m_cachedWritePosition{0u};
+    };
+
+    /// @brief The state of the producer. The cached read position is a lower bound of the read position, which is
+    /// only reloaded when the SoFi seems to be full.
+    struct ProducerState
+    {
+        std::atomic<uint64_t> m_writePosition{0u};
+        uint64_t m_cachedReadPosition{0u};
+    };
+
     /// @brief the write/read pointers are "atomic pointers" so that they are not
-    /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0u};
-    std::atomic<uint64_t> m_writePosition{0u};
+    /// reordered (read or written too late); producer and consumer are usually in different processes and do not
+    /// share a cache line
+    CacheLineIsolated<ConsumerState> m_consumer;
+    CacheLineIsolated<ProducerState> m_producer;
 };
 
 } // namespace concurrent
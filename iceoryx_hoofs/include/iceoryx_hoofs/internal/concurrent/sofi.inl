@@ -21,6 +21,11 @@ namespace iox
 {
 namespace concurrent
 {
+// suppresses the GCC 12 false positive on the unreachable nullptr path of cxx::variant::get_at_index, see fifo.inl
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#endif
 template <class ValueType, uint64_t CapacityValue>
 SoFi<ValueType, CapacityValue>::SoFi() noexcept
 {
@@ -39,10 +44,10 @@ uint64_t SoFi<ValueType, CapacityValue>::size() const noexcept
     uint64_t writePosition;
     do
     {
-        readPosition = m_readPosition.load(std::memory_order_relaxed);
-        writePosition = m_writePosition.load(std::memory_order_relaxed);
-    } while (m_writePosition.load(std::memory_order_relaxed) != writePosition
-             || m_readPosition.load(std::memory_order_relaxed) != readPosition);
+        readPosition = m_consumer->m_readPosition.load(std::memory_order_relaxed);
+        writePosition = m_producer->m_writePosition.load(std::memory_order_relaxed);
+    } while (m_producer->m_writePosition.load(std::memory_order_relaxed) != writePosition
+             || m_consumer->m_readPosition.load(std::memory_order_relaxed) != readPosition);
 
     return writePosition - readPosition;
 }
@@ -55,8 +60,10 @@ bool SoFi<ValueType, CapacityValue>::setCapacity(const uint64_t newSize) noexcep
     {
         m_size = newInternalSize;
 
-        m_readPosition.store(0u, std::memory_order_release);
-        m_writePosition.store(0u, std::memory_order_release);
+        m_consumer->m_readPosition.store(0u, std::memory_order_release);
+        m_consumer->m_cachedWritePosition = 0u;
+        m_producer->m_writePosition.store(0u, std::memory_order_release);
+        m_producer->m_cachedReadPosition = 0u;
 
         return true;
     }
@@ -74,12 +81,12 @@ bool SoFi<ValueType, CapacityValue>::empty() const noexcept
     {
         /// @todo read before write since the writer increments the aba counter!!!
         /// @todo write doc with example!!!
-        currentReadPosition = m_readPosition.load(std::memory_order_acquire);
-        uint64_t currentWritePosition = m_writePosition.load(std::memory_order_acquire);
+        currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_acquire);
+        uint64_t currentWritePosition = m_producer->m_writePosition.load(std::memory_order_acquire);
 
         isEmpty = (currentWritePosition == currentReadPosition);
         // we need compare without exchange
-    } while (!(currentReadPosition == m_readPosition.load(std::memory_order_acquire)));
+    } while (!(currentReadPosition == m_consumer->m_readPosition.load(std::memory_order_acquire)));
 
     return isEmpty;
 }
@@ -94,13 +101,20 @@ template <class ValueType, uint64_t CapacityValue>
 template <typename Verificator_T>
 inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Verificator_T& verificator) noexcept
 {
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_acquire);
     uint64_t nextReadPosition;
 
     bool popWasSuccessful{true};
     do
     {
-        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        // the data up to the cached write position was already synchronized with an acquire load, the write
+        // position only needs to be loaded when the consumer caught up with it
+        if (currentReadPosition >= m_consumer->m_cachedWritePosition)
+        {
+            m_consumer->m_cachedWritePosition = m_producer->m_writePosition.load(std::memory_order_acquire);
+        }
+
+        if (currentReadPosition >= m_consumer->m_cachedWritePosition)
         {
             nextReadPosition = currentReadPosition;
             popWasSuccessful = false;
@@ -117,7 +131,8 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
             /// @brief first we need to peak valueOut if it is fitting the condition and then we have to verify
             ///        if valueOut is not am invalid object, this could be the case if the read position has
             ///        changed
-            if (m_readPosition.load(std::memory_order_relaxed) == currentReadPosition && verificator(valueOut) == false)
+            if (m_consumer->m_readPosition.load(std::memory_order_relaxed) == currentReadPosition
+                && verificator(valueOut) == false)
             {
                 popWasSuccessful = false;
                 nextReadPosition = currentReadPosition;
@@ -135,7 +150,7 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
         // else
         //     currentReadPosition = m_readPosition
         // Assign m_aba_read_p to next readable location
-    } while (!m_readPosition.compare_exchange_weak(
+    } while (!m_consumer->m_readPosition.compare_exchange_weak(
         currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
 
     return popWasSuccessful;
@@ -146,13 +161,22 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueOut, ValueType&
 {
     constexpr bool SOFI_OVERFLOW{false};
 
-    uint64_t currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    uint64_t currentWritePosition = m_producer->m_writePosition.load(std::memory_order_relaxed);
     uint64_t nextWritePosition = currentWritePosition + 1U;
 
     m_data[currentWritePosition % m_size] = valueOut;
-    m_writePosition.store(nextWritePosition, std::memory_order_release);
+    m_producer->m_writePosition.store(nextWritePosition, std::memory_order_release);
+
+    // the read position only grows, if there is a free position for the next push with the cached read position,
+    // there is also one with the current read position; the cached read position was obtained with an acquire load,
+    // therefore the consumer finished reading the free position
+    if (nextWritePosition < m_producer->m_cachedReadPosition + m_size)
+    {
+        return !SOFI_OVERFLOW;
+    }
 
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_acquire);
+    m_producer->m_cachedReadPosition = currentReadPosition;
 
     // check if there is a free position for the next push
     if (nextWritePosition < currentReadPosition + m_size)
@@ -179,16 +203,19 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueOut, ValueType&
     //     synchronization, then the memory also needs to be synchronized for the overflow case
     // memory order failure is memory_order_relaxed since there is no further synchronization needed if there is no
     // overflow
-    if (m_readPosition.compare_exchange_strong(
+    if (m_consumer->m_readPosition.compare_exchange_strong(
             currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_relaxed))
     {
         std::memcpy(&f_paramOut_r, &m_data[currentReadPosition % m_size], sizeof(ValueType));
+        m_producer->m_cachedReadPosition = nextReadPosition;
         return SOFI_OVERFLOW;
     }
 
     return !SOFI_OVERFLOW;
 }
-
+#if defined(__GNUC__) && (__GNUC__ >= 7) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 
 } // namespace concurrent
 } // namespace iox
@@ -0,0 +1,161 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_SPSC_QUEUE_HPP
+#define IOX_HOOFS_CONCURRENT_SPSC_QUEUE_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief the behavior of the SpscQueue when a value is pushed into a full queue
+enum class SpscQueueOverflowPolicy : uint8_t
+{
+    /// @brief the pushed value is rejected and returned to the producer, like the FiFo
+    REJECT_NEW_VALUE,
+    /// @brief the oldest value is removed and returned to the producer, the pushed value is stored, like the SoFi
+    DISCARD_OLDEST_VALUE
+};
+
+/// @brief Bounded single producer single consumer queue which combines the FiFo and the SoFi without the runtime
+/// dispatch of the VariantQueue, the overflow policy is a constant which is set on construction.
+///
+/// The positions of producer and consumer are monotonic 64 bit counters in separate cache lines. Each side caches
+/// the last observed position of the other side and only reloads it when the queue seems to be full or empty,
+/// therefore a push or pop usually touches only the cache line of its own side and the slot.
+///
+/// Progress guarantees:
+///     - push is wait-free for both policies, it uses at most one compare and swap without retry
+///     - pop is wait-free with REJECT_NEW_VALUE
+///     - pop is lock-free with DISCARD_OLDEST_VALUE, the compare and swap of the read position only fails when the
+///       producer discarded the value which should be popped, which requires an overflow for every retry
+///
+/// The slots are accessed with relaxed atomics, therefore a value which is discarded by the producer while the
+/// consumer reads it is never torn. The consumer detects this case with the failed compare and swap of the read
+/// position and reads the next value.
+///
+/// @param[in] ValueType type of the values, must be trivially copyable and not larger than 64 bit
+/// @param[in] Capacity maximum capacity of the queue
+/// @code
+///     SpscQueue<uint64_t, 4> queue(SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE);
+///
+///     auto discardedValue = queue.push(42U);
+///     if (discardedValue.has_value())
+///     {
+///         std::cout << "the oldest value " << *discardedValue << " was discarded" << std::endl;
+///     }
+///
+///     auto value = queue.pop();
+/// @endcode
+template <typename ValueType, uint64_t Capacity>
+class SpscQueue
+{
+    static_assert(std::is_trivially_copyable<ValueType>::value,
+                  "SpscQueue can handle only trivially copyable data types");
+    static_assert(sizeof(ValueType) <= sizeof(uint64_t), "SpscQueue requires values which can be accessed atomically");
+    static_assert(Capacity > 0U, "SpscQueue requires a capacity larger than zero");
+
+  public:
+    /// @brief creates an empty queue with the maximum capacity
+    /// @param[in] overflowPolicy the behavior when a value is pushed into a full queue
+    explicit SpscQueue(const SpscQueueOverflowPolicy overflowPolicy) noexcept;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+    ~SpscQueue() noexcept = default;
+
+    /// @brief pushes a value into the queue
+    /// @param[in] value the value which should be pushed
+    /// @return if the queue is full the optional contains the value which was dropped, the pushed value for
+    ///         REJECT_NEW_VALUE and the oldest value for DISCARD_OLDEST_VALUE, otherwise it contains nullopt
+    /// @concurrent restricted thread safe: single producer
+    cxx::optional<ValueType> push(const ValueType& value) noexcept;
+
+    /// @brief removes the oldest value from the queue
+    /// @return the oldest value if the queue was not empty, otherwise nullopt
+    /// @concurrent restricted thread safe: single consumer
+    cxx::optional<ValueType> pop() noexcept;
+
+    /// @brief returns true if the queue is empty, otherwise false; another thread can change the state right after
+    /// the call
+    bool empty() const noexcept;
+
+    /// @brief returns the number of values in the queue; another thread can change the size right after the call
+    uint64_t size() const noexcept;
+
+    /// @brief sets the capacity of the queue
+    /// @param[in] newCapacity valid values are 0 < newCapacity <= Capacity
+    /// @return true if the capacity was changed, false if the new capacity is invalid or the queue is not empty
+    /// @pre no concurrent push or pop calls
+    /// @concurrent not thread safe
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+    /// @brief returns the current capacity of the queue
+    uint64_t capacity() const noexcept;
+
+    /// @brief returns the overflow policy of the queue
+    SpscQueueOverflowPolicy overflowPolicy() const noexcept;
+
+  private:
+    /// @brief the state of the producer; the write index is the slot of the write position, this avoids a division
+    /// on every push
+    struct ProducerState
+    {
+        std::atomic<uint64_t> m_writePosition{0U};
+        uint64_t m_writeIndex{0U};
+        uint64_t m_cachedReadPosition{0U};
+    };
+
+    /// @brief the state of the consumer; the read index is the slot of the indexed read position, which is the read
+    /// position unless the producer discarded values
+    struct ConsumerState
+    {
+        std::atomic<uint64_t> m_readPosition{0U};
+        uint64_t m_indexedReadPosition{0U};
+        uint64_t m_readIndex{0U};
+        uint64_t m_cachedWritePosition{0U};
+    };
+
+    void store(const uint64_t index, const ValueType& value) noexcept;
+    ValueType load(const uint64_t index) const noexcept;
+    uint64_t nextIndex(const uint64_t index) const noexcept;
+    uint64_t readIndexOf(const uint64_t readPosition) const noexcept;
+    bool isFull(const uint64_t writePosition, const uint64_t readPosition) const noexcept;
+    cxx::optional<ValueType> discardOldestAndPush(const uint64_t writePosition, const ValueType& value) noexcept;
+
+  private:
+    const SpscQueueOverflowPolicy m_overflowPolicy;
+    uint64_t m_capacity{Capacity};
+    std::atomic<ValueType> m_data[Capacity];
+    // producer and consumer are usually in different processes and do not share a cache line
+    CacheLineIsolated<ProducerState> m_producer;
+    CacheLineIsolated<ConsumerState> m_consumer;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_queue.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_SPSC_QUEUE_HPP
@@ -0,0 +1,214 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_SPSC_QUEUE_INL
+#define IOX_HOOFS_CONCURRENT_SPSC_QUEUE_INL
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_queue.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ValueType, uint64_t Capacity>
+inline SpscQueue<ValueType, Capacity>::SpscQueue(const SpscQueueOverflowPolicy overflowPolicy) noexcept
+    : m_overflowPolicy(overflowPolicy)
+{
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline void SpscQueue<ValueType, Capacity>::store(const uint64_t index, const ValueType& value) noexcept
+{
+    // relaxed is sufficient, the value is published with the release store of the write position
+    m_data[index].store(value, std::memory_order_relaxed);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline ValueType SpscQueue<ValueType, Capacity>::load(const uint64_t index) const noexcept
+{
+    return m_data[index].load(std::memory_order_relaxed);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t SpscQueue<ValueType, Capacity>::nextIndex(const uint64_t index) const noexcept
+{
+    return (index + 1U == m_capacity) ? 0U : index + 1U;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t SpscQueue<ValueType, Capacity>::readIndexOf(const uint64_t readPosition) const noexcept
+{
+    // the read position only differs from the indexed one when the producer discarded values
+    return (readPosition == m_consumer->m_indexedReadPosition) ? m_consumer->m_readIndex : readPosition % m_capacity;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline bool SpscQueue<ValueType, Capacity>::isFull(const uint64_t writePosition,
+                                                   const uint64_t readPosition) const noexcept
+{
+    return writePosition - readPosition >= m_capacity;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline cxx::optional<ValueType> SpscQueue<ValueType, Capacity>::push(const ValueType& value) noexcept
+{
+    const uint64_t currentWritePosition = m_producer->m_writePosition.load(std::memory_order_relaxed);
+
+    // the read position only grows, therefore it is sufficient to load it when the queue seems to be full with the
+    // cached read position; the acquire ensures that the popped value was read before the slot is overwritten
+    if (isFull(currentWritePosition, m_producer->m_cachedReadPosition))
+    {
+        m_producer->m_cachedReadPosition = m_consumer->m_readPosition.load(std::memory_order_acquire);
+        if (isFull(currentWritePosition, m_producer->m_cachedReadPosition))
+        {
+            if (m_overflowPolicy == SpscQueueOverflowPolicy::REJECT_NEW_VALUE)
+            {
+                return cxx::make_optional<ValueType>(value);
+            }
+            return discardOldestAndPush(currentWritePosition, value);
+        }
+    }
+
+    store(m_producer->m_writeIndex, value);
+    m_producer->m_writeIndex = nextIndex(m_producer->m_writeIndex);
+    m_producer->m_writePosition.store(currentWritePosition + 1U, std::memory_order_release);
+    return cxx::nullopt;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline cxx::optional<ValueType>
+SpscQueue<ValueType, Capacity>::discardOldestAndPush(const uint64_t writePosition, const ValueType& value) noexcept
+{
+    // the producer competes with the consumer for the oldest value, the winner of the compare and swap owns it; when
+    // the consumer won, the acquire on failure ensures that it finished reading the slot before it is reused
+    uint64_t oldestPosition = m_producer->m_cachedReadPosition;
+    const bool hasDiscardedOldest = m_consumer->m_readPosition.compare_exchange_strong(
+        oldestPosition, oldestPosition + 1U, std::memory_order_acq_rel, std::memory_order_acquire);
+    m_producer->m_cachedReadPosition = (hasDiscardedOldest) ? oldestPosition + 1U : oldestPosition;
+
+    // the queue is full, therefore the slot of the write position is the slot of the oldest value; when the
+    // consumer won, it popped the oldest value and freed the slot
+    const uint64_t index = m_producer->m_writeIndex;
+    cxx::optional<ValueType> discardedValue;
+    if (hasDiscardedOldest)
+    {
+        discardedValue.emplace(load(index));
+    }
+
+    store(index, value);
+    m_producer->m_writeIndex = nextIndex(index);
+    m_producer->m_writePosition.store(writePosition + 1U, std::memory_order_release);
+    return discardedValue;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline cxx::optional<ValueType> SpscQueue<ValueType, Capacity>::pop() noexcept
+{
+    uint64_t currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        // the values up to the cached write position are already synchronized with an acquire load, the write
+        // position only needs to be loaded when the consumer caught up with it
+        if (currentReadPosition >= m_consumer->m_cachedWritePosition)
+        {
+            m_consumer->m_cachedWritePosition = m_producer->m_writePosition.load(std::memory_order_acquire);
+            if (currentReadPosition >= m_consumer->m_cachedWritePosition)
+            {
+                return cxx::nullopt;
+            }
+        }
+
+        const uint64_t index = readIndexOf(currentReadPosition);
+        const ValueType value = load(index);
+
+        if (m_overflowPolicy == SpscQueueOverflowPolicy::REJECT_NEW_VALUE)
+        {
+            // only the consumer modifies the read position, the release ensures that the value was read before the
+            // producer overwrites the slot
+            m_consumer->m_readPosition.store(currentReadPosition + 1U, std::memory_order_release);
+        }
+        // a failed compare and swap means that the producer discarded the value, it loads the new read position and
+        // the next value is read
+        else if (!m_consumer->m_readPosition.compare_exchange_strong(currentReadPosition,
+                                                                      currentReadPosition + 1U,
+                                                                      std::memory_order_acq_rel,
+                                                                      std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        m_consumer->m_indexedReadPosition = currentReadPosition + 1U;
+        m_consumer->m_readIndex = nextIndex(index);
+        return value;
+    }
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline bool SpscQueue<ValueType, Capacity>::empty() const noexcept
+{
+    // the read position is loaded first, it never overtakes the write position
+    const uint64_t currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_relaxed);
+    return currentReadPosition == m_producer->m_writePosition.load(std::memory_order_relaxed);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t SpscQueue<ValueType, Capacity>::size() const noexcept
+{
+    // the read position is loaded first, it never overtakes the write position; the producer may have pushed in
+    // between therefore the difference is limited to the capacity
+    const uint64_t currentReadPosition = m_consumer->m_readPosition.load(std::memory_order_relaxed);
+    const uint64_t currentWritePosition = m_producer->m_writePosition.load(std::memory_order_relaxed);
+    const uint64_t currentSize = currentWritePosition - currentReadPosition;
+    return (currentSize < m_capacity) ? currentSize : m_capacity;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline bool SpscQueue<ValueType, Capacity>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    if (newCapacity == 0U || newCapacity > Capacity || !empty())
+    {
+        return false;
+    }
+
+    m_capacity = newCapacity;
+
+    m_producer->m_writePosition.store(0U, std::memory_order_relaxed);
+    m_producer->m_writeIndex = 0U;
+    m_producer->m_cachedReadPosition = 0U;
+    m_consumer->m_readPosition.store(0U, std::memory_order_relaxed);
+    m_consumer->m_indexedReadPosition = 0U;
+    m_consumer->m_readIndex = 0U;
+    m_consumer->m_cachedWritePosition = 0U;
+
+    return true;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t SpscQueue<ValueType, Capacity>::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline SpscQueueOverflowPolicy SpscQueue<ValueType, Capacity>::overflowPolicy() const noexcept
+{
+    return m_overflowPolicy;
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_SPSC_QUEUE_INL
@@ -0,0 +1,94 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_NUMA_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_NUMA_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief the memory is not bound to a NUMA node and the default policy of the system applies
+constexpr uint32_t ANY_NUMA_NODE = std::numeric_limits<uint32_t>::max();
+constexpr uint32_t MAX_NUMBER_OF_NUMA_NODES = 64U;
+constexpr uint32_t MAX_NUMBER_OF_CPUS = 1024U;
+
+enum class NumaError
+{
+    INVALID_STATE,
+    NOT_SUPPORTED,
+    NODE_NOT_AVAILABLE,
+    BINDING_FAILED
+};
+
+/// @brief The NUMA nodes of the system and the CPUs which belong to them, read from the sysfs. A system without NUMA
+/// support has no nodes. Tests can provide a fake topology by pointing to a directory with the same layout, i.e. an
+/// 'online' file with the node list and a 'node<N>/cpulist' file per node.
+class NumaTopology
+{
+  public:
+    static constexpr const char SYSFS_NODE_PATH[] = "/sys/devices/system/node";
+    using Path_t = cxx::string<256U>;
+
+    /// @brief reads the topology
+    /// @param[in] sysfsNodePath the directory with the node information
+    explicit NumaTopology(const Path_t& sysfsNodePath = Path_t(SYSFS_NODE_PATH)) noexcept;
+
+    /// @brief returns the number of online NUMA nodes, 0 if the system has no NUMA support
+    uint32_t numberOfNodes() const noexcept;
+
+    /// @brief returns true if the node is online
+    bool hasNode(const uint32_t node) const noexcept;
+
+    /// @brief returns the NUMA node of a CPU or nullopt when the CPU is unknown
+    cxx::optional<uint32_t> nodeOfCpu(const uint32_t cpu) const noexcept;
+
+    /// @brief returns the NUMA node of the CPU the calling thread is currently running on or nullopt when it cannot
+    /// be determined. The thread may be migrated to another node afterwards unless it is pinned.
+    cxx::optional<uint32_t> nodeOfCurrentCpu() const noexcept;
+
+  private:
+    cxx::vector<uint32_t, MAX_NUMBER_OF_NUMA_NODES> m_nodes;
+    /// @brief the node of every CPU, indexed by the CPU number; ANY_NUMA_NODE for CPUs without a node
+    cxx::vector<uint32_t, MAX_NUMBER_OF_CPUS> m_nodeOfCpu;
+};
+
+/// @brief Binds the memory to a NUMA node with a preferred policy, i.e. pages which are faulted in afterwards are
+/// allocated on this node as long as it has free memory and on another node otherwise. Pages which were already
+/// touched are not moved. For a shared memory the policy is stored with the shared memory object and therefore also
+/// applies to the pages faulted in by other processes.
+/// @param[in] address the page aligned start address of the memory
+/// @param[in] size the size of the memory in bytes
+/// @param[in] node the NUMA node
+/// @param[in] topology used to verify that the node is available
+/// @return NumaError::NODE_NOT_AVAILABLE if the topology does not have the node, NumaError::NOT_SUPPORTED if the
+/// platform has no NUMA support and NumaError::BINDING_FAILED if the kernel rejects the policy
+cxx::expected<NumaError> bindMemoryToNumaNode(void* const address,
+                                              const uint64_t size,
+                                              const uint32_t node,
+                                              const NumaTopology& topology = NumaTopology()) noexcept;
+
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_NUMA_HPP
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/design_pattern/creation.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/numa.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
@@ -37,6 +38,38 @@ enum class SharedMemoryObjectError
     INVALID_STATE,
     SHARED_MEMORY_CREATION_FAILED,
     MAPPING_SHARED_MEMORY_FAILED,
+    INSUFFICIENT_MEMORY,
+};
+
+/// @brief Defines how the creator of a shared memory ensures that the memory is zeroed and that the system has
+/// enough memory for all its pages
+enum class ZeroInitialization : uint8_t
+{
+    /// @brief the creating thread sets every byte to zero, a lack of memory terminates the process with SIGBUS
+    MEMSET,
+    /// @brief like MEMSET but multiple threads set the memory to zero, which speeds up the creation of large shared
+    /// memories on multi-core systems
+    PARALLEL_MEMSET,
+    /// @brief a freshly created shared memory is already zero-filled by the kernel, therefore the memory is only
+    /// reserved which fails with SharedMemoryObjectError::INSUFFICIENT_MEMORY when the system lacks memory. The
+    /// pages are faulted in on the first access. Falls back to MEMSET when the reservation is not supported.
+    SKIP
+};
+
+/// @brief Options for the mapping of the shared memory which avoid page faults and TLB misses on the accesses. Every
+/// process which maps the shared memory has to use the same page type. The zero initialization is only done by the
+/// creator of the shared memory.
+struct MappingOptions
+{
+    PageType pageType{PageType::DEFAULT};
+    /// @brief fault in all pages when the memory is mapped instead of on the first access
+    bool prefault{false};
+    /// @brief lock the pages into RAM so that they are never swapped out, requires a sufficient RLIMIT_MEMLOCK
+    bool lockInMemory{false};
+    ZeroInitialization zeroInitialization{ZeroInitialization::MEMSET};
+    /// @brief the NUMA node on which the pages of the shared memory are preferably allocated, the creator sets the
+    /// policy before the memory is touched the first time and every other process inherits it
+    uint32_t numaNode{ANY_NUMA_NODE};
 };
 
 class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>
@@ -66,9 +99,13 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
                        const AccessMode accessMode,
                        const OwnerShip ownerShip,
                        const void* baseAddressHint,
-                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                       const MappingOptions& mappingOptions = MappingOptions());
 
     bool isInitialized() const;
+    void applyMappingOptions(const MappingOptions& mappingOptions) noexcept;
+    bool reserveMemory() noexcept;
+    void setMemoryToZero(const ZeroInitialization zeroInitialization) noexcept;
 
   private:
     uint64_t m_memorySizeInBytes;
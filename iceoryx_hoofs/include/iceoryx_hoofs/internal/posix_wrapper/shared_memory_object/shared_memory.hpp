@@ -43,6 +43,40 @@ enum class OwnerShip : uint64_t
 };
 static constexpr const char* OWNERSHIP_STRING[] = {"OwnerShip::MINE", "OwnerShip::OPEN_EXISTING"};
 
+/// @brief The pages which back the shared memory. Huge pages reduce the TLB misses when large memory regions are
+/// accessed. Explicit huge pages require a hugetlbfs mounted at HUGE_PAGES_2MB_MOUNT_POINT, respectively
+/// HUGE_PAGES_1GB_MOUNT_POINT, with enough reserved huge pages.
+enum class PageType : uint64_t
+{
+    DEFAULT = 0U,
+    /// @brief transparent huge pages are requested via madvise, the kernel falls back to the default pages if none
+    /// are available
+    TRANSPARENT_HUGE_PAGES = 1U,
+    HUGE_PAGES_2MB = 2U,
+    HUGE_PAGES_1GB = 3U
+};
+static constexpr const char* PAGE_TYPE_STRING[] = {"PageType::DEFAULT",
+                                                   "PageType::TRANSPARENT_HUGE_PAGES",
+                                                   "PageType::HUGE_PAGES_2MB",
+                                                   "PageType::HUGE_PAGES_1GB"};
+
+constexpr char HUGE_PAGES_2MB_MOUNT_POINT[] = "/dev/hugepages";
+constexpr char HUGE_PAGES_1GB_MOUNT_POINT[] = "/dev/hugepages1G";
+
+/// @brief returns the size of the explicit huge pages, 0 for the page types whose size is defined by the system
+constexpr uint64_t hugePageSize(const PageType pageType) noexcept
+{
+    if (pageType == PageType::HUGE_PAGES_2MB)
+    {
+        return 2U * 1024U * 1024U;
+    }
+    if (pageType == PageType::HUGE_PAGES_1GB)
+    {
+        return 1024U * 1024U * 1024U;
+    }
+    return 0U;
+}
+
 enum class SharedMemoryError
 {
     INVALID_STATE,
@@ -68,6 +102,7 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
   public:
     static constexpr uint64_t NAME_SIZE = 128U;
     using Name_t = cxx::string<NAME_SIZE>;
+    using Path_t = cxx::string<NAME_SIZE + sizeof(HUGE_PAGES_1GB_MOUNT_POINT)>;
 
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory& operator=(const SharedMemory&) = delete;
@@ -84,9 +119,13 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
                  const AccessMode accessMode,
                  const OwnerShip ownerShip,
                  const mode_t permissions,
-                 const uint64_t size) noexcept;
+                 const uint64_t size,
+                 const PageType pageType = PageType::DEFAULT) noexcept;
 
     bool open(const int oflags, const mode_t permissions, const uint64_t size) noexcept;
+    /// @brief explicit huge pages are backed by a file in a hugetlbfs instead of a POSIX shared memory
+    bool isBackedByHugeTlbFs() const noexcept;
+    Path_t hugeTlbFsPath() const noexcept;
     bool unlink() noexcept;
     bool close() noexcept;
     void destroy() noexcept;
@@ -97,6 +136,7 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
 
     Name_t m_name;
     OwnerShip m_ownerShip;
+    PageType m_pageType{PageType::DEFAULT};
     int m_handle{-1};
 };
 } // namespace posix
@@ -19,9 +19,12 @@
 #define IOX_HOOFS_RELOCATABLE_POINTER_POINTER_REPOSITORY_HPP
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
-#include <iostream>
 
 #include <assert.h>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
 
 namespace iox
 {
@@ -32,6 +35,8 @@ namespace rp
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// The segments are additionally indexed by their start address, so that the segment which contains a pointer is found
+/// with a binary search. The registration is thread-safe and the search can be done concurrently to it.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = 10000U>
 class PointerRepository
 {
@@ -39,7 +44,18 @@ class PointerRepository
     struct Info
     {
         ptr_t basePtr{nullptr};
-        ptr_t endPtr{nullptr};
+    };
+
+    /// @brief a registered segment in the index sorted by the start address; the members are atomics since the
+    /// search reads them while a registration may modify them, a torn result is discarded via the sequence number
+    struct IndexEntry
+    {
+        std::atomic<uintptr_t> begin;
+        std::atomic<uintptr_t> end;
+        /// @brief the maximum end address of this and all preceding entries, it bounds the search for overlapping
+        /// segments
+        std::atomic<uintptr_t> maxEnd;
+        std::atomic<id_t> id;
     };
 
     /// @note 0 is a special purpose id and reserved
@@ -96,14 +112,28 @@ class PointerRepository
     void print() const noexcept;
 
   private:
-    /// @todo: if required protect vector against concurrent modification
-    /// whether this is required depends on the use case, we currently do not need it
+    bool registerPtrUnsafe(id_t id, ptr_t ptr, uint64_t size) noexcept;
+
+    id_t searchIdInIndex(const uintptr_t address) const noexcept;
+    void addToIndex(id_t id, ptr_t ptr, uint64_t size) noexcept;
+    void removeFromIndex(id_t id) noexcept;
+    void moveIndexEntry(const uint64_t from, const uint64_t to) noexcept;
+    void updateMaxEnd(const uint64_t fromPosition) noexcept;
+
+    /// @brief a seqlock, the sequence number is odd while the index is modified
+    void beginIndexModification() noexcept;
+    void endIndexModification() noexcept;
+
+  private:
     /// we control the ids, so if they are consecutive we only need a vector/array to get the address
     /// this variable exists once per application using relative pointers,
     /// and each needs to initialize it via register calls above
-
     iox::cxx::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+
+    std::mutex m_registrationMutex;
+    std::atomic<uint64_t> m_indexSequenceNumber{0U};
+    std::atomic<uint64_t> m_indexSize{0U};
+    IndexEntry m_index[CAPACITY];
 };
 
 } // namespace rp
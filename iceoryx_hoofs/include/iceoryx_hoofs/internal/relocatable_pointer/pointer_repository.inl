@@ -33,36 +33,18 @@ inline PointerRepository<id_t, ptr_t, CAPACITY>::PointerRepository() noexcept
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(id_t id, ptr_t ptr, uint64_t size) noexcept
 {
-    if (id > MAX_ID)
-    {
-        return false;
-    }
-    if (m_info[id].basePtr == nullptr)
-    {
-        m_info[id].basePtr = ptr;
-        m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-        if (id > m_maxRegistered)
-        {
-            m_maxRegistered = id;
-        }
-        return true;
-    }
-    return false;
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
+    return registerPtrUnsafe(id, ptr, size);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(const ptr_t ptr, uint64_t size) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
     for (id_t id = 1U; id <= MAX_ID; ++id)
     {
-        if (m_info[id].basePtr == nullptr)
+        if (registerPtrUnsafe(id, ptr, size))
         {
-            m_info[id].basePtr = ptr;
-            m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-            if (id > m_maxRegistered)
-            {
-                m_maxRegistered = id;
-            }
             return id;
         }
     }
@@ -70,16 +52,32 @@ inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(const ptr_t pt
     return INVALID_ID;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtrUnsafe(id_t id, ptr_t ptr, uint64_t size) noexcept
+{
+    if (id > MAX_ID)
+    {
+        return false;
+    }
+    if (m_info[id].basePtr == nullptr)
+    {
+        m_info[id].basePtr = ptr;
+        addToIndex(id, ptr, size);
+        return true;
+    }
+    return false;
+}
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
     if (id <= MAX_ID && id >= MIN_ID)
     {
         if (m_info[id].basePtr != nullptr)
         {
             m_info[id].basePtr = nullptr;
-
-            /// @note do not search for next lower registered index but we could do it here
+            removeFromIndex(id);
             return true;
         }
     }
@@ -90,11 +88,15 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noe
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
     for (auto& info : m_info)
     {
         info.basePtr = nullptr;
     }
-    m_maxRegistered = 0U;
+
+    beginIndexModification();
+    m_indexSize.store(0U, std::memory_order_relaxed);
+    endIndexModification();
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -115,20 +117,156 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
 {
-    for (id_t id = 1U; id <= m_maxRegistered; ++id)
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    while (true)
     {
-        // return first id where the ptr is in the corresponding interval
-        if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+        const auto sequenceNumber = m_indexSequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumber % 2U == 0U)
         {
-            return id;
+            const auto id = searchIdInIndex(address);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_indexSequenceNumber.load(std::memory_order_relaxed) == sequenceNumber)
+            {
+                return id;
+            }
         }
     }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchIdInIndex(const uintptr_t address) const noexcept
+{
+    // the index is only consistent when the sequence number did not change during the search, nevertheless the
+    // search must stay within the bounds and terminate for every intermediate state
+    auto size = m_indexSize.load(std::memory_order_relaxed);
+    size = (size > CAPACITY) ? CAPACITY : size;
+
+    // find the first entry which starts behind the address
+    uint64_t low{0U};
+    uint64_t high{size};
+    while (low < high)
+    {
+        const uint64_t middle = low + (high - low) / 2U;
+        if (m_index[middle].begin.load(std::memory_order_relaxed) <= address)
+        {
+            low = middle + 1U;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    // all entries in front of it start at or before the address; without overlapping segments only the last of them
+    // can contain the address, otherwise the lowest id of the containing segments is returned
+    id_t foundId{0U};
+    for (uint64_t position = low; position > 0U; --position)
+    {
+        const auto& entry = m_index[position - 1U];
+        if (entry.maxEnd.load(std::memory_order_relaxed) < address)
+        {
+            break;
+        }
+        if (address <= entry.end.load(std::memory_order_relaxed))
+        {
+            const auto id = entry.id.load(std::memory_order_relaxed);
+            foundId = (foundId == 0U || id < foundId) ? id : foundId;
+        }
+    }
+
     /// @note implicitly interpret the pointer as a regular pointer if not found
     /// by setting id to 0
     /// rationale: test cases work without registered shared memory and require
     /// this at the moment to avoid fundamental changes
-    return 0U;
-    // return INVALID_ID;
+    return foundId;
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addToIndex(id_t id, ptr_t ptr, uint64_t size) noexcept
+{
+    // an empty segment contains no pointer and the reserved id is never searched for
+    if (size == 0U || id < MIN_ID)
+    {
+        return;
+    }
+
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    const auto indexSize = m_indexSize.load(std::memory_order_relaxed);
+
+    uint64_t position{indexSize};
+    while (position > 0U && m_index[position - 1U].begin.load(std::memory_order_relaxed) > begin)
+    {
+        --position;
+    }
+
+    beginIndexModification();
+    for (uint64_t i = indexSize; i > position; --i)
+    {
+        moveIndexEntry(i - 1U, i);
+    }
+    m_index[position].begin.store(begin, std::memory_order_relaxed);
+    m_index[position].end.store(begin + size - 1U, std::memory_order_relaxed);
+    m_index[position].id.store(id, std::memory_order_relaxed);
+    m_indexSize.store(indexSize + 1U, std::memory_order_relaxed);
+    updateMaxEnd(position);
+    endIndexModification();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromIndex(id_t id) noexcept
+{
+    const auto indexSize = m_indexSize.load(std::memory_order_relaxed);
+    for (uint64_t position = 0U; position < indexSize; ++position)
+    {
+        if (m_index[position].id.load(std::memory_order_relaxed) == id)
+        {
+            beginIndexModification();
+            for (uint64_t i = position + 1U; i < indexSize; ++i)
+            {
+                moveIndexEntry(i, i - 1U);
+            }
+            m_indexSize.store(indexSize - 1U, std::memory_order_relaxed);
+            updateMaxEnd(position);
+            endIndexModification();
+            return;
+        }
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::moveIndexEntry(const uint64_t from, const uint64_t to) noexcept
+{
+    m_index[to].begin.store(m_index[from].begin.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_index[to].end.store(m_index[from].end.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_index[to].id.store(m_index[from].id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::updateMaxEnd(const uint64_t fromPosition) noexcept
+{
+    const auto indexSize = m_indexSize.load(std::memory_order_relaxed);
+    uintptr_t maxEnd = (fromPosition == 0U) ? 0U : m_index[fromPosition - 1U].maxEnd.load(std::memory_order_relaxed);
+    for (uint64_t position = fromPosition; position < indexSize; ++position)
+    {
+        const auto end = m_index[position].end.load(std::memory_order_relaxed);
+        maxEnd = (end > maxEnd) ? end : maxEnd;
+        m_index[position].maxEnd.store(maxEnd, std::memory_order_relaxed);
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::beginIndexModification() noexcept
+{
+    m_indexSequenceNumber.store(m_indexSequenceNumber.load(std::memory_order_relaxed) + 1U,
+                                std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::endIndexModification() noexcept
+{
+    m_indexSequenceNumber.store(m_indexSequenceNumber.load(std::memory_order_relaxed) + 1U,
+                                std::memory_order_release);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
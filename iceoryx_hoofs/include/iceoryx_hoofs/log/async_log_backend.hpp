@@ -0,0 +1,131 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+#define IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/log/logcommon.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief Moves the formatting and printing of log messages off the logging thread. While an AsyncLogBackend
+/// exists, every Logger hands its enabled log entries over to a lock-free queue and a dedicated thread formats and
+/// prints them. Without an AsyncLogBackend the loggers print synchronously, which is still the default.
+///
+/// Repeating messages are rate limited, at most MAX_REPETITIONS of each message are printed within its
+/// RATE_LIMIT_WINDOW. The last NUMBER_OF_RATE_LIMITED_MESSAGES distinct messages are tracked, this way also
+/// interleaved messages are limited. When the queue is full the message is dropped. Both the suppressed and the dropped messages are
+/// counted and reported by the logging thread. Messages longer than MAX_MESSAGE_LENGTH are truncated. Fatal messages
+/// are always printed synchronously since the application is about to terminate.
+/// @code
+/// int main()
+/// {
+///     // all log messages of the application are printed asynchronously until the end of main
+///     iox::log::AsyncLogBackend asyncLogBackend;
+///     ...
+/// }
+/// @endcode
+/// @note only one AsyncLogBackend can be active at a time, a second one stays inactive
+class AsyncLogBackend
+{
+  public:
+    static constexpr uint64_t MAX_MESSAGE_LENGTH{256U};
+    static constexpr uint64_t QUEUE_CAPACITY{256U};
+    static constexpr uint64_t MAX_REPETITIONS{10U};
+    static constexpr std::chrono::milliseconds RATE_LIMIT_WINDOW{1000};
+    static constexpr uint64_t NUMBER_OF_RATE_LIMITED_MESSAGES{8U};
+
+    /// @brief starts the logging thread and makes this the active backend of all loggers
+    AsyncLogBackend() noexcept;
+
+    /// @brief hands the logging back to the loggers, prints all pending messages and stops the logging thread
+    ~AsyncLogBackend() noexcept;
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend(AsyncLogBackend&&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(AsyncLogBackend&&) = delete;
+
+    /// @brief returns true when this is the backend which receives the log messages
+    bool isActive() const noexcept;
+
+    /// @brief returns the number of messages which were dropped since the queue was full
+    uint64_t numberOfDroppedMessages() const noexcept;
+
+    /// @brief returns the number of messages which were suppressed by the rate limiter
+    uint64_t numberOfSuppressedMessages() const noexcept;
+
+    /// @brief hands a log entry over to the active backend, this is lock-free
+    /// @param[in] entry the log entry to print
+    /// @return false when there is no active backend and the caller has to print the entry by itself
+    static bool tryLog(const LogEntry& entry) noexcept;
+
+  private:
+    struct LogRecord
+    {
+        LogLevel level{LogLevel::kVerbose};
+        std::chrono::milliseconds time{0};
+        cxx::string<MAX_MESSAGE_LENGTH> message;
+    };
+
+    struct RateLimitEntry
+    {
+        std::atomic<uint64_t> messageHash{0U};
+        std::atomic<int64_t> windowStart{0};
+        std::atomic<uint64_t> numberOfRepetitions{0U};
+    };
+
+    void log(const LogEntry& entry) noexcept;
+    bool isRateLimited(const LogEntry& entry) noexcept;
+    void run() noexcept;
+    void printPendingRecords() noexcept;
+    void printSummary() noexcept;
+
+  private:
+    static std::atomic<AsyncLogBackend*> s_activeBackend;
+    static std::atomic<uint64_t> s_numberOfActiveProducers;
+
+    concurrent::LockFreeQueue<LogRecord, QUEUE_CAPACITY> m_records;
+    posix::Semaphore m_newRecords{posix::Semaphore::create(posix::CreateUnnamedSingleProcessSemaphore, 0U).value()};
+
+    std::atomic<uint64_t> m_numberOfDroppedMessages{0U};
+    std::atomic<uint64_t> m_numberOfSuppressedMessages{0U};
+    uint64_t m_numberOfReportedDroppedMessages{0U};
+    uint64_t m_numberOfReportedSuppressedMessages{0U};
+
+    // the rate limiter is not synchronized as a whole, concurrent loggers can therefore only cause slightly more or
+    // less suppressed messages
+    RateLimitEntry m_rateLimitEntries[NUMBER_OF_RATE_LIMITED_MESSAGES];
+    std::atomic<uint64_t> m_nextReplacedRateLimitEntry{0U};
+
+    bool m_isActive{false};
+    std::atomic_bool m_keepRunning{true};
+    std::thread m_thread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
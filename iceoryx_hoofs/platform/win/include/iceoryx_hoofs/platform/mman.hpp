@@ -40,6 +40,8 @@ void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)
 
 int munmap(void* addr, size_t length);
 
+int mlock(const void* addr, size_t length);
+
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 
 int shm_unlink(const char* name);
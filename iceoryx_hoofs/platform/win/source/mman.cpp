@@ -45,6 +45,17 @@ int munmap(void* addr, size_t length)
     return -1;
 }
 
+int mlock(const void* addr, size_t length)
+{
+    if (VirtualLock(const_cast<void*>(addr), length))
+    {
+        return 0;
+    }
+
+    PrintLastErrorToConsole();
+    return -1;
+}
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     static constexpr DWORD MAXIMUM_SIZE_HIGH = 0;
@@ -104,5 +104,86 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        // the elements are collected by following the list from the head; if another thread modifies the list in the
+        // meantime, the aba counter of the head has changed and the compare-and-swap fails
+        numberOfIndices = 0U;
+        Index_t index = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && index < m_size)
+        {
+            indices[numberOfIndices] = index;
+            ++numberOfIndices;
+            index = m_nextFreeIndex[index];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = index;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// see pop for the synchronization of m_nextFreeIndex
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        m_nextFreeIndex[indices[i]] = m_invalidIndex;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// the elements are linked to a chain before it is prepended to the list with a single compare-and-swap; the
+    /// validity check is done while linking to also detect an index which is contained multiple times
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        const auto index = indices[i];
+        if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t k = 0U; k < i; ++k)
+            {
+                m_nextFreeIndex[indices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+
+        // preliminary link to the own index to mark it as not invalid until the chain is complete
+        m_nextFreeIndex[index] = (i + 1U < numberOfIndices) ? indices[i + 1U] : index;
+    }
+
+    const auto lastIndex = indices[numberOfIndices - 1U];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0U];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -0,0 +1,202 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/log/async_log_backend.hpp"
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/log/logger.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+
+#include <functional>
+#include <string>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint64_t AsyncLogBackend::MAX_MESSAGE_LENGTH;
+constexpr uint64_t AsyncLogBackend::QUEUE_CAPACITY;
+constexpr uint64_t AsyncLogBackend::MAX_REPETITIONS;
+constexpr std::chrono::milliseconds AsyncLogBackend::RATE_LIMIT_WINDOW;
+constexpr uint64_t AsyncLogBackend::NUMBER_OF_RATE_LIMITED_MESSAGES;
+
+std::atomic<AsyncLogBackend*> AsyncLogBackend::s_activeBackend{nullptr};
+std::atomic<uint64_t> AsyncLogBackend::s_numberOfActiveProducers{0U};
+
+AsyncLogBackend::AsyncLogBackend() noexcept
+{
+    m_thread = std::thread(&AsyncLogBackend::run, this);
+    posix::setThreadName(m_thread.native_handle(), "AsyncLog");
+
+    AsyncLogBackend* noActiveBackend{nullptr};
+    m_isActive = s_activeBackend.compare_exchange_strong(noActiveBackend, this);
+}
+
+AsyncLogBackend::~AsyncLogBackend() noexcept
+{
+    if (m_isActive)
+    {
+        s_activeBackend.store(nullptr);
+        // a logger which has seen this backend before it was deactivated might still be about to push a record
+        while (s_numberOfActiveProducers.load() != 0U)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    m_keepRunning.store(false);
+    cxx::Expects(!m_newRecords.post().has_error());
+    m_thread.join();
+}
+
+bool AsyncLogBackend::isActive() const noexcept
+{
+    return m_isActive;
+}
+
+uint64_t AsyncLogBackend::numberOfDroppedMessages() const noexcept
+{
+    return m_numberOfDroppedMessages.load(std::memory_order_relaxed);
+}
+
+uint64_t AsyncLogBackend::numberOfSuppressedMessages() const noexcept
+{
+    return m_numberOfSuppressedMessages.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogBackend::tryLog(const LogEntry& entry) noexcept
+{
+    if (entry.level == LogLevel::kFatal)
+    {
+        return false;
+    }
+
+    // announce the producer before the backend is acquired, this way the destructor of the backend can wait until
+    // no logger uses it anymore
+    s_numberOfActiveProducers.fetch_add(1U);
+    auto backend = s_activeBackend.load();
+    if (backend != nullptr)
+    {
+        backend->log(entry);
+    }
+    s_numberOfActiveProducers.fetch_sub(1U);
+
+    return backend != nullptr;
+}
+
+void AsyncLogBackend::log(const LogEntry& entry) noexcept
+{
+    if (isRateLimited(entry))
+    {
+        m_numberOfSuppressedMessages.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    LogRecord record;
+    record.level = entry.level;
+    record.time = entry.time;
+    record.message = cxx::string<MAX_MESSAGE_LENGTH>(cxx::TruncateToCapacity, entry.message);
+
+    if (!m_records.tryPush(std::move(record)))
+    {
+        m_numberOfDroppedMessages.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    cxx::Expects(!m_newRecords.post().has_error());
+}
+
+bool AsyncLogBackend::isRateLimited(const LogEntry& entry) noexcept
+{
+    const uint64_t messageHash =
+        std::hash<std::string>()(entry.message) ^ static_cast<uint64_t>(cxx::enumTypeAsUnderlyingType(entry.level));
+    const int64_t now = entry.time.count();
+
+    for (auto& rateLimitEntry : m_rateLimitEntries)
+    {
+        if (rateLimitEntry.messageHash.load(std::memory_order_relaxed) == messageHash)
+        {
+            if (now - rateLimitEntry.windowStart.load(std::memory_order_relaxed) >= RATE_LIMIT_WINDOW.count())
+            {
+                rateLimitEntry.windowStart.store(now, std::memory_order_relaxed);
+                rateLimitEntry.numberOfRepetitions.store(1U, std::memory_order_relaxed);
+                return false;
+            }
+            return rateLimitEntry.numberOfRepetitions.fetch_add(1U, std::memory_order_relaxed) >= MAX_REPETITIONS;
+        }
+    }
+
+    // a message which is not tracked yet replaces the one which started to be tracked first
+    auto& replacedEntry = m_rateLimitEntries[m_nextReplacedRateLimitEntry.fetch_add(1U, std::memory_order_relaxed)
+                                             % NUMBER_OF_RATE_LIMITED_MESSAGES];
+    replacedEntry.messageHash.store(messageHash, std::memory_order_relaxed);
+    replacedEntry.windowStart.store(now, std::memory_order_relaxed);
+    replacedEntry.numberOfRepetitions.store(1U, std::memory_order_relaxed);
+    return false;
+}
+
+void AsyncLogBackend::run() noexcept
+{
+    while (m_keepRunning.load())
+    {
+        cxx::Expects(!m_newRecords.wait().has_error());
+        printPendingRecords();
+        printSummary();
+    }
+
+    // the records which were pushed before the backend was deactivated are still printed
+    printPendingRecords();
+    printSummary();
+}
+
+void AsyncLogBackend::printPendingRecords() noexcept
+{
+    for (auto record = m_records.pop(); record.has_value(); record = m_records.pop())
+    {
+        LogEntry entry;
+        entry.level = record->level;
+        entry.time = record->time;
+        entry.message = record->message.c_str();
+        Logger::Print(entry);
+    }
+}
+
+void AsyncLogBackend::printSummary() noexcept
+{
+    const uint64_t numberOfSuppressedMessages = m_numberOfSuppressedMessages.load(std::memory_order_relaxed);
+    const uint64_t numberOfDroppedMessages = m_numberOfDroppedMessages.load(std::memory_order_relaxed);
+    if (numberOfSuppressedMessages == m_numberOfReportedSuppressedMessages
+        && numberOfDroppedMessages == m_numberOfReportedDroppedMessages)
+    {
+        return;
+    }
+
+    LogEntry entry;
+    entry.level = LogLevel::kWarn;
+    entry.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now().time_since_epoch());
+    entry.message = std::to_string(numberOfSuppressedMessages - m_numberOfReportedSuppressedMessages)
+                    + " repeated log messages were suppressed and "
+                    + std::to_string(numberOfDroppedMessages - m_numberOfReportedDroppedMessages)
+                    + " log messages were dropped since the log queue was full";
+    Logger::Print(entry);
+
+    m_numberOfReportedSuppressedMessages = numberOfSuppressedMessages;
+    m_numberOfReportedDroppedMessages = numberOfDroppedMessages;
+}
+
+} // namespace log
+} // namespace iox
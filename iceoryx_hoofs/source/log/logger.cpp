@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/log/logger.hpp"
 
+#include "iceoryx_hoofs/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 #include "iceoryx_hoofs/log/logstream.hpp"
 
@@ -102,10 +103,10 @@ LogStream Logger::LogVerbose() noexcept
     return LogStream(*this, LogLevel::kVerbose);
 }
 
-void Logger::Print(const LogEntry entry) const
+void Logger::Print(const LogEntry& entry) noexcept
 {
-    // as long as there is only this synchronous logger, buffer the output before using clog to prevent interleaving
-    // output because of threaded access
+    // buffer the output before using clog to prevent interleaving output of the synchronous loggers of different
+    // threads
     std::stringstream buffer;
 
     auto sec = std::chrono::duration_cast<std::chrono::seconds>(entry.time);
@@ -130,7 +131,7 @@ void Logger::Log(const LogEntry& entry) const
 {
     /// @todo do we want a ringbuffer where we store the last e.g. 100 logs
     /// event if they are below the current log level and print them if case of kFatal?
-    if (IsEnabled(entry.level))
+    if (IsEnabled(entry.level) && !AsyncLogBackend::tryLog(entry))
     {
         Print(entry);
     }
@@ -0,0 +1,183 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/numa.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace posix
+{
+constexpr const char NumaTopology::SYSFS_NODE_PATH[];
+
+namespace
+{
+/// @brief reads a list in the sysfs format, e.g. "0-3,8,10-11", and calls the callable for every element
+template <typename Callable>
+bool readSysfsList(const std::string& fileName, const Callable& callable) noexcept
+{
+    std::ifstream file(fileName);
+    std::string list;
+    if (!file.is_open() || !std::getline(file, list))
+    {
+        return false;
+    }
+
+    std::size_t position{0U};
+    while (position < list.size())
+    {
+        auto end = list.find(',', position);
+        end = (end == std::string::npos) ? list.size() : end;
+        const auto range = list.substr(position, end - position);
+        position = end + 1U;
+
+        if (range.empty())
+        {
+            continue;
+        }
+
+        const auto separator = range.find('-');
+        const auto firstString = range.substr(0U, separator);
+        const auto lastString = (separator == std::string::npos) ? firstString : range.substr(separator + 1U);
+        uint32_t first{0U};
+        uint32_t last{0U};
+        if (!cxx::convert::fromString(firstString.c_str(), first) || !cxx::convert::fromString(lastString.c_str(), last)
+            || last == std::numeric_limits<uint32_t>::max())
+        {
+            return false;
+        }
+
+        for (auto element = first; element <= last; ++element)
+        {
+            callable(element);
+        }
+    }
+    return true;
+}
+} // namespace
+
+NumaTopology::NumaTopology(const Path_t& sysfsNodePath) noexcept
+{
+    const std::string basePath{sysfsNodePath.c_str()};
+    readSysfsList(basePath + "/online", [this](const uint32_t node) {
+        if (node != ANY_NUMA_NODE && !m_nodes.push_back(node))
+        {
+            std::cerr << "The NUMA node " << node << " exceeds the maximum number of supported NUMA nodes "
+                      << MAX_NUMBER_OF_NUMA_NODES << std::endl;
+        }
+    });
+
+    for (const auto node : m_nodes)
+    {
+        readSysfsList(basePath + "/node" + std::to_string(node) + "/cpulist", [&](const uint32_t cpu) {
+            if (cpu >= m_nodeOfCpu.capacity())
+            {
+                return;
+            }
+            if (cpu >= m_nodeOfCpu.size())
+            {
+                m_nodeOfCpu.resize(cpu + 1U, ANY_NUMA_NODE);
+            }
+            m_nodeOfCpu[cpu] = node;
+        });
+    }
+}
+
+uint32_t NumaTopology::numberOfNodes() const noexcept
+{
+    return static_cast<uint32_t>(m_nodes.size());
+}
+
+bool NumaTopology::hasNode(const uint32_t node) const noexcept
+{
+    for (const auto availableNode : m_nodes)
+    {
+        if (availableNode == node)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+cxx::optional<uint32_t> NumaTopology::nodeOfCpu(const uint32_t cpu) const noexcept
+{
+    if (cpu >= m_nodeOfCpu.size() || m_nodeOfCpu[cpu] == ANY_NUMA_NODE)
+    {
+        return cxx::nullopt;
+    }
+    return m_nodeOfCpu[cpu];
+}
+
+cxx::optional<uint32_t> NumaTopology::nodeOfCurrentCpu() const noexcept
+{
+#if defined(__linux__)
+    auto cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        return nodeOfCpu(static_cast<uint32_t>(cpu));
+    }
+#endif
+    return cxx::nullopt;
+}
+
+cxx::expected<NumaError> bindMemoryToNumaNode(void* const address,
+                                              const uint64_t size,
+                                              const uint32_t node,
+                                              const NumaTopology& topology) noexcept
+{
+    if (!topology.hasNode(node) || node >= MAX_NUMBER_OF_NUMA_NODES)
+    {
+        return cxx::error<NumaError>(NumaError::NODE_NOT_AVAILABLE);
+    }
+
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr uint64_t BITS_PER_MASK_ELEMENT{sizeof(unsigned long) * 8U};
+    unsigned long nodeMask[MAX_NUMBER_OF_NUMA_NODES / BITS_PER_MASK_ELEMENT]{};
+    nodeMask[node / BITS_PER_MASK_ELEMENT] = 1UL << (node % BITS_PER_MASK_ELEMENT);
+
+    // the kernel ignores the last bit of the given mask size, therefore it is one larger than the number of bits
+    constexpr unsigned long MAX_NODE{MAX_NUMBER_OF_NUMA_NODES + 1U};
+    if (syscall(SYS_mbind, address, size, MPOL_PREFERRED, nodeMask, MAX_NODE, 0U) != 0)
+    {
+        const auto errnum = errno;
+        std::cerr << "Unable to bind the memory to the NUMA node " << node << " (mbind failed) : " << strerror(errnum)
+                  << std::endl;
+        return cxx::error<NumaError>(errnum == ENOSYS ? NumaError::NOT_SUPPORTED : NumaError::BINDING_FAILED);
+    }
+    return cxx::success<>();
+#else
+    static_cast<void>(address);
+    static_cast<void>(size);
+    return cxx::error<NumaError>(NumaError::NOT_SUPPORTED);
+#endif
+}
+
+} // namespace posix
+} // namespace iox
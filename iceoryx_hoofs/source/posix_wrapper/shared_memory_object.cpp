@@ -19,13 +19,17 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/platform/fcntl.hpp"
 #include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace iox
 {
@@ -33,6 +37,7 @@ namespace posix
 {
 constexpr void* SharedMemoryObject::NO_ADDRESS_HINT;
 constexpr uint64_t SIGBUS_ERROR_MESSAGE_LENGTH = 1024U;
+constexpr uint64_t ZERO_INITIALIZATION_ALIGNMENT = 4096U;
 
 static char sigbusErrorMessage[SIGBUS_ERROR_MESSAGE_LENGTH];
 static std::mutex sigbusHandlerMutex;
@@ -49,12 +54,19 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                                        const AccessMode accessMode,
                                        const OwnerShip ownerShip,
                                        const void* baseAddressHint,
-                                       const mode_t permissions)
+                                       const mode_t permissions,
+                                       const MappingOptions& mappingOptions)
     : m_memorySizeInBytes(cxx::align(memorySizeInBytes, Allocator::MEMORY_ALIGNMENT))
 {
     m_isInitialized = true;
 
-    SharedMemory::create(name, accessMode, ownerShip, permissions, m_memorySizeInBytes)
+    // explicit huge pages can only be mapped as a whole
+    if (hugePageSize(mappingOptions.pageType) != 0U)
+    {
+        m_memorySizeInBytes = cxx::align(m_memorySizeInBytes, hugePageSize(mappingOptions.pageType));
+    }
+
+    SharedMemory::create(name, accessMode, ownerShip, permissions, m_memorySizeInBytes, mappingOptions.pageType)
         .and_then([this](auto& sharedMemory) { m_sharedMemory.emplace(std::move(sharedMemory)); })
         .or_else([this](auto&) {
             std::cerr << "Unable to create SharedMemoryObject since we could not acquire a SharedMemory resource"
@@ -65,7 +77,14 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
 
     if (m_isInitialized)
     {
-        MemoryMap::create(baseAddressHint, m_memorySizeInBytes, m_sharedMemory->getHandle(), accessMode, MAP_SHARED, 0)
+        int32_t flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        // the pages of the creator must not be faulted in before they are bound to the NUMA node, they are faulted in
+        // on the zero initialization instead
+        const bool bindsToNumaNode = (ownerShip == OwnerShip::MINE && mappingOptions.numaNode != ANY_NUMA_NODE);
+        flags |= (mappingOptions.prefault && !bindsToNumaNode) ? MAP_POPULATE : 0;
+#endif
+        MemoryMap::create(baseAddressHint, m_memorySizeInBytes, m_sharedMemory->getHandle(), accessMode, flags, 0)
             .and_then([this](auto& memoryMap) { m_memoryMap.emplace(std::move(memoryMap)); })
             .or_else([this](auto) {
                 std::cerr << "Failed to map created shared memory into process!" << std::endl;
@@ -81,15 +100,35 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                   << ", access mode = " << ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)]
                   << ", ownership = " << OWNERSHIP_STRING[static_cast<uint64_t>(ownerShip)]
                   << ", baseAddressHint = " << std::hex << baseAddressHint
-                  << ", permissions = " << std::bitset<sizeof(mode_t)>(permissions) << " ]" << std::endl;
+                  << ", permissions = " << std::bitset<sizeof(mode_t)>(permissions)
+                  << ", page type = " << PAGE_TYPE_STRING[static_cast<uint64_t>(mappingOptions.pageType)] << " ]"
+                  << std::endl;
         return;
     }
 
+    applyMappingOptions(mappingOptions);
+
     m_allocator.emplace(m_memoryMap->getBaseAddress(), m_memorySizeInBytes);
 
+    if (ownerShip == OwnerShip::MINE && mappingOptions.numaNode != ANY_NUMA_NODE)
+    {
+        // the binding is an optimization, without it the shared memory is still usable
+        bindMemoryToNumaNode(m_memoryMap->getBaseAddress(), m_memorySizeInBytes, mappingOptions.numaNode)
+            .or_else([&](auto&) {
+                std::cerr << "Unable to bind the shared memory [" << name << "] to the NUMA node "
+                          << mappingOptions.numaNode << ", the default memory policy of the system is used"
+                          << std::endl;
+            });
+    }
+
     if (ownerShip == OwnerShip::MINE && m_isInitialized)
     {
         std::clog << "Reserving " << m_memorySizeInBytes << " bytes in the shared memory [" << name << "]" << std::endl;
+        if (mappingOptions.zeroInitialization == ZeroInitialization::SKIP && reserveMemory())
+        {
+            // the shared memory was created with O_EXCL and is therefore zero-filled by the kernel
+        }
+        else if (m_isInitialized)
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -110,12 +149,111 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                 baseAddressHint,
                 std::bitset<sizeof(mode_t)>(permissions).to_ulong());
 
-            memset(m_memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            setMemoryToZero(mappingOptions.zeroInitialization);
+        }
+
+        if (!m_isInitialized)
+        {
+            std::cerr << "Unable to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << name
+                      << "], the system does not have enough memory available" << std::endl;
+            return;
         }
         std::clog << "[ Reserving shared memory successful ] " << std::endl;
     }
 }
 
+bool SharedMemoryObject::reserveMemory() noexcept
+{
+#if defined(__linux__)
+    // posix_fallocate does not set errno but returns the error
+    int32_t result{EINTR};
+    while (result == EINTR)
+    {
+        result = posix_fallocate(m_sharedMemory->getHandle(), 0, static_cast<off_t>(m_memorySizeInBytes));
+    }
+
+    if (result == 0)
+    {
+        return true;
+    }
+    if (result != EINVAL && result != EOPNOTSUPP)
+    {
+        m_isInitialized = false;
+        m_errorValue = SharedMemoryObjectError::INSUFFICIENT_MEMORY;
+    }
+#endif
+    return false;
+}
+
+void SharedMemoryObject::setMemoryToZero(const ZeroInitialization zeroInitialization) noexcept
+{
+    constexpr uint64_t MIN_BYTES_PER_THREAD{64U * 1024U * 1024U};
+    constexpr uint64_t MAX_NUMBER_OF_THREADS{16U};
+
+    auto baseAddress = static_cast<uint8_t*>(m_memoryMap->getBaseAddress());
+    uint64_t numberOfThreads = std::min(static_cast<uint64_t>(std::thread::hardware_concurrency()),
+                                        std::min(m_memorySizeInBytes / MIN_BYTES_PER_THREAD, MAX_NUMBER_OF_THREADS));
+    if (zeroInitialization != ZeroInitialization::PARALLEL_MEMSET || numberOfThreads <= 1U)
+    {
+        memset(baseAddress, 0, m_memorySizeInBytes);
+        return;
+    }
+
+    // every thread touches a contiguous range of whole pages, the calling thread sets the last range to zero
+    const uint64_t bytesPerThread = cxx::align(m_memorySizeInBytes / numberOfThreads, ZERO_INITIALIZATION_ALIGNMENT);
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1U);
+    uint64_t offset{0U};
+    for (uint64_t i = 1U; i < numberOfThreads && offset + bytesPerThread < m_memorySizeInBytes; ++i)
+    {
+        threads.emplace_back([=] { memset(baseAddress + offset, 0, bytesPerThread); });
+        offset += bytesPerThread;
+    }
+    memset(baseAddress + offset, 0, m_memorySizeInBytes - offset);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void SharedMemoryObject::applyMappingOptions(const MappingOptions& mappingOptions) noexcept
+{
+    // the options are optimizations, when they cannot be applied the shared memory is still usable
+    if (mappingOptions.pageType == PageType::TRANSPARENT_HUGE_PAGES)
+    {
+#if defined(MADV_HUGEPAGE)
+        posixCall(madvise)(m_memoryMap->getBaseAddress(), m_memorySizeInBytes, MADV_HUGEPAGE)
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([](auto& r) {
+                std::cerr << "Unable to request transparent huge pages for the shared memory (madvise failed) : "
+                          << r.getHumanReadableErrnum() << std::endl;
+            });
+#else
+        std::cerr << "Transparent huge pages are not supported on this platform" << std::endl;
+#endif
+    }
+
+#if !defined(MAP_POPULATE)
+    if (mappingOptions.prefault)
+    {
+        std::cerr << "Prefaulting the shared memory is not supported on this platform" << std::endl;
+    }
+#endif
+
+    if (mappingOptions.lockInMemory)
+    {
+        posixCall(mlock)(m_memoryMap->getBaseAddress(), m_memorySizeInBytes)
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([](auto& r) {
+                std::cerr << "Unable to lock the shared memory into RAM (mlock failed), check RLIMIT_MEMLOCK : "
+                          << r.getHumanReadableErrnum() << std::endl;
+            });
+    }
+}
+
 void* SharedMemoryObject::allocate(const uint64_t size, const uint64_t alignment)
 {
     return m_allocator->allocate(size, alignment);
@@ -37,8 +37,10 @@ SharedMemory::SharedMemory(const Name_t& name,
                            const AccessMode accessMode,
                            const OwnerShip ownerShip,
                            const mode_t permissions,
-                           const uint64_t size) noexcept
+                           const uint64_t size,
+                           const PageType pageType) noexcept
     : m_ownerShip(ownerShip)
+    , m_pageType(pageType)
 {
     m_isInitialized = true;
     // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
@@ -70,8 +72,8 @@ SharedMemory::SharedMemory(const Name_t& name,
         std::cerr << "Unable to create shared memory with the following properties [ name = " << name
                   << ", access mode = " << ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)]
                   << ", ownership = " << OWNERSHIP_STRING[static_cast<uint64_t>(ownerShip)]
-                  << ", mode = " << std::bitset<sizeof(mode_t)>(permissions) << ", sizeInBytes = " << size << " ]"
-                  << std::endl;
+                  << ", mode = " << std::bitset<sizeof(mode_t)>(permissions) << ", sizeInBytes = " << size
+                  << ", page type = " << PAGE_TYPE_STRING[static_cast<uint64_t>(pageType)] << " ]" << std::endl;
         return;
     }
 }
@@ -113,6 +115,7 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& rhs) noexcept
 
         m_name = rhs.m_name;
         m_ownerShip = std::move(rhs.m_ownerShip);
+        m_pageType = std::move(rhs.m_pageType);
         m_handle = std::move(rhs.m_handle);
 
         rhs.reset();
@@ -135,28 +138,62 @@ bool SharedMemory::open(const int oflags, const mode_t permissions, const uint64
     {
         cxx::GenericRAII umaskGuard([&] { umask(umaskSaved); });
 
-        // if we create the shm, cleanup old resources
-        if (oflags & O_CREAT)
+        if (isBackedByHugeTlbFs())
         {
-            posixCall(shm_unlink)(m_name.c_str())
-                .failureReturnValue(-1)
-                .evaluateWithIgnoredErrnos(ENOENT)
-                .and_then([this](auto& r) {
-                    if (r.errnum != ENOENT)
-                    {
-                        std::cout << "SharedMemory still there, doing an unlink of " << m_name << std::endl;
-                    }
-                });
-        }
+            auto path = hugeTlbFsPath();
 
-        if (posixCall(iox_shm_open)(m_name.c_str(), oflags, permissions)
-                .failureReturnValue(-1)
-                .evaluate()
-                .and_then([this](auto& r) { m_handle = r.value; })
-                .or_else([this](auto& r) { m_errorValue = this->errnoToEnum(r.errnum); })
-                .has_error())
+            // if we create the file, cleanup old resources
+            if (oflags & O_CREAT)
+            {
+                posixCall(::unlink)(path.c_str())
+                    .failureReturnValue(-1)
+                    .evaluateWithIgnoredErrnos(ENOENT)
+                    .and_then([&path](auto& r) {
+                        if (r.errnum != ENOENT)
+                        {
+                            std::cout << "SharedMemory still there, doing an unlink of " << path << std::endl;
+                        }
+                    });
+            }
+
+            if (posixCall(iox_open)(path.c_str(), oflags, permissions)
+                    .failureReturnValue(-1)
+                    .evaluate()
+                    .and_then([this](auto& r) { m_handle = r.value; })
+                    .or_else([this](auto& r) { m_errorValue = this->errnoToEnum(r.errnum); })
+                    .has_error())
+            {
+                std::cerr << "Unable to open the file " << path
+                          << " for the huge pages, is a hugetlbfs with the corresponding page size mounted?"
+                          << std::endl;
+                return false;
+            }
+        }
+        else
         {
-            return false;
+            // if we create the shm, cleanup old resources
+            if (oflags & O_CREAT)
+            {
+                posixCall(shm_unlink)(m_name.c_str())
+                    .failureReturnValue(-1)
+                    .evaluateWithIgnoredErrnos(ENOENT)
+                    .and_then([this](auto& r) {
+                        if (r.errnum != ENOENT)
+                        {
+                            std::cout << "SharedMemory still there, doing an unlink of " << m_name << std::endl;
+                        }
+                    });
+            }
+
+            if (posixCall(iox_shm_open)(m_name.c_str(), oflags, permissions)
+                    .failureReturnValue(-1)
+                    .evaluate()
+                    .and_then([this](auto& r) { m_handle = r.value; })
+                    .or_else([this](auto& r) { m_errorValue = this->errnoToEnum(r.errnum); })
+                    .has_error())
+            {
+                return false;
+            }
         }
     }
 
@@ -179,6 +216,18 @@ bool SharedMemory::unlink() noexcept
 {
     if (m_isInitialized && m_ownerShip == OwnerShip::MINE)
     {
+        if (isBackedByHugeTlbFs())
+        {
+            return !posixCall(::unlink)(hugeTlbFsPath().c_str())
+                        .failureReturnValue(-1)
+                        .evaluate()
+                        .or_else([](auto& r) {
+                            std::cerr << "Unable to unlink SharedMemory (unlink failed) : "
+                                      << r.getHumanReadableErrnum() << std::endl;
+                        })
+                        .has_error();
+        }
+
         if (posixCall(shm_unlink)(m_name.c_str())
                 .failureReturnValue(-1)
                 .evaluate()
@@ -194,6 +243,18 @@ bool SharedMemory::unlink() noexcept
     return true;
 }
 
+bool SharedMemory::isBackedByHugeTlbFs() const noexcept
+{
+    return hugePageSize(m_pageType) != 0U;
+}
+
+SharedMemory::Path_t SharedMemory::hugeTlbFsPath() const noexcept
+{
+    // the name starts with a leading slash
+    return (m_pageType == PageType::HUGE_PAGES_1GB) ? Path_t(HUGE_PAGES_1GB_MOUNT_POINT + m_name)
+                                                    : Path_t(HUGE_PAGES_2MB_MOUNT_POINT + m_name);
+}
+
 bool SharedMemory::close() noexcept
 {
     if (m_isInitialized)
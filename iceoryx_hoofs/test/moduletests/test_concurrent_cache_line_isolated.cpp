@@ -0,0 +1,95 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+namespace
+{
+using namespace testing;
+using namespace iox::concurrent;
+
+struct ProducerState
+{
+    ProducerState(const uint64_t writePosition, const uint64_t cachedReadPosition)
+        : m_writePosition(writePosition)
+        , m_cachedReadPosition(cachedReadPosition)
+    {
+    }
+
+    std::atomic<uint64_t> m_writePosition;
+    uint64_t m_cachedReadPosition;
+};
+
+struct ProducerAndConsumer
+{
+    CacheLineIsolated<ProducerState> producer{1U, 2U};
+    CacheLineIsolated<std::atomic<uint64_t>> consumer{3U};
+};
+
+uint64_t distance(const void* lhs, const void* rhs)
+{
+    auto lhsAddress = reinterpret_cast<uintptr_t>(lhs);
+    auto rhsAddress = reinterpret_cast<uintptr_t>(rhs);
+    return (lhsAddress < rhsAddress) ? rhsAddress - lhsAddress : lhsAddress - rhsAddress;
+}
+
+TEST(CacheLineIsolated_test, ArgumentsAreForwardedToTheIsolatedObject)
+{
+    ProducerAndConsumer sut;
+
+    EXPECT_THAT(sut.producer->m_writePosition.load(), Eq(1U));
+    EXPECT_THAT(sut.producer->m_cachedReadPosition, Eq(2U));
+    EXPECT_THAT(sut.consumer->load(), Eq(3U));
+}
+
+TEST(CacheLineIsolated_test, IsolatedObjectCanBeModified)
+{
+    ProducerAndConsumer sut;
+
+    sut.producer->m_writePosition.store(42U);
+    (*sut.producer).m_cachedReadPosition = 73U;
+    sut.consumer->store(13U);
+
+    const ProducerAndConsumer& constSut = sut;
+    EXPECT_THAT(constSut.producer->m_writePosition.load(), Eq(42U));
+    EXPECT_THAT((*constSut.producer).m_cachedReadPosition, Eq(73U));
+    EXPECT_THAT(constSut.consumer->load(), Eq(13U));
+}
+
+TEST(CacheLineIsolated_test, AdjacentIsolatedObjectsAreAtLeastTheFalseSharingRangeApart)
+{
+    ProducerAndConsumer sut;
+
+    const auto endOfProducer = reinterpret_cast<const uint8_t*>(&*sut.producer) + sizeof(ProducerState);
+    EXPECT_THAT(distance(endOfProducer, &*sut.consumer), Ge(FALSE_SHARING_RANGE));
+}
+
+TEST(CacheLineIsolated_test, IsolatedObjectIsAtLeastTheFalseSharingRangeApartFromTheSurroundingObject)
+{
+    ProducerAndConsumer sut;
+
+    EXPECT_THAT(distance(&sut, &*sut.producer), Ge(FALSE_SHARING_RANGE));
+    const auto endOfSut = reinterpret_cast<const uint8_t*>(&sut) + sizeof(sut);
+    const auto endOfConsumer = reinterpret_cast<const uint8_t*>(&*sut.consumer) + sizeof(std::atomic<uint64_t>);
+    EXPECT_THAT(distance(endOfConsumer, endOfSut), Ge(FALSE_SHARING_RANGE));
+}
+
+} // namespace
@@ -199,4 +199,77 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopBatch)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size - 1U), Eq(Size - 1U));
+    for (uint32_t i = 0; i < Size - 1U; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchReturnsOnlyAvailableIndices)
+{
+    uint32_t index;
+    this->m_loffli.pop(index);
+
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popBatch(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchTillFull)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(indices, indices + Size)));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithDuplicateIndexPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+
+    uint32_t indicesToPush[] = {indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushBatch(indicesToPush, 3U), Eq(false));
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, Size), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithOutOfBoundIndexPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, 2U), Eq(2U));
+
+    uint32_t indicesToPush[] = {indices[0], Size + 42, indices[1]};
+    EXPECT_THAT(this->m_loffli.pushBatch(indicesToPush, 3U), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(indices[1]), Eq(true));
+}
 } // namespace
@@ -0,0 +1,243 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/internal/concurrent/spsc_queue.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+using namespace iox::concurrent;
+
+constexpr uint64_t QUEUE_CAPACITY{10U};
+using Queue_t = SpscQueue<uint64_t, QUEUE_CAPACITY>;
+
+class SpscQueue_test : public TestWithParam<SpscQueueOverflowPolicy>
+{
+  public:
+    void fill(Queue_t& queue, const uint64_t numberOfValues, const uint64_t firstValue = 0U)
+    {
+        for (uint64_t i = 0U; i < numberOfValues; ++i)
+        {
+            ASSERT_FALSE(queue.push(firstValue + i).has_value());
+        }
+    }
+
+    Queue_t sut{GetParam()};
+};
+
+INSTANTIATE_TEST_CASE_P(SpscQueue,
+                        SpscQueue_test,
+                        Values(SpscQueueOverflowPolicy::REJECT_NEW_VALUE,
+                               SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE));
+
+TEST_P(SpscQueue_test, InitiallyEmptyWithMaximumCapacity)
+{
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(QUEUE_CAPACITY));
+    EXPECT_THAT(sut.overflowPolicy(), Eq(GetParam()));
+}
+
+TEST_P(SpscQueue_test, PopOnEmptyQueueReturnsNullopt)
+{
+    EXPECT_FALSE(sut.pop().has_value());
+}
+
+TEST_P(SpscQueue_test, PushedValueCanBePopped)
+{
+    EXPECT_FALSE(sut.push(42U).has_value());
+    EXPECT_FALSE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(1U));
+
+    auto value = sut.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(*value, Eq(42U));
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_P(SpscQueue_test, ValuesArePoppedInTheOrderTheyWerePushedAcrossTheWrapAround)
+{
+    for (uint64_t round = 0U; round < 3U; ++round)
+    {
+        fill(sut, QUEUE_CAPACITY - 3U, round * QUEUE_CAPACITY);
+        for (uint64_t i = 0U; i < QUEUE_CAPACITY - 3U; ++i)
+        {
+            auto value = sut.pop();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(*value, Eq(round * QUEUE_CAPACITY + i));
+        }
+    }
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_P(SpscQueue_test, SizeIsLimitedByTheCapacity)
+{
+    fill(sut, QUEUE_CAPACITY);
+    IOX_DISCARD_RESULT(sut.push(73U));
+
+    EXPECT_THAT(sut.size(), Eq(QUEUE_CAPACITY));
+}
+
+TEST_P(SpscQueue_test, SetCapacityOnEmptyQueueLimitsTheNumberOfValues)
+{
+    constexpr uint64_t NEW_CAPACITY{3U};
+    ASSERT_TRUE(sut.setCapacity(NEW_CAPACITY));
+    EXPECT_THAT(sut.capacity(), Eq(NEW_CAPACITY));
+
+    fill(sut, NEW_CAPACITY);
+    EXPECT_TRUE(sut.push(73U).has_value());
+    EXPECT_THAT(sut.size(), Eq(NEW_CAPACITY));
+}
+
+TEST_P(SpscQueue_test, SetCapacityAfterTheQueueWasUsedResetsThePositions)
+{
+    fill(sut, 7U);
+    while (sut.pop().has_value())
+    {
+    }
+
+    ASSERT_TRUE(sut.setCapacity(4U));
+    fill(sut, 4U, 100U);
+    for (uint64_t i = 0U; i < 4U; ++i)
+    {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(*value, Eq(100U + i));
+    }
+}
+
+TEST_P(SpscQueue_test, SetCapacityFailsForInvalidCapacity)
+{
+    EXPECT_FALSE(sut.setCapacity(0U));
+    EXPECT_FALSE(sut.setCapacity(QUEUE_CAPACITY + 1U));
+    EXPECT_THAT(sut.capacity(), Eq(QUEUE_CAPACITY));
+}
+
+TEST_P(SpscQueue_test, SetCapacityFailsWhenQueueIsNotEmpty)
+{
+    fill(sut, 1U);
+
+    EXPECT_FALSE(sut.setCapacity(5U));
+    EXPECT_THAT(sut.capacity(), Eq(QUEUE_CAPACITY));
+}
+
+TEST(SpscQueueRejectNewValue_test, PushIntoFullQueueReturnsThePushedValue)
+{
+    Queue_t sut{SpscQueueOverflowPolicy::REJECT_NEW_VALUE};
+    for (uint64_t i = 0U; i < QUEUE_CAPACITY; ++i)
+    {
+        ASSERT_FALSE(sut.push(i).has_value());
+    }
+
+    auto rejectedValue = sut.push(73U);
+    ASSERT_TRUE(rejectedValue.has_value());
+    EXPECT_THAT(*rejectedValue, Eq(73U));
+
+    for (uint64_t i = 0U; i < QUEUE_CAPACITY; ++i)
+    {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(*value, Eq(i));
+    }
+    EXPECT_FALSE(sut.pop().has_value());
+}
+
+TEST(SpscQueueDiscardOldestValue_test, PushIntoFullQueueReturnsTheOldestValue)
+{
+    Queue_t sut{SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE};
+    for (uint64_t i = 0U; i < QUEUE_CAPACITY; ++i)
+    {
+        ASSERT_FALSE(sut.push(i).has_value());
+    }
+
+    for (uint64_t i = 0U; i < QUEUE_CAPACITY + 3U; ++i)
+    {
+        auto discardedValue = sut.push(QUEUE_CAPACITY + i);
+        ASSERT_TRUE(discardedValue.has_value());
+        EXPECT_THAT(*discardedValue, Eq(i));
+    }
+
+    for (uint64_t i = QUEUE_CAPACITY + 3U; i < 2U * QUEUE_CAPACITY + 3U; ++i)
+    {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(*value, Eq(i));
+    }
+    EXPECT_FALSE(sut.pop().has_value());
+}
+
+TEST(SpscQueueDiscardOldestValue_test, ConcurrentOverflowsHandEveryValueEitherToTheConsumerOrBackToTheProducer)
+{
+    constexpr uint64_t NUMBER_OF_VALUES{200000U};
+    constexpr uint64_t SMALL_CAPACITY{4U};
+    SpscQueue<uint64_t, SMALL_CAPACITY> sut{SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE};
+
+    std::vector<uint64_t> discardedValues;
+    std::atomic_bool isProducerFinished{false};
+    std::thread producer([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+        {
+            auto discardedValue = sut.push(i);
+            if (discardedValue.has_value())
+            {
+                discardedValues.push_back(*discardedValue);
+            }
+        }
+        isProducerFinished.store(true);
+    });
+
+    std::vector<uint64_t> poppedValues;
+    while (!isProducerFinished.load() || !sut.empty())
+    {
+        auto value = sut.pop();
+        if (value.has_value())
+        {
+            poppedValues.push_back(*value);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    std::vector<uint32_t> numberOfDeliveries(NUMBER_OF_VALUES, 0U);
+    for (auto value : poppedValues)
+    {
+        ++numberOfDeliveries[value];
+    }
+    for (auto value : discardedValues)
+    {
+        ++numberOfDeliveries[value];
+    }
+
+    EXPECT_THAT(poppedValues.size() + discardedValues.size(), Eq(NUMBER_OF_VALUES));
+    EXPECT_THAT(static_cast<uint64_t>(std::count(numberOfDeliveries.begin(), numberOfDeliveries.end(), 1U)),
+                Eq(NUMBER_OF_VALUES));
+    EXPECT_TRUE(std::is_sorted(poppedValues.begin(), poppedValues.end()));
+    EXPECT_TRUE(std::is_sorted(discardedValues.begin(), discardedValues.end()));
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/log/async_log_backend.hpp"
+#include "iceoryx_hoofs/log/logger.hpp"
+#include "test.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using iox::log::AsyncLogBackend;
+
+class LoggerSUT : public iox::log::Logger
+{
+  public:
+    LoggerSUT()
+        : iox::log::Logger("Test", "Context for testing!", iox::log::LogLevel::kVerbose)
+    {
+    }
+
+    using Logger::Log;
+};
+
+class AsyncLogBackend_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_oldBuffer = std::clog.rdbuf();
+        std::clog.rdbuf(m_capture.rdbuf());
+    }
+
+    void TearDown() override
+    {
+        std::clog.rdbuf(m_oldBuffer);
+    }
+
+    void log(const std::string& message,
+             const std::chrono::milliseconds time = std::chrono::milliseconds(0),
+             const iox::log::LogLevel level = iox::log::LogLevel::kInfo)
+    {
+        iox::log::LogEntry entry;
+        entry.level = level;
+        entry.time = time;
+        entry.message = message;
+        m_logger.Log(entry);
+    }
+
+    uint64_t numberOfOccurrences(const std::string& message)
+    {
+        const std::string output = m_capture.str();
+        uint64_t occurrences{0U};
+        for (auto position = output.find(message); position != std::string::npos;
+             position = output.find(message, position + message.size()))
+        {
+            ++occurrences;
+        }
+        return occurrences;
+    }
+
+    std::stringstream m_capture;
+    std::streambuf* m_oldBuffer{nullptr};
+    LoggerSUT m_logger;
+};
+
+TEST_F(AsyncLogBackend_test, MessagesAreAllPrintedInOrderWhenBackendIsDestroyed)
+{
+    {
+        AsyncLogBackend sut;
+        ASSERT_TRUE(sut.isActive());
+        log("Hypnotoad");
+        log("all glory to");
+        log("the hypnotoad");
+    }
+
+    const std::string output = m_capture.str();
+    const auto first = output.find("Hypnotoad");
+    const auto second = output.find("all glory to");
+    const auto third = output.find("the hypnotoad");
+    ASSERT_THAT(first, Ne(std::string::npos));
+    ASSERT_THAT(second, Ne(std::string::npos));
+    ASSERT_THAT(third, Ne(std::string::npos));
+    EXPECT_THAT(first, Lt(second));
+    EXPECT_THAT(second, Lt(third));
+}
+
+TEST_F(AsyncLogBackend_test, SecondBackendIsInactive)
+{
+    AsyncLogBackend sut;
+    AsyncLogBackend secondBackend;
+
+    EXPECT_TRUE(sut.isActive());
+    EXPECT_FALSE(secondBackend.isActive());
+}
+
+TEST_F(AsyncLogBackend_test, NewBackendIsActiveWhenPreviousBackendIsDestroyed)
+{
+    {
+        AsyncLogBackend previousBackend;
+    }
+    AsyncLogBackend sut;
+
+    EXPECT_TRUE(sut.isActive());
+}
+
+TEST_F(AsyncLogBackend_test, FatalMessageIsPrintedSynchronously)
+{
+    AsyncLogBackend sut;
+
+    log("the end is near", std::chrono::milliseconds(0), iox::log::LogLevel::kFatal);
+
+    EXPECT_THAT(numberOfOccurrences("the end is near"), Eq(1U));
+}
+
+TEST_F(AsyncLogBackend_test, RepeatedMessagesWithinTheRateLimitWindowAreSuppressed)
+{
+    constexpr uint64_t NUMBER_OF_SUPPRESSED_MESSAGES{5U};
+    {
+        AsyncLogBackend sut;
+        for (uint64_t i = 0U; i < AsyncLogBackend::MAX_REPETITIONS + NUMBER_OF_SUPPRESSED_MESSAGES; ++i)
+        {
+            log("out of chunks");
+        }
+        EXPECT_THAT(sut.numberOfSuppressedMessages(), Eq(NUMBER_OF_SUPPRESSED_MESSAGES));
+    }
+
+    EXPECT_THAT(numberOfOccurrences("out of chunks"), Eq(AsyncLogBackend::MAX_REPETITIONS));
+    EXPECT_THAT(numberOfOccurrences(std::to_string(NUMBER_OF_SUPPRESSED_MESSAGES) + " repeated log messages"), Eq(1U));
+}
+
+TEST_F(AsyncLogBackend_test, RepeatedMessagesInTheNextRateLimitWindowAreNotSuppressed)
+{
+    {
+        AsyncLogBackend sut;
+        for (uint64_t i = 0U; i < AsyncLogBackend::MAX_REPETITIONS; ++i)
+        {
+            log("out of chunks");
+        }
+        log("out of chunks", AsyncLogBackend::RATE_LIMIT_WINDOW);
+        EXPECT_THAT(sut.numberOfSuppressedMessages(), Eq(0U));
+    }
+
+    EXPECT_THAT(numberOfOccurrences("out of chunks"), Eq(AsyncLogBackend::MAX_REPETITIONS + 1U));
+}
+
+TEST_F(AsyncLogBackend_test, InterleavedRepeatedMessagesAreBothSuppressed)
+{
+    constexpr uint64_t NUMBER_OF_SUPPRESSED_MESSAGES_PER_MESSAGE{5U};
+    {
+        AsyncLogBackend sut;
+        for (uint64_t i = 0U; i < AsyncLogBackend::MAX_REPETITIONS + NUMBER_OF_SUPPRESSED_MESSAGES_PER_MESSAGE; ++i)
+        {
+            log("ping");
+            log("pong");
+        }
+        EXPECT_THAT(sut.numberOfSuppressedMessages(), Eq(2U * NUMBER_OF_SUPPRESSED_MESSAGES_PER_MESSAGE));
+    }
+
+    EXPECT_THAT(numberOfOccurrences("ping"), Eq(AsyncLogBackend::MAX_REPETITIONS));
+    EXPECT_THAT(numberOfOccurrences("pong"), Eq(AsyncLogBackend::MAX_REPETITIONS));
+}
+
+TEST_F(AsyncLogBackend_test, TooLongMessageIsTruncated)
+{
+    {
+        AsyncLogBackend sut;
+        log(std::string(AsyncLogBackend::MAX_MESSAGE_LENGTH, 'a') + "b");
+    }
+
+    EXPECT_THAT(numberOfOccurrences(std::string(AsyncLogBackend::MAX_MESSAGE_LENGTH, 'a')), Eq(1U));
+    EXPECT_THAT(numberOfOccurrences("ab"), Eq(0U));
+}
+
+TEST_F(AsyncLogBackend_test, EveryMessageIsEitherPrintedOrCountedAsDropped)
+{
+    constexpr uint64_t NUMBER_OF_MESSAGES{AsyncLogBackend::QUEUE_CAPACITY * 4U};
+    uint64_t numberOfDroppedMessages{0U};
+    {
+        AsyncLogBackend sut;
+        for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+        {
+            log("message " + std::to_string(i) + ";");
+        }
+        numberOfDroppedMessages = sut.numberOfDroppedMessages();
+    }
+
+    EXPECT_THAT(numberOfOccurrences("message ") + numberOfDroppedMessages, Eq(NUMBER_OF_MESSAGES));
+}
+
+} // namespace
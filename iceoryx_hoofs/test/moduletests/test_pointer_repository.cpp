@@ -0,0 +1,142 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+
+using id_t = uint64_t;
+using ptr_t = void*;
+constexpr uint64_t CAPACITY{100U};
+using Repository_t = iox::rp::PointerRepository<id_t, ptr_t, CAPACITY>;
+
+class PointerRepository_test : public Test
+{
+  public:
+    ptr_t ptrAt(const uint64_t offset)
+    {
+        return &m_memory[offset];
+    }
+
+    static constexpr uint64_t MEMORY_SIZE{CAPACITY * 16U};
+    uint8_t m_memory[MEMORY_SIZE];
+    std::unique_ptr<Repository_t> sut{new Repository_t()};
+};
+
+constexpr uint64_t PointerRepository_test::MEMORY_SIZE;
+
+TEST_F(PointerRepository_test, SearchIdOfPointerInSegmentReturnsIdOfSegment)
+{
+    ASSERT_TRUE(sut->registerPtr(3U, ptrAt(32U), 16U));
+    ASSERT_TRUE(sut->registerPtr(1U, ptrAt(0U), 16U));
+    ASSERT_TRUE(sut->registerPtr(2U, ptrAt(16U), 16U));
+
+    EXPECT_THAT(sut->searchId(ptrAt(0U)), Eq(1U));
+    EXPECT_THAT(sut->searchId(ptrAt(15U)), Eq(1U));
+    EXPECT_THAT(sut->searchId(ptrAt(16U)), Eq(2U));
+    EXPECT_THAT(sut->searchId(ptrAt(40U)), Eq(3U));
+    EXPECT_THAT(sut->searchId(ptrAt(47U)), Eq(3U));
+}
+
+TEST_F(PointerRepository_test, SearchIdOfPointerOutsideOfAllSegmentsReturnsZero)
+{
+    ASSERT_TRUE(sut->registerPtr(1U, ptrAt(16U), 16U));
+
+    EXPECT_THAT(sut->searchId(ptrAt(15U)), Eq(0U));
+    EXPECT_THAT(sut->searchId(ptrAt(32U)), Eq(0U));
+}
+
+TEST_F(PointerRepository_test, SearchIdOfPointerInEmptySegmentReturnsZero)
+{
+    ASSERT_TRUE(sut->registerPtr(1U, ptrAt(16U), 0U));
+
+    EXPECT_THAT(sut->searchId(ptrAt(16U)), Eq(0U));
+}
+
+TEST_F(PointerRepository_test, SearchIdOfPointerInUnregisteredSegmentReturnsZero)
+{
+    ASSERT_TRUE(sut->registerPtr(1U, ptrAt(0U), 16U));
+    ASSERT_TRUE(sut->registerPtr(2U, ptrAt(16U), 16U));
+
+    ASSERT_TRUE(sut->unregisterPtr(2U));
+
+    EXPECT_THAT(sut->searchId(ptrAt(8U)), Eq(1U));
+    EXPECT_THAT(sut->searchId(ptrAt(20U)), Eq(0U));
+}
+
+TEST_F(PointerRepository_test, SearchIdAfterUnregisterAllReturnsZero)
+{
+    ASSERT_TRUE(sut->registerPtr(1U, ptrAt(0U), 16U));
+    ASSERT_THAT(sut->registerPtr(ptrAt(16U), 16U), Ne(Repository_t::INVALID_ID));
+
+    sut->unregisterAll();
+
+    EXPECT_THAT(sut->searchId(ptrAt(8U)), Eq(0U));
+    EXPECT_THAT(sut->searchId(ptrAt(20U)), Eq(0U));
+}
+
+TEST_F(PointerRepository_test, SearchIdOfPointerInOverlappingSegmentsReturnsLowestId)
+{
+    ASSERT_TRUE(sut->registerPtr(5U, ptrAt(0U), 64U));
+    ASSERT_TRUE(sut->registerPtr(2U, ptrAt(16U), 16U));
+    ASSERT_TRUE(sut->registerPtr(7U, ptrAt(40U), 8U));
+
+    EXPECT_THAT(sut->searchId(ptrAt(8U)), Eq(5U));
+    EXPECT_THAT(sut->searchId(ptrAt(20U)), Eq(2U));
+    EXPECT_THAT(sut->searchId(ptrAt(42U)), Eq(5U));
+    EXPECT_THAT(sut->searchId(ptrAt(50U)), Eq(5U));
+}
+
+TEST_F(PointerRepository_test, SearchIdDuringConcurrentRegistrationsFindsUnchangedSegment)
+{
+    constexpr uint64_t SEGMENT_SIZE{16U};
+    constexpr id_t STABLE_ID{1U};
+    ASSERT_TRUE(sut->registerPtr(STABLE_ID, ptrAt(MEMORY_SIZE / 2U), SEGMENT_SIZE));
+
+    std::atomic_bool keepRunning{true};
+    std::thread registrationThread([&] {
+        while (keepRunning)
+        {
+            for (id_t id = 2U; id < CAPACITY / 2U; ++id)
+            {
+                sut->registerPtr(id, ptrAt((id % 2U == 0U) ? id * SEGMENT_SIZE : MEMORY_SIZE - id * SEGMENT_SIZE),
+                                 SEGMENT_SIZE);
+            }
+            for (id_t id = 2U; id < CAPACITY / 2U; ++id)
+            {
+                sut->unregisterPtr(id);
+            }
+        }
+    });
+
+    constexpr uint64_t NUMBER_OF_SEARCHES{100000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SEARCHES; ++i)
+    {
+        ASSERT_THAT(sut->searchId(ptrAt(MEMORY_SIZE / 2U + i % SEGMENT_SIZE)), Eq(STABLE_ID));
+    }
+
+    keepRunning = false;
+    registrationThread.join();
+}
+
+} // namespace
@@ -0,0 +1,202 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/numa.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "test.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::posix;
+
+/// @brief creates a sysfs like node directory with a fake topology which is removed on destruction
+class FakeNumaTopology
+{
+  public:
+    FakeNumaTopology()
+    {
+        char pathTemplate[] = "/tmp/iox_numa_test_XXXXXX";
+        m_path = mkdtemp(pathTemplate);
+    }
+
+    ~FakeNumaTopology()
+    {
+        IOX_DISCARD_RESULT(system(("rm -rf " + m_path).c_str()));
+    }
+
+    void setOnlineNodes(const std::string& nodeList)
+    {
+        std::ofstream(m_path + "/online") << nodeList << "\n";
+    }
+
+    void setCpusOfNode(const uint32_t node, const std::string& cpuList)
+    {
+        const auto nodePath = m_path + "/node" + std::to_string(node);
+        IOX_DISCARD_RESULT(system(("mkdir -p " + nodePath).c_str()));
+        std::ofstream(nodePath + "/cpulist") << cpuList << "\n";
+    }
+
+    NumaTopology::Path_t path() const
+    {
+        return NumaTopology::Path_t(iox::cxx::TruncateToCapacity, m_path);
+    }
+
+  private:
+    std::string m_path;
+};
+
+TEST(NumaTopology_test, TopologyWithoutSysfsHasNoNodes)
+{
+    NumaTopology sut(NumaTopology::Path_t("/this/path/does/not/exist"));
+
+    EXPECT_THAT(sut.numberOfNodes(), Eq(0U));
+    EXPECT_FALSE(sut.hasNode(0U));
+    EXPECT_FALSE(sut.nodeOfCpu(0U).has_value());
+    EXPECT_FALSE(sut.nodeOfCurrentCpu().has_value());
+}
+
+TEST(NumaTopology_test, FakeTopologyWithTwoNodesIsParsed)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("0-1");
+    fakeTopology.setCpusOfNode(0U, "0-3,8-11");
+    fakeTopology.setCpusOfNode(1U, "4-7,12");
+
+    NumaTopology sut(fakeTopology.path());
+
+    EXPECT_THAT(sut.numberOfNodes(), Eq(2U));
+    EXPECT_TRUE(sut.hasNode(0U));
+    EXPECT_TRUE(sut.hasNode(1U));
+    EXPECT_FALSE(sut.hasNode(2U));
+
+    for (uint32_t cpu : {0U, 3U, 8U, 11U})
+    {
+        ASSERT_TRUE(sut.nodeOfCpu(cpu).has_value());
+        EXPECT_THAT(sut.nodeOfCpu(cpu).value(), Eq(0U));
+    }
+    for (uint32_t cpu : {4U, 7U, 12U})
+    {
+        ASSERT_TRUE(sut.nodeOfCpu(cpu).has_value());
+        EXPECT_THAT(sut.nodeOfCpu(cpu).value(), Eq(1U));
+    }
+    EXPECT_FALSE(sut.nodeOfCpu(13U).has_value());
+}
+
+TEST(NumaTopology_test, FakeTopologyWithSparseNodesIsParsed)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("0,2");
+    fakeTopology.setCpusOfNode(0U, "0");
+    fakeTopology.setCpusOfNode(2U, "1");
+
+    NumaTopology sut(fakeTopology.path());
+
+    EXPECT_THAT(sut.numberOfNodes(), Eq(2U));
+    EXPECT_FALSE(sut.hasNode(1U));
+    ASSERT_TRUE(sut.nodeOfCpu(1U).has_value());
+    EXPECT_THAT(sut.nodeOfCpu(1U).value(), Eq(2U));
+}
+
+TEST(NumaTopology_test, CurrentCpuIsResolvedWithFakeTopology)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("0-1");
+    fakeTopology.setCpusOfNode(0U, "");
+    fakeTopology.setCpusOfNode(1U, "0-1023");
+
+    NumaTopology sut(fakeTopology.path());
+
+    ASSERT_TRUE(sut.nodeOfCurrentCpu().has_value());
+    EXPECT_THAT(sut.nodeOfCurrentCpu().value(), Eq(1U));
+}
+
+TEST(NumaTopology_test, MalformedNodeListResultsInNoNodes)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("zero");
+
+    NumaTopology sut(fakeTopology.path());
+
+    EXPECT_THAT(sut.numberOfNodes(), Eq(0U));
+}
+
+TEST(NumaTopology_test, BindingToNodeWhichIsNotInTheTopologyFails)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("0-1");
+    NumaTopology topology(fakeTopology.path());
+
+    alignas(MaxPageSize) static uint8_t memory[MaxPageSize];
+    auto result = bindMemoryToNumaNode(memory, sizeof(memory), 2U, topology);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(NumaError::NODE_NOT_AVAILABLE));
+}
+
+TEST(NumaTopology_test, BindingToNodeOfFakeTopologyWhichIsNotInTheSystemFails)
+{
+    FakeNumaTopology fakeTopology;
+    fakeTopology.setOnlineNodes("0-63");
+    NumaTopology topology(fakeTopology.path());
+    NumaTopology systemTopology;
+    if (systemTopology.hasNode(63U))
+    {
+        // the binding would succeed
+        return;
+    }
+
+    alignas(MaxPageSize) static uint8_t memory[MaxPageSize];
+    internal::CaptureStderr();
+    auto result = bindMemoryToNumaNode(memory, sizeof(memory), 63U, topology);
+    internal::GetCapturedStderr();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), AnyOf(Eq(NumaError::BINDING_FAILED), Eq(NumaError::NOT_SUPPORTED)));
+}
+
+TEST(NumaTopology_test, SharedMemoryBoundToNodeOfTheSystemIsUsable)
+{
+    // the binding itself may be prohibited in containers, the shared memory has to be usable nevertheless
+    MappingOptions mappingOptions;
+    mappingOptions.numaNode = 0U;
+    mappingOptions.prefault = true;
+
+    internal::CaptureStderr();
+    auto sut = SharedMemoryObject::create("/iox_numa_test",
+                                          MaxPageSize,
+                                          AccessMode::READ_WRITE,
+                                          OwnerShip::MINE,
+                                          SharedMemoryObject::NO_ADDRESS_HINT,
+                                          static_cast<mode_t>(S_IRUSR | S_IWUSR),
+                                          mappingOptions);
+    internal::GetCapturedStderr();
+
+    ASSERT_FALSE(sut.has_error());
+    auto memory = static_cast<uint8_t*>(sut->allocate(MaxPageSize, 8U));
+    ASSERT_THAT(memory, Ne(nullptr));
+    memory[0U] = 42U;
+    memory[MaxPageSize - 1U] = 73U;
+    EXPECT_THAT(memory[0U], Eq(42U));
+    EXPECT_THAT(memory[MaxPageSize - 1U], Eq(73U));
+}
+
+} // namespace
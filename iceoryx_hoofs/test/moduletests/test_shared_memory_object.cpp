@@ -177,4 +177,134 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithMappingOptionsIsSharedWithOpeningProcess)
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.pageType = iox::posix::PageType::TRANSPARENT_HUGE_PAGES;
+    mappingOptions.prefault = true;
+    mappingOptions.lockInMemory = true;
+
+    // the options are optimizations, if the system does not support them the shared memory is still created
+    auto sut = iox::posix::SharedMemoryObject::create("/shmMappingOptions",
+                                                      1024,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OwnerShip::MINE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      mappingOptions);
+    ASSERT_FALSE(sut.has_error());
+    int* value = static_cast<int*>(sut->allocate(sizeof(int), alignof(int)));
+    ASSERT_THAT(value, Ne(nullptr));
+    *value = 42;
+
+    auto sut2 = iox::posix::SharedMemoryObject::create("/shmMappingOptions",
+                                                       1024,
+                                                       iox::posix::AccessMode::READ_WRITE,
+                                                       iox::posix::OwnerShip::OPEN_EXISTING,
+                                                       iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                       S_IRUSR | S_IWUSR,
+                                                       mappingOptions);
+    ASSERT_FALSE(sut2.has_error());
+    EXPECT_THAT(*static_cast<int*>(sut2->getBaseAddress()), Eq(42));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithExplicitHugePagesIsAMultipleOfTheHugePageSize)
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.pageType = iox::posix::PageType::HUGE_PAGES_2MB;
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePages",
+                                                      1024,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OwnerShip::MINE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      mappingOptions);
+
+    // without a hugetlbfs with reserved huge pages the creation fails
+    if (sut.has_error())
+    {
+        EXPECT_THAT(sut.get_error(),
+                    AnyOf(Eq(iox::posix::SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED),
+                          Eq(iox::posix::SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED)));
+    }
+    else
+    {
+        EXPECT_THAT(sut->getSizeInBytes() % iox::posix::hugePageSize(iox::posix::PageType::HUGE_PAGES_2MB), Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithParallelMemsetIsUsable)
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::PARALLEL_MEMSET;
+    // large enough to be set to zero by multiple threads, the size is no multiple of the page size to cover the
+    // last range
+    constexpr uint64_t MEMORY_SIZE{130U * 1024U * 1024U + 8U};
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmParallelMemset",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OwnerShip::MINE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      mappingOptions);
+
+    ASSERT_FALSE(sut.has_error());
+    auto memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1U));
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(memory[0U], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE / 2U], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithSkippedZeroInitializationIsZeroed)
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::SKIP;
+    constexpr uint64_t MEMORY_SIZE{1024U * 1024U};
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmSkipZeroInitialization",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OwnerShip::MINE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      mappingOptions);
+
+    ASSERT_FALSE(sut.has_error());
+    auto memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1U));
+    ASSERT_THAT(memory, Ne(nullptr));
+    uint64_t numberOfNonZeroBytes{0U};
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        numberOfNonZeroBytes += (memory[i] != 0U) ? 1U : 0U;
+    }
+    EXPECT_THAT(numberOfNonZeroBytes, Eq(0U));
+}
+
+#if defined(__linux__)
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithSkippedZeroInitializationFailsWhenSystemLacksMemory)
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::SKIP;
+    // more than any shared memory file system provides, with MEMSET this would terminate with SIGBUS
+    constexpr uint64_t MEMORY_SIZE{1024U * 1024U * 1024U * 1024U};
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmSkipZeroInitializationTooLarge",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OwnerShip::MINE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      mappingOptions);
+
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.get_error(),
+                AnyOf(Eq(iox::posix::SharedMemoryObjectError::INSUFFICIENT_MEMORY),
+                      Eq(iox::posix::SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED),
+                      Eq(iox::posix::SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED)));
+}
+#endif
+
 } // namespace
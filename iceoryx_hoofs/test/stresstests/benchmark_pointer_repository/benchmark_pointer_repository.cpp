@@ -0,0 +1,122 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using Id_t = uint64_t;
+using Ptr_t = void*;
+using Repository_t = iox::rp::PointerRepository<Id_t, Ptr_t>;
+
+constexpr uint64_t SEGMENT_SIZE{1024U};
+
+/// @brief the search of the PointerRepository before it indexed the segments, it visits every registered id
+class LinearScan
+{
+  public:
+    void registerPtr(const Id_t id, const Ptr_t ptr, const uint64_t size)
+    {
+        if (id >= m_begin.size())
+        {
+            m_begin.resize(id + 1U, 0U);
+            m_end.resize(id + 1U, 0U);
+        }
+        m_begin[id] = reinterpret_cast<uintptr_t>(ptr);
+        m_end[id] = reinterpret_cast<uintptr_t>(ptr) + size - 1U;
+    }
+
+    Id_t searchId(const Ptr_t ptr) const
+    {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        for (Id_t id = 1U; id < m_begin.size(); ++id)
+        {
+            if (address >= m_begin[id] && address <= m_end[id])
+            {
+                return id;
+            }
+        }
+        return 0U;
+    }
+
+  private:
+    std::vector<uintptr_t> m_begin;
+    std::vector<uintptr_t> m_end;
+};
+
+template <typename Repository>
+void measure(const char* name,
+             const Repository& repository,
+             const std::vector<Ptr_t>& pointers,
+             const uint64_t numberOfSearches)
+{
+    uint64_t checksum{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfSearches; ++i)
+    {
+        checksum += repository.searchId(pointers[i % pointers.size()]);
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << std::setw(20) << name << " : " << std::setw(8)
+              << static_cast<double>(duration.count()) / static_cast<double>(numberOfSearches)
+              << " ns per search (checksum " << checksum << ")" << std::endl;
+}
+
+/// @brief registers the segments in a random order and searches pointers into all of them, the last registered ids
+/// are the worst case of the linear scan
+void PerformBenchmark(const uint64_t numberOfSegments)
+{
+    std::vector<uint8_t> memory(numberOfSegments * SEGMENT_SIZE);
+
+    // too large for the stack
+    std::unique_ptr<Repository_t> repository{new Repository_t()};
+    LinearScan linearScan;
+
+    for (uint64_t i = 0U; i < numberOfSegments; ++i)
+    {
+        // spread the segments over the memory in a different order than their ids
+        const uint64_t segment = (i * 7919U) % numberOfSegments;
+        const Id_t id = i + 1U;
+        repository->registerPtr(id, &memory[segment * SEGMENT_SIZE], SEGMENT_SIZE);
+        linearScan.registerPtr(id, &memory[segment * SEGMENT_SIZE], SEGMENT_SIZE);
+    }
+
+    std::vector<Ptr_t> pointers;
+    for (uint64_t i = 0U; i < numberOfSegments; ++i)
+    {
+        pointers.push_back(&memory[i * SEGMENT_SIZE + (i * 13U) % SEGMENT_SIZE]);
+    }
+
+    constexpr uint64_t NUMBER_OF_SEARCHES{1000000U};
+    std::cout << numberOfSegments << " segments" << std::endl;
+    measure("linear scan", linearScan, pointers, NUMBER_OF_SEARCHES);
+    measure("pointer repository", *repository, pointers, NUMBER_OF_SEARCHES);
+}
+
+int main()
+{
+    PerformBenchmark(4U);
+    PerformBenchmark(100U);
+    PerformBenchmark(1000U);
+
+    return 0;
+}
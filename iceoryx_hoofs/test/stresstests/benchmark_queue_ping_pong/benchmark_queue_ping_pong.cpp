@@ -0,0 +1,293 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
+#include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
+#include "iceoryx_hoofs/internal/concurrent/spsc_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// @brief The benchmark forks a follower process which pops every value from the ping queue and pushes it back into
+/// the pong queue. The leader measures the round trip time. Both queues are placed in a memory region which is shared
+/// between the processes, like the chunk queues of iceoryx. The packed FiFo has the layout of the FiFo before the
+/// producer and consumer state were isolated and serves as reference. The VariantQueue and the SpscQueue are the
+/// two queues a subscriber can use, depending on the communication policy.
+
+constexpr uint64_t QUEUE_CAPACITY{128U};
+constexpr uint64_t STOP{0U};
+
+/// @brief busy waiting is only meaningful when leader and follower run in parallel, otherwise the waiting process
+/// would consume its whole time slice
+void waitForQueue() noexcept
+{
+    static const bool IS_SINGLE_CORE{std::thread::hardware_concurrency() <= 1U};
+    if (IS_SINGLE_CORE)
+    {
+        std::this_thread::yield();
+    }
+}
+
+/// @brief the FiFo without cache line isolation, the positions of producer and consumer share a cache line
+class PackedFiFo
+{
+  public:
+    bool push(const uint64_t value) noexcept
+    {
+        auto currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+        if (currentWritePosition == m_readPosition.load(std::memory_order_acquire) + QUEUE_CAPACITY)
+        {
+            return false;
+        }
+        m_data[currentWritePosition % QUEUE_CAPACITY] = value;
+        m_writePosition.store(currentWritePosition + 1U, std::memory_order_release);
+        return true;
+    }
+
+    iox::cxx::optional<uint64_t> pop() noexcept
+    {
+        auto currentReadPosition = m_readPosition.load(std::memory_order_relaxed);
+        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        {
+            return iox::cxx::nullopt;
+        }
+        auto value = m_data[currentReadPosition % QUEUE_CAPACITY];
+        m_readPosition.store(currentReadPosition + 1U, std::memory_order_release);
+        return value;
+    }
+
+  private:
+    uint64_t m_data[QUEUE_CAPACITY];
+    std::atomic<uint64_t> m_writePosition{0U};
+    std::atomic<uint64_t> m_readPosition{0U};
+};
+
+template <typename Queue>
+uint64_t popUntilAvailable(Queue& queue) noexcept
+{
+    iox::cxx::optional<uint64_t> value;
+    for (value = queue.pop(); !value.has_value(); value = queue.pop())
+    {
+        waitForQueue();
+    }
+    return value.value();
+}
+
+/// @brief adapts the different interfaces of the queues
+template <typename Queue>
+struct QueueAdapter
+{
+    static void push(Queue& queue, const uint64_t value) noexcept
+    {
+        while (!queue.push(value))
+        {
+            waitForQueue();
+        }
+    }
+
+    static uint64_t pop(Queue& queue) noexcept
+    {
+        return popUntilAvailable(queue);
+    }
+};
+
+template <>
+struct QueueAdapter<iox::concurrent::SoFi<uint64_t, QUEUE_CAPACITY>>
+{
+    using Queue = iox::concurrent::SoFi<uint64_t, QUEUE_CAPACITY>;
+
+    static void push(Queue& queue, const uint64_t value) noexcept
+    {
+        uint64_t overflowValue{0U};
+        queue.push(value, overflowValue);
+    }
+
+    static uint64_t pop(Queue& queue) noexcept
+    {
+        uint64_t value{0U};
+        while (!queue.pop(value))
+        {
+            waitForQueue();
+        }
+        return value;
+    }
+};
+
+template <>
+struct QueueAdapter<iox::concurrent::ResizeableLockFreeQueue<uint64_t, QUEUE_CAPACITY>>
+{
+    using Queue = iox::concurrent::ResizeableLockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+
+    static void push(Queue& queue, const uint64_t value) noexcept
+    {
+        while (!queue.tryPush(value))
+        {
+            waitForQueue();
+        }
+    }
+
+    static uint64_t pop(Queue& queue) noexcept
+    {
+        return popUntilAvailable(queue);
+    }
+};
+
+/// @brief the queues which are configured at runtime are wrapped to be default constructible
+template <typename Queue, typename QueueArgument, QueueArgument Argument>
+struct ConfiguredQueue : public Queue
+{
+    ConfiguredQueue() noexcept
+        : Queue(Argument)
+    {
+    }
+};
+
+template <iox::cxx::VariantQueueTypes QueueType>
+using ConfiguredVariantQueue = ConfiguredQueue<iox::cxx::VariantQueue<uint64_t, QUEUE_CAPACITY>,
+                                               iox::cxx::VariantQueueTypes,
+                                               QueueType>;
+
+template <iox::concurrent::SpscQueueOverflowPolicy OverflowPolicy>
+using ConfiguredSpscQueue = ConfiguredQueue<iox::concurrent::SpscQueue<uint64_t, QUEUE_CAPACITY>,
+                                            iox::concurrent::SpscQueueOverflowPolicy,
+                                            OverflowPolicy>;
+
+/// @brief push returns the dropped value on an overflow, the ping pong never overflows
+template <typename Queue, typename QueueArgument, QueueArgument Argument>
+struct QueueAdapter<ConfiguredQueue<Queue, QueueArgument, Argument>>
+{
+    static void push(Queue& queue, const uint64_t value) noexcept
+    {
+        while (queue.push(value).has_value())
+        {
+            waitForQueue();
+        }
+    }
+
+    static uint64_t pop(Queue& queue) noexcept
+    {
+        return popUntilAvailable(queue);
+    }
+};
+
+template <typename Queue>
+struct PingPongQueues
+{
+    Queue ping;
+    Queue pong;
+};
+
+template <typename Queue>
+void benchmark(const char* queueName, const uint64_t numberOfRoundTrips)
+{
+    using Adapter = QueueAdapter<Queue>;
+
+    void* sharedMemory = mmap(nullptr,
+                              sizeof(PingPongQueues<Queue>),
+                              PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_ANONYMOUS,
+                              -1,
+                              0);
+    if (sharedMemory == MAP_FAILED)
+    {
+        std::cerr << "Unable to map the shared memory for the queues" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    auto queues = new (sharedMemory) PingPongQueues<Queue>();
+
+    auto follower = fork();
+    if (follower == -1)
+    {
+        std::cerr << "Unable to fork the follower process" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (follower == 0)
+    {
+        uint64_t value{0U};
+        do
+        {
+            value = Adapter::pop(queues->ping);
+            Adapter::push(queues->pong, value);
+        } while (value != STOP);
+        _exit(EXIT_SUCCESS);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 1U; i <= numberOfRoundTrips; ++i)
+    {
+        Adapter::push(queues->ping, i);
+        if (Adapter::pop(queues->pong) != i)
+        {
+            std::cerr << "Received an unexpected value" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    Adapter::push(queues->ping, STOP);
+    Adapter::pop(queues->pong);
+    waitpid(follower, nullptr, 0);
+
+    queues->~PingPongQueues<Queue>();
+    munmap(sharedMemory, sizeof(PingPongQueues<Queue>));
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    std::cout << std::setw(34) << queueName << " [ " << std::setw(5) << sizeof(Queue) << " bytes ] "
+              << std::setw(10) << std::fixed << std::setprecision(1)
+              << static_cast<double>(nanoseconds) / static_cast<double>(numberOfRoundTrips) << " ns per round trip"
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfRoundTrips{1000000U};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfRoundTrips))
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of round trips]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    benchmark<PackedFiFo>("FiFo (packed reference)", numberOfRoundTrips);
+    benchmark<iox::concurrent::FiFo<uint64_t, QUEUE_CAPACITY>>("FiFo", numberOfRoundTrips);
+    benchmark<iox::concurrent::SoFi<uint64_t, QUEUE_CAPACITY>>("SoFi", numberOfRoundTrips);
+    benchmark<iox::concurrent::ResizeableLockFreeQueue<uint64_t, QUEUE_CAPACITY>>("ResizeableLockFreeQueue",
+                                                                                  numberOfRoundTrips);
+
+    using iox::cxx::VariantQueueTypes;
+    using iox::concurrent::SpscQueueOverflowPolicy;
+    benchmark<ConfiguredVariantQueue<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>>("VariantQueue (FiFo)",
+                                                                                             numberOfRoundTrips);
+    benchmark<ConfiguredVariantQueue<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>>("VariantQueue (SoFi)",
+                                                                                             numberOfRoundTrips);
+    benchmark<ConfiguredSpscQueue<SpscQueueOverflowPolicy::REJECT_NEW_VALUE>>("SpscQueue (reject new value)",
+                                                                               numberOfRoundTrips);
+    benchmark<ConfiguredSpscQueue<SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE>>("SpscQueue (discard oldest value)",
+                                                                                   numberOfRoundTrips);
+
+    return EXIT_SUCCESS;
+}
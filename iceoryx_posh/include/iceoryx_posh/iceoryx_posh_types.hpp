@@ -27,6 +27,7 @@
 #include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -115,12 +116,14 @@ constexpr uint8_t MAX_NUMBER_OF_EVENT_VARIABLES = 128U;
 constexpr uint8_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = 128U;
 static_assert(MAX_NUMBER_OF_EVENTS_PER_LISTENER <= MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE,
               "The Listener capacity is restricted by the maximum amount of notifiers per condition variable.");
+constexpr uint32_t MAX_NUMBER_OF_WORKERS_PER_LISTENER = 8U;
 //--------- Communication Resources End---------------------
 
 constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128U;
 
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32U;
+constexpr uint32_t MAX_CHUNKS_IN_CHUNK_CACHE = 16U;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
@@ -132,9 +135,13 @@ constexpr uint32_t CHUNK_NO_USER_HEADER_ALIGNMENT{1U};
 
 // Message Queue
 constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
-constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
+/// @note the messages are large enough to request multiple ports with one IpcMessageType::CREATE_PORTS message
+constexpr uint32_t ROUDI_MESSAGE_SIZE = 2048U;
+/// @note RouDi versions without IpcMessageType::CREATE_PORTS receive messages of at most this size; longer messages
+/// are not answered with IpcMessageType::MESSAGE_NOT_SUPPORTED by them
+constexpr uint32_t LEGACY_ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
-constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+constexpr uint32_t APP_MESSAGE_SIZE = 2048U;
 
 
 // Processes
@@ -166,7 +173,7 @@ enum class ConnectionState : uint32_t
 {
     NOT_CONNECTED = 0,
     CONNECT_REQUESTED,
-    CONNNECTED,
+    CONNECTED,
     DISCONNECT_REQUESTED,
     WAIT_FOR_OFFER
 };
@@ -182,6 +189,10 @@ struct DefaultChunkDistributorConfig
 struct DefaultChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    /// @brief with the OneToManyPolicy a subscriber is connected to at most one publisher, therefore its queue has a
+    /// single producer and does not need the runtime dispatch of the VariantQueue
+    static constexpr bool HAS_SINGLE_PRODUCER =
+        std::is_same<build::CommunicationPolicy, build::OneToManyPolicy>::value;
 };
 
 // alias for cxx::string
@@ -0,0 +1,59 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Caches free chunks of a single mempool for one user, e.g. a publisher port, which are acquired from and
+/// returned to the free-lists of the MemoryManager in batches. This reduces the contention on the free-lists when
+/// multiple threads allocate chunks with a high rate. The cache resides in the shared memory to be able to return
+/// the cached chunks when the owning process terminates unexpectedly.
+/// @note The cached chunks are reported as used by the mempool. They must be returned with
+/// MemoryManager::releaseChunkCache before the cache is destroyed.
+/// @note Not thread-safe, the cache must only be used by one thread at a time
+struct ChunkCache
+{
+    /// @brief Creates an empty cache
+    /// @param[in] capacity the number of chunks which are acquired at once, is limited to MAX_CHUNKS_IN_CHUNK_CACHE;
+    /// a capacity of zero disables the cache
+    explicit ChunkCache(const uint32_t capacity = 0U) noexcept;
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache(ChunkCache&&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+    ChunkCache& operator=(ChunkCache&&) = delete;
+    ~ChunkCache() noexcept = default;
+
+    const uint32_t m_capacity{0U};
+    uint32_t m_size{0U};
+    rp::RelativePointer<MemPool> m_memPool;
+    MemPool::freeList_t::Index_t m_chunkIndices[MAX_CHUNKS_IN_CHUNK_CACHE];
+    MemPool::freeList_t::Index_t m_chunkManagementIndices[MAX_CHUNKS_IN_CHUNK_CACHE];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CACHE_HPP
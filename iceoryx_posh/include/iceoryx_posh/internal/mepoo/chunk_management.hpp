@@ -46,6 +46,9 @@ struct ChunkManagement
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::rp::RelativePointer<MemPool> m_mempool;
     iox::rp::RelativePointer<MemPool> m_chunkManagementPool;
+    /// @brief the management of the next chunk of a chunk chain, the following chunks are owned by the first chunk of
+    /// the chain and released together with it
+    iox::rp::RelativePointer<ChunkManagement> m_nextChainedChunk;
 };
 } // namespace mepoo
 } // namespace iox
@@ -36,12 +36,15 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t numFallbackChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// number of chunks which were acquired from a larger mempool since this one was exhausted
+    uint64_t m_numFallbackChunks{0};
 };
 
 class MemPool
@@ -61,14 +64,37 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief Acquires multiple chunks with a single access to the free-list
+    /// @param[out] chunkIndices memory for at least maxNumberOfChunks indices of the acquired chunks
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to acquire
+    /// @return the number of acquired chunks
+    uint32_t getChunkIndices(cxx::not_null<freeList_t::Index_t*> chunkIndices,
+                             const uint32_t maxNumberOfChunks) noexcept;
+
+    /// @brief Converts the index of a chunk acquired with getChunkIndices to the chunk
+    /// @param[in] chunkIndex the index of the chunk
+    /// @return pointer to the chunk
+    void* getChunkFromIndex(const freeList_t::Index_t chunkIndex) const noexcept;
+
     uint32_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint64_t getNumFallbackChunks() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Records that a chunk was acquired from a larger mempool since this one was exhausted
+    void increaseNumFallbackChunks() noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Returns multiple chunks acquired with getChunkIndices with a single access to the free-list
+    /// @param[in] chunkIndices the indices of the chunks to free
+    /// @param[in] numberOfChunks the number of chunks to free
+    void freeChunkIndices(cxx::not_null<const freeList_t::Index_t*> chunkIndices,
+                          const uint32_t numberOfChunks) noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -84,6 +110,7 @@ class MemPool
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
+    std::atomic<uint64_t> m_numFallbackChunks{0U};
 
     freeList_t m_freeIndices;
 };
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
@@ -46,6 +47,9 @@ class MemoryManager
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
 
   public:
+    /// @brief the maximum number of chunks a chained user-payload is split into
+    static constexpr uint32_t MAX_NUMBER_OF_CHAINED_CHUNKS{16U};
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -59,6 +63,27 @@ class MemoryManager
 
     SharedChunk getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Acquires a chunk from the provided cache, which is refilled in a batch from the best fitting mempool when
+    /// it is empty. If the cache is disabled or the mempool is exhausted, the chunk is acquired like with getChunk
+    /// @param[in] chunkSettings the settings of the chunk to acquire
+    /// @param[in] chunkCache the cache of the caller
+    /// @return the acquired chunk or a nullptr SharedChunk if no chunk could be acquired
+    SharedChunk getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
+    /// @brief Acquires a chunk like getChunk if the user-payload fits into a mempool. Otherwise the user-payload is
+    /// split into a chain of chunks from the available mempools, starting with the largest one; if a mempool is
+    /// exhausted, the next smaller one is used. The chain is planned with the free chunks of the mempools before any
+    /// chunk is acquired and consists of at most MAX_NUMBER_OF_CHAINED_CHUNKS chunks. The first chunk carries the
+    /// user-header and the ChunkHeaders are linked with ChunkHeader::nextChainedChunk
+    /// @param[in] chunkSettings the settings of the chunk to acquire; the user-payload size is the size of the chain
+    /// @return the first chunk of the chain which owns the whole chain or a nullptr SharedChunk if not enough chunks
+    /// are available
+    SharedChunk getChainedChunk(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Returns all chunks in the cache to their mempool
+    /// @param[in] chunkCache the cache to empty
+    void releaseChunkCache(ChunkCache& chunkCache) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -77,10 +102,21 @@ class MemoryManager
                     const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
 
+    /// @brief Searches the smallest mempool which can hold a chunk of the required size
+    /// @param[in] requiredChunkSize the size of the chunk including the ChunkHeader
+    /// @return index of the best fitting mempool or the number of mempools if all chunks are too small
+    uint32_t getIndexOfBestFittingMemPool(const uint32_t requiredChunkSize) const noexcept;
+
+    void refillChunkCache(ChunkCache& chunkCache) noexcept;
+
   private:
     bool m_denyAddMemPool{false};
+    bool m_fallbackToLargerMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
 
+    /// the chunk sizes of the mempools in increasing order, stored contiguously so that the lookup for the best
+    /// fitting mempool does not need to touch the mempools themselves
+    cxx::vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> m_chunkSizeLookupTable;
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
 };
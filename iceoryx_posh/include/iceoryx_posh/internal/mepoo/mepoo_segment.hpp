@@ -37,7 +37,8 @@ class MePooSegment
                  posix::Allocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const posix::MappingOptions& mappingOptions = posix::MappingOptions()) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -46,9 +47,24 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    const posix::MappingOptions& getMappingOptions() const noexcept;
+
+    /// @brief returns the name of the shared memory of a segment; segments of the same writer group which are bound
+    /// to different NUMA nodes are distinguished by the node
+    static posix::SharedMemory::Name_t getSharedMemoryName(const posix::PosixGroup& writerGroup,
+                                                           const posix::MappingOptions& mappingOptions) noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const posix::MappingOptions& mappingOptions) noexcept;
+
+    void applyAccessControlList(const posix::PosixGroup& readerGroup, const posix::PosixGroup& writerGroup) noexcept;
+
+    /// @brief a hugetlbfs does not support access control lists, therefore the file of an explicit huge pages segment
+    /// is assigned to the writer group with the plain POSIX rights; a separate reader group cannot be granted access
+    void applyPermissionsWithoutAccessControlList(const posix::PosixGroup& readerGroup,
+                                                  const posix::PosixGroup& writerGroup) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -57,6 +73,7 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    posix::MappingOptions m_mappingOptions;
 
   private:
     void setSegmentId(const uint64_t segmentId) noexcept;
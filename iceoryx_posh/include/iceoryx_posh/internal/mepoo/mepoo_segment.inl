@@ -17,8 +17,12 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -33,11 +37,31 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     posix::Allocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const posix::MappingOptions& mappingOptions) noexcept
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup, mappingOptions)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_mappingOptions(mappingOptions)
+{
+    using namespace posix;
+    if (hugePageSize(mappingOptions.pageType) != 0U)
+    {
+        applyPermissionsWithoutAccessControlList(readerGroup, writerGroup);
+    }
+    else
+    {
+        applyAccessControlList(readerGroup, writerGroup);
+    }
+
+    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, *m_sharedMemoryObject.getAllocator());
+    m_sharedMemoryObject.finalizeAllocation();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessControlList(
+    const posix::PosixGroup& readerGroup, const posix::PosixGroup& writerGroup) noexcept
 {
     using namespace posix;
     AccessController accessController;
@@ -56,29 +80,55 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     {
         errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
+}
 
-    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, *m_sharedMemoryObject.getAllocator());
-    m_sharedMemoryObject.finalizeAllocation();
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyPermissionsWithoutAccessControlList(
+    const posix::PosixGroup& readerGroup, const posix::PosixGroup& writerGroup) noexcept
+{
+    if (!(readerGroup == writerGroup))
+    {
+        LogError() << "The segment of the writer group '" << writerGroup.getName().c_str()
+                   << "' uses explicit huge pages, a hugetlbfs does not support access control lists and therefore "
+                      "no separate reader group '"
+                   << readerGroup.getName().c_str() << "'";
+        errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        return;
+    }
+
+    const auto fileHandle = m_sharedMemoryObject.getFileHandle();
+    if (posix::posixCall(fchown)(fileHandle, static_cast<uid_t>(-1), writerGroup.getID())
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error()
+        || posix::posixCall(fchmod)(fileHandle, static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP))
+               .failureReturnValue(-1)
+               .evaluate()
+               .has_error())
+    {
+        LogError() << "Unable to grant the writer group '" << writerGroup.getName().c_str()
+                   << "' access to the huge pages segment";
+        errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+    }
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const posix::MappingOptions& mappingOptions) noexcept
 {
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
 
-    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
-    constexpr char SHARED_MEMORY_NAME_PREFIX[] = "/";
-    posix::SharedMemory::Name_t shmName = SHARED_MEMORY_NAME_PREFIX + writerGroup.getName();
-
     return std::move(
-        SharedMemoryObjectType::create(shmName,
+        SharedMemoryObjectType::create(getSharedMemoryName(writerGroup, mappingOptions),
                                        MemoryManager::requiredChunkMemorySize(mempoolConfig),
                                        posix::AccessMode::READ_WRITE,
                                        posix::OwnerShip::MINE,
                                        BASE_ADDRESS_HINT,
-                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP))
+                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                       mappingOptions)
             .and_then([this](auto& sharedMemoryObject) {
                 this->setSegmentId(iox::rp::BaseRelativePointer::registerPtr(sharedMemoryObject.getBaseAddress(),
                                                                              sharedMemoryObject.getSizeInBytes()));
@@ -122,6 +172,29 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const posix::MappingOptions&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMappingOptions() const noexcept
+{
+    return m_mappingOptions;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline posix::SharedMemory::Name_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName(
+    const posix::PosixGroup& writerGroup, const posix::MappingOptions& mappingOptions) noexcept
+{
+    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
+    constexpr char SHARED_MEMORY_NAME_PREFIX[] = "/";
+    posix::SharedMemory::Name_t shmName = SHARED_MEMORY_NAME_PREFIX + writerGroup.getName();
+    if (mappingOptions.numaNode != posix::ANY_NUMA_NODE)
+    {
+        shmName.append(cxx::TruncateToCapacity, "_numa");
+        shmName.append(cxx::TruncateToCapacity,
+                       cxx::string<10U>(cxx::TruncateToCapacity, cxx::convert::toString(mappingOptions.numaNode)));
+    }
+    return shmName;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
@@ -59,13 +59,15 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       const posix::MappingOptions& mappingOptions = posix::MappingOptions()) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
+            , m_mappingOptions(mappingOptions)
 
         {
         }
@@ -76,6 +78,7 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        posix::MappingOptions m_mappingOptions;
     };
 
     struct SegmentUserInformation
@@ -87,7 +90,13 @@ class SegmentManager
     using SegmentMappingContainer = cxx::vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
-    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
+    /// @brief returns the memory manager of a segment the user has write access to
+    /// @param[in] user the user of the process which wants to write into the segment
+    /// @param[in] numaNode the NUMA node the writer runs on; a segment bound to this node is preferred over the other
+    /// writable segments of the user
+    SegmentUserInformation
+    getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user,
+                                                const uint32_t numaNode = posix::ANY_NUMA_NODE) noexcept;
 
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
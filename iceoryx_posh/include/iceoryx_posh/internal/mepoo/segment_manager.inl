@@ -43,8 +43,12 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_mappingOptions);
 }
 
 template <typename SegmentType>
@@ -55,7 +59,6 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
     auto groupContainer = user.getGroups();
 
     SegmentManager::SegmentMappingContainer mappingContainer;
-    bool foundInWriterGroup = false;
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
@@ -64,16 +67,21 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
         {
             if (segment.getWriterGroup() == groupID)
             {
-                // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
+                // a user is allowed to be only in one writer group per NUMA node, as the memory manager for the
+                // publishers of a process is chosen by the NUMA node the process runs on
+                auto numaNode = segment.getMappingOptions().numaNode;
+                if (std::find_if(mappingContainer.begin(), mappingContainer.end(), [&](const SegmentMapping& mapping) {
+                        return mapping.m_isWritable && mapping.m_mappingOptions.numaNode == numaNode;
+                    }) == mappingContainer.end())
                 {
-                    mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
-                                                  segment.getSharedMemoryObject().getBaseAddress(),
-                                                  segment.getSharedMemoryObject().getSizeInBytes(),
-                                                  true,
-                                                  segment.getSegmentId());
-                    foundInWriterGroup = true;
+                    mappingContainer.emplace_back(
+                        SegmentType::getSharedMemoryName(segment.getWriterGroup(), segment.getMappingOptions()),
+                        segment.getSharedMemoryObject().getBaseAddress(),
+                        segment.getSharedMemoryObject().getSizeInBytes(),
+                        true,
+                        segment.getSegmentId(),
+                        iox::mepoo::MemoryInfo(),
+                        segment.getMappingOptions());
                 }
                 else
                 {
@@ -93,11 +101,14 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                        return mapping.m_startAddress == segment.getSharedMemoryObject().getBaseAddress();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
-                                              segment.getSharedMemoryObject().getBaseAddress(),
-                                              segment.getSharedMemoryObject().getSizeInBytes(),
-                                              false,
-                                              segment.getSegmentId());
+                mappingContainer.emplace_back(
+                    SegmentType::getSharedMemoryName(segment.getWriterGroup(), segment.getMappingOptions()),
+                    segment.getSharedMemoryObject().getBaseAddress(),
+                    segment.getSharedMemoryObject().getSizeInBytes(),
+                    false,
+                    segment.getSegmentId(),
+                    iox::mepoo::MemoryInfo(),
+                    segment.getMappingOptions());
             }
         }
     }
@@ -107,22 +118,31 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
 
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
-SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept
+SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user,
+                                                                         const uint32_t numaNode) noexcept
 {
     auto groupContainer = user.getGroups();
 
     SegmentUserInformation segmentInfo{cxx::nullopt_t(), 0u};
 
-    // with the groups we can search for the writable segment of this user
+    // with the groups we can search for the writable segment of this user; a segment on the requested NUMA node is
+    // preferred, otherwise the first writable segment is used
     for (const auto& groupID : groupContainer)
     {
         for (auto& segment : m_segmentContainer)
         {
             if (segment.getWriterGroup() == groupID)
             {
-                segmentInfo.m_memoryManager = segment.getMemoryManager();
-                segmentInfo.m_segmentID = segment.getSegmentId();
-                return segmentInfo;
+                const bool isOnRequestedNode = (segment.getMappingOptions().numaNode == numaNode);
+                if (!segmentInfo.m_memoryManager.has_value() || isOnRequestedNode)
+                {
+                    segmentInfo.m_memoryManager = segment.getMemoryManager();
+                    segmentInfo.m_segmentID = segment.getSegmentId();
+                }
+                if (isOnRequestedNode)
+                {
+                    return segmentInfo;
+                }
             }
         }
     }
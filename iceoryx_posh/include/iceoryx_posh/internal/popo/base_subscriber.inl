@@ -91,6 +91,14 @@ inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscrib
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                   const uint32_t maxNumberOfChunks) noexcept
+{
+    return m_port.tryGetChunks(chunkHeaders, maxNumberOfChunks);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -47,12 +48,13 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The stored queues are double buffered. Delivering chunks reads a stable snapshot of the queues without taking the
+/// lock, while adding and removing queues prepares the next snapshot under the lock and switches to it afterwards.
+/// Therefore the sending of chunks is not serialized with the changes of the queues, e.g. done by RouDi.
 /// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
+/// For the history, a container is used which is not thread safe. Therefore we use an inter-process mutex. But this
+/// can lead to deadlocks if a user process gets terminated while one of its threads updates the history and holds
+/// the lock.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
 /// terminated user application. Even if access from middleware and user threads do not overlap, the history
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
@@ -65,6 +67,7 @@ class ChunkDistributor
     using MemberType_t = ChunkDistributorDataType;
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
+    using QueueContainer_t = typename ChunkDistributorDataType::QueueContainer_t;
 
     explicit ChunkDistributor(cxx::not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
@@ -96,10 +99,17 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. Queues with a decimation or a minimum delivery interval skip the chunk without being touched
     /// @param[in] shared chunk to be delivered
     void deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in the given order to all the stored chunk queues. The consumer of
+    /// each queue is notified once for all chunks. The chunks will be added to the chunk history
+    /// @param[in] chunks the shared chunks to be delivered
+    /// @param[in] numberOfChunks the number of chunks to be delivered
+    void deliverToAllStoredQueues(cxx::not_null<const mepoo::SharedChunk*> chunks,
+                                  const uint64_t numberOfChunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the provided chunk queue. The chunk will NOT be added to the chunk
     /// history
     /// @param[in] chunk queue to which this chunk shall be delivered
@@ -107,6 +117,14 @@ class ChunkDistributor
     /// @return false if a queue overflow occured, otherwise true
     bool deliverToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk to the stored chunk queue with the provided unique id. The chunk will
+    /// NOT be added to the chunk history. If the queue overflows, the chunk is lost for this queue
+    /// @param[in] uniqueQueueId the unique id of the chunk queue to which this chunk shall be delivered
+    /// @param[in] chunk the shared chunk to be delivered
+    /// @return ChunkDistributorError::QUEUE_NOT_IN_CONTAINER if no stored queue has this unique id, success otherwise
+    cxx::expected<ChunkDistributorError> deliverToQueue(const UniquePortId uniqueQueueId,
+                                                        mepoo::SharedChunk chunk) noexcept;
+
     /// @brief Update the chunk history but do not deliver the chunk to any chunk queue. E.g. use case is to to update a
     /// non offered field in ara
     /// @param[in] shared chunk add to the chunk history
@@ -126,11 +144,64 @@ class ChunkDistributor
     /// @brief cleanup the used shrared memory chunks
     void cleanup() noexcept;
 
+    /// @brief Get the accumulated time deliverToAllStoredQueues was blocked by full queues with
+    /// SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER and QueueFullPolicy::BLOCK_PUBLISHER
+    /// @return accumulated blocking time
+    units::Duration getAccumulatedBlockingTime() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief Registers as reader of the currently active queue snapshot
+    /// @return index of the snapshot which can be read until releaseQueueSnapshot is called
+    uint64_t acquireQueueSnapshot() const noexcept;
+
+    /// @brief Unregisters as reader of a queue snapshot
+    /// @param[in] snapshotIndex index of the snapshot acquired with acquireQueueSnapshot
+    void releaseQueueSnapshot(const uint64_t snapshotIndex) const noexcept;
+
+    /// @brief Waits until the inactive queue snapshot has no readers and initializes it with the active one, must be
+    /// called with the lock held
+    /// @return the inactive queue snapshot which can be modified
+    QueueContainer_t& beginQueueSnapshotUpdate() noexcept;
+
+    /// @brief Makes the snapshot returned by beginQueueSnapshotUpdate the active one and wakes up the senders which
+    /// are blocked by a queue of the previous snapshot, must be called with the lock held
+    void commitQueueSnapshotUpdate() noexcept;
+
+    /// @brief Wakes up the senders which are blocked since the provided queue is full
+    /// @param[in] queue the queue the senders are waiting for
+    void wakeUpBlockedSenders(ChunkQueueData_t* const queue) noexcept;
+
+    /// @brief Waits until no sender reads the previous snapshot anymore, e.g. before a removed queue can be destroyed
+    void waitForReleaseOfPreviousQueueSnapshot() const noexcept;
+
+    /// @brief Waits until no sender reads the provided snapshot anymore. The readers are discarded with
+    /// Error::kPOPO__CHUNK_DISTRIBUTOR_QUEUE_SNAPSHOT_NOT_RELEASED_BY_SENDER after QUEUE_SNAPSHOT_RELEASE_TIMEOUT
+    /// @param[in] snapshotIndex index of the snapshot to wait for
+    void waitForReleaseOfQueueSnapshot(const uint64_t snapshotIndex) const noexcept;
+
+    /// @brief Adds the chunks to the history and registers as reader of the active queue snapshot under the lock
+    /// @param[in] chunks the shared chunks to add to the history
+    /// @param[in] numberOfChunks the number of chunks
+    /// @return index of the snapshot the chunks have to be delivered to
+    uint64_t addToHistoryAndAcquireQueueSnapshot(cxx::not_null<const mepoo::SharedChunk*> chunks,
+                                                 const uint64_t numberOfChunks) noexcept;
+
+    /// @brief Sleeps until the full queues with QueueFullPolicy::BLOCK_PUBLISHER have space available and delivers
+    /// the chunk to them. If the maximum blocking time is exceeded, the chunk is lost for the remaining queues
+    /// @param[in] remainingQueues the queues which could not yet be served
+    /// @param[in] chunk the shared chunk to deliver
+    /// @param[in] applyDeliveryFilter true if the chunk was not yet offered to the delivery filter of the queues
+    /// @param[in] blockingStart the start of the delivery, the maximum blocking time is measured from it
+    /// @return true if the maximum blocking time was exceeded and the chunk was lost for the remaining queues
+    bool waitForRemainingQueues(QueueContainer_t& remainingQueues,
+                                mepoo::SharedChunk chunk,
+                                bool applyDeliveryFilter,
+                                const mepoo::BaseClock_t::time_point blockingStart) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
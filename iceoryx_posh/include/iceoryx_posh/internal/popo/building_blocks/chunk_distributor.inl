@@ -49,19 +49,16 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
+    const auto& queues = getMembers()->m_queueSnapshots[getMembers()->m_activeQueueSnapshot.load()];
+    const auto alreadyKnownReceiver = std::find_if(queues.begin(), queues.end(), [&](const auto& queue) {
+        return queue.get() == queueToAdd;
+    });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == queues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() < queues.capacity())
         {
-            // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
-            getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
-
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
             if (requestedHistory > getMembers()->m_historyCapacity)
@@ -79,6 +76,13 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                 deliverToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            // the queue is made visible to the senders after the history was delivered, this ensures that the history
+            // is received before any new chunk
+            auto& updatedQueues = beginQueueSnapshotUpdate();
+            // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
+            updatedQueues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+            commitQueueSnapshotUpdate();
+
             return cxx::success<void>();
         }
         else
@@ -100,11 +104,20 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    const auto& queues = getMembers()->m_queueSnapshots[getMembers()->m_activeQueueSnapshot.load()];
+    const auto isStored = std::any_of(
+        queues.begin(), queues.end(), [&](const auto& queue) { return queue.get() == queueToRemove; });
+    if (isStored)
     {
+        auto& updatedQueues = beginQueueSnapshotUpdate();
+        const auto iter = std::find_if(updatedQueues.begin(), updatedQueues.end(), [&](const auto& queue) {
+            return queue.get() == queueToRemove;
+        });
         // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        updatedQueues.erase(iter);
+        commitQueueSnapshotUpdate();
+        // the queue must not be accessed by a sender anymore when we return since it could be destroyed afterwards
+        waitForReleaseOfPreviousQueueSnapshot();
 
         return cxx::success<void>();
     }
@@ -119,15 +132,19 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    beginQueueSnapshotUpdate().clear();
+    commitQueueSnapshotUpdate();
+    waitForReleaseOfPreviousQueueSnapshot();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto snapshotIndex = acquireQueueSnapshot();
+    const bool hasQueues = !getMembers()->m_queueSnapshots[snapshotIndex].empty();
+    releaseQueueSnapshot(snapshotIndex);
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
@@ -135,13 +152,20 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
 {
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto snapshotIndex = addToHistoryAndAcquireQueueSnapshot(&chunk, 1U);
 
         bool willWaitForSubscriber =
             getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
         {
+            // a chunk which is skipped by the decimation or the rate limit of the queue never touches the queue and
+            // does not wake up the consumer
+            if (!ChunkQueuePusher_t(queue.get()).shouldDeliverNextChunk())
+            {
+                continue;
+            }
+
             bool isBlockingQueue =
                 (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
 
@@ -157,47 +181,196 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                 }
             }
         }
+
+        releaseQueueSnapshot(snapshotIndex);
+    }
+
+    if (!remainingQueues.empty())
+    {
+        waitForRemainingQueues(remainingQueues, chunk, false, mepoo::BaseClock_t::now());
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(cxx::not_null<const mepoo::SharedChunk*> chunks,
+                                                                     const uint64_t numberOfChunks) noexcept
+{
+    QueueContainer_t remainingQueues;
+    cxx::vector<uint64_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> firstUndeliveredChunks;
+    {
+        const auto snapshotIndex = addToHistoryAndAcquireQueueSnapshot(chunks, numberOfChunks);
+
+        bool willWaitForSubscriber =
+            getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+        // send all chunks to one queue before continuing with the next one to notify each consumer only once
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+        {
+            bool isBlockingQueue =
+                (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
+
+            ChunkQueuePusher_t pusher(queue.get());
+            bool hasPushedChunks = false;
+            for (uint64_t i = 0U; i < numberOfChunks; ++i)
+            {
+                if (!pusher.shouldDeliverNextChunk())
+                {
+                    continue;
+                }
+
+                hasPushedChunks = true;
+                if (!pusher.pushWithoutNotification(chunks[i]))
+                {
+                    if (isBlockingQueue)
+                    {
+                        // the remaining chunks are delivered after all other queues are served to keep the order
+                        remainingQueues.emplace_back(queue);
+                        firstUndeliveredChunks.emplace_back(i);
+                        break;
+                    }
+                    else
+                    {
+                        pusher.lostAChunk();
+                    }
+                }
+            }
+
+            if (hasPushedChunks)
+            {
+                pusher.notify();
+            }
+        }
+
+        releaseQueueSnapshot(snapshotIndex);
     }
 
-    // busy waiting until every queue is served
+    // the maximum blocking time applies to the whole batch and not to every single chunk
+    const auto blockingStart = mepoo::BaseClock_t::now();
+    for (uint64_t k = 0U; k < remainingQueues.size(); ++k)
+    {
+        for (uint64_t i = firstUndeliveredChunks[k]; i < numberOfChunks; ++i)
+        {
+            QueueContainer_t remainingQueue;
+            remainingQueue.emplace_back(remainingQueues[k]);
+            // the first undelivered chunk already passed the delivery filter, the following ones were not yet offered
+            const bool applyDeliveryFilter = (i != firstUndeliveredChunks[k]);
+            if (waitForRemainingQueues(remainingQueue, chunks[i], applyDeliveryFilter, blockingStart))
+            {
+                // the queue is already marked as having lost chunks, the remaining chunks of the batch are dropped
+                // for it instead of waiting again
+                break;
+            }
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::waitForRemainingQueues(
+    QueueContainer_t& remainingQueues,
+    mepoo::SharedChunk chunk,
+    bool applyDeliveryFilter,
+    const mepoo::BaseClock_t::time_point blockingStart) noexcept
+{
+    const auto waitingStart = mepoo::BaseClock_t::now();
+    bool hasTimedOut = false;
+    const auto maxBlockingTime = std::chrono::nanoseconds(getMembers()->m_maxBlockingTime.toNanoseconds());
+    const bool hasBlockingTimeLimit = maxBlockingTime.count() != 0;
+
     while (!remainingQueues.empty())
     {
-        std::this_thread::yield();
+        const auto snapshotIndex = acquireQueueSnapshot();
+        const auto& queues = getMembers()->m_queueSnapshots[snapshotIndex];
+
+        // only deliver to the remaining queues which are still part of the current snapshot
+        // reason: it is possible that since the last iteration some subscriber have already unsubscribed
+        //          and without this check we would deliver to dead queues
+        auto isStillStored = [&](const ChunkQueueData_t* const remainingQueue) {
+            return std::any_of(
+                queues.begin(), queues.end(), [&](const auto& queue) { return queue.get() == remainingQueue; });
+        };
+        auto remainingEnd = std::remove_if(remainingQueues.begin(), remainingQueues.end(), [&](const auto& queue) {
+            return !isStillStored(queue.get());
+        });
+        remainingQueues.resize(static_cast<uint64_t>(remainingEnd - remainingQueues.begin()));
+
+        // the queues are only accessed while they are part of a snapshot, therefore the filter is applied here once
+        if (applyDeliveryFilter)
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end());
-            std::sort(remainingQueues.begin(), remainingQueues.end());
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin());
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            remainingEnd = std::remove_if(remainingQueues.begin(), remainingQueues.end(), [&](const auto& queue) {
+                return !ChunkQueuePusher_t(queue.get()).shouldDeliverNextChunk();
+            });
+            remainingQueues.resize(static_cast<uint64_t>(remainingEnd - remainingQueues.begin()));
+            applyDeliveryFilter = false;
+        }
+
+        if (!remainingQueues.empty())
+        {
+            // the delivery is retried after announcing the wait to not miss the notification of the receiver
+            ChunkQueueData_t* const queueToWaitFor = remainingQueues.front().get();
+            queueToWaitFor->m_numberOfBlockedSenders.fetch_add(1U, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            remainingEnd = std::remove_if(remainingQueues.begin(), remainingQueues.end(), [&](const auto& queue) {
+                return deliverToQueue(queue.get(), chunk);
+            });
+            remainingQueues.resize(static_cast<uint64_t>(remainingEnd - remainingQueues.begin()));
+
+            // if the snapshot was switched in the meantime, the sender which changed it might not have seen our
+            // announcement and we would sleep while it waits for us to release the snapshot
+            const bool needsToWait = std::any_of(remainingQueues.begin(),
+                                                 remainingQueues.end(),
+                                                 [&](const auto& queue) { return queue.get() == queueToWaitFor; })
+                                     && getMembers()->m_activeQueueSnapshot.load() == snapshotIndex;
+
+            if (needsToWait)
             {
-                if (deliverToQueue(remainingQueues[i].get(), chunk))
+                if (hasBlockingTimeLimit)
                 {
-                    remainingQueues.erase(remainingQueues.begin() + i);
+                    const auto elapsedTime = mepoo::BaseClock_t::now() - blockingStart;
+                    if (elapsedTime >= maxBlockingTime)
+                    {
+                        hasTimedOut = true;
+                    }
+                    else
+                    {
+                        const auto remainingTime =
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(maxBlockingTime - elapsedTime);
+                        queueToWaitFor->m_spaceAvailableSemaphore
+                            .timedWait(units::Duration::fromNanoseconds(remainingTime.count()))
+                            .or_else([](auto) {
+                                errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT, nullptr, ErrorLevel::FATAL);
+                            });
+                    }
                 }
+                else
+                {
+                    queueToWaitFor->m_spaceAvailableSemaphore.wait().or_else([](auto) {
+                        errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT, nullptr, ErrorLevel::FATAL);
+                    });
+                }
+            }
+
+            queueToWaitFor->m_numberOfBlockedSenders.fetch_sub(1U, std::memory_order_relaxed);
 
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
+            if (hasTimedOut)
+            {
+                for (auto& queue : remainingQueues)
                 {
-                    break;
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
                 }
+                remainingQueues.clear();
             }
         }
+
+        releaseQueueSnapshot(snapshotIndex);
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    const auto blockingTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now() - waitingStart);
+    getMembers()->m_accumulatedBlockingTimeInNanoseconds.fetch_add(static_cast<uint64_t>(blockingTime.count()),
+                                                                   std::memory_order_relaxed);
+
+    return hasTimedOut;
 }
 
 template <typename ChunkDistributorDataType>
@@ -207,6 +380,39 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline cxx::expected<ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniquePortId uniqueQueueId,
+                                                           mepoo::SharedChunk chunk) noexcept
+{
+    bool isStored{false};
+    {
+        const auto snapshotIndex = acquireQueueSnapshot();
+
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+        {
+            if (queue->m_uniqueId == uniqueQueueId)
+            {
+                isStored = true;
+                if (!deliverToQueue(queue.get(), chunk))
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                }
+                break;
+            }
+        }
+
+        releaseQueueSnapshot(snapshotIndex);
+    }
+
+    if (!isStored)
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
+
+    return cxx::success<void>();
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
@@ -226,6 +432,23 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::addToHistoryAndAcquireQueueSnapshot(
+    cxx::not_null<const mepoo::SharedChunk*> chunks, const uint64_t numberOfChunks) noexcept
+{
+    // tryAddQueue copies the history and publishes the new queue under the same lock, therefore a queue which is
+    // added concurrently receives the chunks either with the history or with the acquired snapshot, never twice and
+    // never not at all
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        addToHistoryWithoutDelivery(chunks[i]);
+    }
+
+    return acquireQueueSnapshot();
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
 {
@@ -259,6 +482,14 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     if (getMembers()->tryLock())
     {
         clearHistory();
+
+        // the owner of this ChunkDistributor is gone, a snapshot reader which was not released is a leftover of an
+        // application which terminated while delivering chunks
+        for (auto& readers : getMembers()->m_queueSnapshotReaders)
+        {
+            readers.store(0U);
+        }
+
         getMembers()->unlock();
     }
     else
@@ -273,6 +504,114 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() const noexcept
+{
+    while (true)
+    {
+        const auto snapshotIndex = getMembers()->m_activeQueueSnapshot.load();
+        getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+
+        // if the active snapshot was switched in the meantime, the writer might not have seen our reader registration
+        // and could already modify the snapshot, therefore retry with the new active snapshot
+        if (getMembers()->m_activeQueueSnapshot.load() == snapshotIndex)
+        {
+            return snapshotIndex;
+        }
+        getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshotIndex) const
+    noexcept
+{
+    getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+}
+
+template <typename ChunkDistributorDataType>
+inline typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::beginQueueSnapshotUpdate() noexcept
+{
+    const auto activeIndex = getMembers()->m_activeQueueSnapshot.load();
+    const auto inactiveIndex = (activeIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // wait until the senders which still read the previously active snapshot are done with it
+    waitForReleaseOfQueueSnapshot(inactiveIndex);
+
+    auto& snapshot = getMembers()->m_queueSnapshots[inactiveIndex];
+    snapshot = getMembers()->m_queueSnapshots[activeIndex];
+    return snapshot;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::commitQueueSnapshotUpdate() noexcept
+{
+    const auto previousIndex = getMembers()->m_activeQueueSnapshot.load();
+    getMembers()->m_activeQueueSnapshot.store((previousIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS);
+
+    // a sender which is blocked by a full queue holds the previous snapshot until there is space available; it is
+    // woken up to switch to the new snapshot, otherwise the next update or the removal of a queue would have to wait
+    // until the consumer of an unrelated queue catches up
+    if (getMembers()->m_queueSnapshotReaders[previousIndex].load() != 0U)
+    {
+        for (auto& queue : getMembers()->m_queueSnapshots[previousIndex])
+        {
+            wakeUpBlockedSenders(queue.get());
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::wakeUpBlockedSenders(ChunkQueueData_t* const queue) noexcept
+{
+    for (auto blockedSenders = queue->m_numberOfBlockedSenders.load(); blockedSenders > 0U; --blockedSenders)
+    {
+        queue->m_spaceAvailableSemaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT, nullptr, ErrorLevel::FATAL);
+        });
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForReleaseOfPreviousQueueSnapshot() const noexcept
+{
+    const auto activeIndex = getMembers()->m_activeQueueSnapshot.load();
+    const auto previousIndex = (activeIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    waitForReleaseOfQueueSnapshot(previousIndex);
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForReleaseOfQueueSnapshot(const uint64_t snapshotIndex) const noexcept
+{
+    const auto waitingStart = mepoo::BaseClock_t::now();
+    const auto timeout = std::chrono::nanoseconds(QUEUE_SNAPSHOT_RELEASE_TIMEOUT.toNanoseconds());
+
+    while (getMembers()->m_queueSnapshotReaders[snapshotIndex].load() != 0U)
+    {
+        // a sender which terminated while reading the snapshot never releases it; RouDi would wait forever and could
+        // not even cleanup the resources of the terminated process, therefore the remaining readers are discarded
+        if (mepoo::BaseClock_t::now() - waitingStart >= timeout)
+        {
+            errorHandler(
+                Error::kPOPO__CHUNK_DISTRIBUTOR_QUEUE_SNAPSHOT_NOT_RELEASED_BY_SENDER, nullptr, ErrorLevel::MODERATE);
+            getMembers()->m_queueSnapshotReaders[snapshotIndex].store(0U);
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline units::Duration ChunkDistributor<ChunkDistributorDataType>::getAccumulatedBlockingTime() const noexcept
+{
+    return units::Duration::fromNanoseconds(
+        getMembers()->m_accumulatedBlockingTimeInNanoseconds.load(std::memory_order_relaxed));
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -22,12 +22,14 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -35,6 +37,10 @@ namespace iox
 {
 namespace popo
 {
+/// @brief maximum time a modification of the queues waits for the senders to release a queue snapshot; a sender which
+/// holds a snapshot longer is considered to be terminated between acquiring and releasing the snapshot
+constexpr units::Duration QUEUE_SNAPSHOT_RELEASE_TIMEOUT = units::Duration::fromSeconds(1U);
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 struct ChunkDistributorData : public LockingPolicy
 {
@@ -44,13 +50,23 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const SubscriberTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const SubscriberTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const units::Duration maxBlockingTime = units::Duration::fromNanoseconds(0U)) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    static constexpr uint64_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+
+    /// @brief The queues are double buffered (RCU-like). The sending thread reads the active snapshot without taking
+    /// the lock and announces itself in the reader counter of that snapshot. Modifications (e.g. by RouDi) are done
+    /// under the lock on the inactive snapshot, once all its readers are gone, and are published by switching the
+    /// active snapshot index.
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    std::atomic<uint64_t> m_activeQueueSnapshot{0U};
+    mutable std::atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS]{{0U}, {0U}};
 
     /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
@@ -60,6 +76,11 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const SubscriberTooSlowPolicy m_subscriberTooSlowPolicy;
+
+    /// @brief maximum time to wait for a blocking queue with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER, zero means
+    /// no limit
+    const units::Duration m_maxBlockingTime;
+    std::atomic<uint64_t> m_accumulatedBlockingTimeInNanoseconds{0U};
 };
 
 } // namespace popo
@@ -32,10 +32,13 @@ constexpr T min(const T left, const T right)
 
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const SubscriberTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const SubscriberTooSlowPolicy policy,
+    const uint64_t historyCapacity,
+    const units::Duration maxBlockingTime) noexcept
     : LockingPolicy()
     , m_historyCapacity(min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_subscriberTooSlowPolicy(policy)
+    , m_maxBlockingTime(maxBlockingTime)
 {
     if (m_historyCapacity != historyCapacity)
     {
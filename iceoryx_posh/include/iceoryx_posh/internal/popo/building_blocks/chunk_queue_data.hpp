@@ -18,6 +18,8 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_isolated.hpp"
+#include "iceoryx_hoofs/internal/concurrent/spsc_queue.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -30,6 +32,38 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief selects the queue of a ChunkQueueData at compile time; a queue with multiple producers uses the
+/// VariantQueue which dispatches to the requested queue type at runtime
+template <bool HasSingleProducer, uint64_t Capacity>
+struct ChunkQueueSelector
+{
+    using Queue_t = cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, Capacity>;
+
+    static cxx::VariantQueueTypes constructorArgument(const cxx::VariantQueueTypes queueType) noexcept
+    {
+        return queueType;
+    }
+};
+
+/// @brief a queue with a single producer, e.g. the queue of a subscriber with the OneToManyPolicy, uses the
+/// SpscQueue without the runtime dispatch; only the overflow behavior of the requested queue type is relevant
+template <uint64_t Capacity>
+struct ChunkQueueSelector<true, Capacity>
+{
+    using Queue_t = concurrent::SpscQueue<mepoo::ShmSafeUnmanagedChunk, Capacity>;
+
+    static concurrent::SpscQueueOverflowPolicy constructorArgument(const cxx::VariantQueueTypes queueType) noexcept
+    {
+        return (queueType == cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
+                || queueType == cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer)
+                   ? concurrent::SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE
+                   : concurrent::SpscQueueOverflowPolicy::REJECT_NEW_VALUE;
+    }
+};
+} // namespace internal
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -40,12 +74,52 @@ struct ChunkQueueData : public LockingPolicy
     ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
-    std::atomic_bool m_queueHasLostChunks{false};
+    static constexpr bool HAS_SINGLE_PRODUCER = ChunkQueueDataProperties_t::HAS_SINGLE_PRODUCER;
+    using QueueSelector_t = internal::ChunkQueueSelector<HAS_SINGLE_PRODUCER, MAX_CAPACITY>;
+    using Queue_t = typename QueueSelector_t::Queue_t;
+
+    Queue_t m_queue;
+    /// @brief written by the producer on an overflow, it is isolated from the queue and the members which are read by
+    /// the consumer on every pop
+    concurrent::CacheLineIsolated<std::atomic_bool> m_queueHasLostChunks{false};
+
+    /// @brief senders with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER announce themselves here and sleep on the
+    /// semaphore until the queue has space available again
+    std::atomic<uint64_t> m_numberOfBlockedSenders{0U};
+    posix::Semaphore m_spaceAvailableSemaphore =
+        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0U)
+                      .or_else([](posix::SemaphoreError&) {
+                          errorHandler(Error::kPOPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE,
+                                       nullptr,
+                                       ErrorLevel::FATAL);
+                      })
+                      .value());
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief the unique id of the port which owns the queue, it is used to deliver a chunk to one specific queue
+    /// of a ChunkDistributor, e.g. a response of a server to the requesting client
+    UniquePortId m_uniqueId{InvalidId};
+
+    /// @brief only every n-th chunk which is offered by a ChunkDistributor is pushed into the queue, 1 pushes every
+    /// chunk; it is set by the owner of the queue before the queue is added to a ChunkDistributor
+    uint64_t m_decimationFactor{1U};
+    /// @brief the minimum time between two chunks which are pushed by a ChunkDistributor, 0 disables the limit; it is
+    /// set by the owner of the queue before the queue is added to a ChunkDistributor
+    uint64_t m_minDeliveryIntervalInNanoseconds{0U};
+
+    /// @brief the state of the delivery filter which is modified by the producers on every offered chunk
+    struct DeliveryFilterState
+    {
+        std::atomic<uint64_t> m_numberOfOfferedChunks{0U};
+        std::atomic<uint64_t> m_lastDeliveryTimestampInNanoseconds{0U};
+        std::atomic<uint64_t> m_numberOfSkippedChunks{0U};
+    };
+    /// @brief only used when the decimation or the minimum delivery interval is set, it is isolated to keep the
+    /// members which are read on every push and pop free of the writes of the filter
+    concurrent::CacheLineIsolated<DeliveryFilterState> m_deliveryFilterState;
 };
 
 } // namespace popo
@@ -24,7 +24,7 @@ namespace popo
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
-    : m_queue(queueType)
+    : m_queue(QueueSelector_t::constructorArgument(queueType))
     , m_queueFullPolicy(policy)
 {
 }
@@ -50,6 +50,12 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop multiple chunks from the chunk queue in one pass, blocked senders are notified once for all of them
+    /// @param[out] chunks array with at least maxNumberOfChunks elements to store the popped shared chunks in
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to pop
+    /// @return the number of popped chunks, 0 if the queue is empty
+    uint64_t tryPopBatch(cxx::not_null<mepoo::SharedChunk*> chunks, const uint64_t maxNumberOfChunks) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -97,6 +103,15 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief wakes up the senders which wait for space in a queue with QueueFullPolicy::BLOCK_PUBLISHER
+    /// @param[in] numberOfFreedSlots the number of slots which were freed, at most this number of senders is woken up
+    void notifyBlockedSenders(const uint64_t numberOfFreedSlots = 1U) noexcept;
+
+    /// @brief checks if the chunk header version of a popped chunk is supported and calls the error handler if not
+    /// @param[in] chunk the popped chunk
+    /// @return true if the chunk can be handed to the user, false if it has to be dropped
+    bool hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) const noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
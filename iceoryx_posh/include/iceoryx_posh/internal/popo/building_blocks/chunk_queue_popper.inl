@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -52,16 +54,12 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyBlockedSenders();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        if (!hasCompatibleChunkHeaderVersion(chunk))
         {
-            LogError() << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion
-                       << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
-            errorHandler(Error::kPOPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                         nullptr,
-                         ErrorLevel::SEVERE);
             return cxx::nullopt_t();
         }
         return cxx::make_optional<mepoo::SharedChunk>(chunk);
@@ -72,12 +70,60 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::tryPopBatch(cxx::not_null<mepoo::SharedChunk*> chunks,
+                                                                  const uint64_t maxNumberOfChunks) noexcept
+{
+    uint64_t numberOfPoppedChunks{0U};
+    uint64_t numberOfFreedSlots{0U};
+    while (numberOfPoppedChunks < maxNumberOfChunks)
+    {
+        auto retVal = getMembers()->m_queue.pop();
+        if (!retVal.has_value())
+        {
+            break;
+        }
+        ++numberOfFreedSlots;
+
+        auto chunk = retVal.value().releaseToSharedChunk();
+        if (hasCompatibleChunkHeaderVersion(chunk))
+        {
+            chunks[numberOfPoppedChunks] = chunk;
+            ++numberOfPoppedChunks;
+        }
+    }
+
+    if (numberOfFreedSlots > 0U)
+    {
+        notifyBlockedSenders(numberOfFreedSlots);
+    }
+
+    return numberOfPoppedChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::hasCompatibleChunkHeaderVersion(
+    const mepoo::SharedChunk& chunk) const noexcept
+{
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        LogError() << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                   << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
+        errorHandler(Error::kPOPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                     nullptr,
+                     ErrorLevel::SEVERE);
+        return false;
+    }
+    return true;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
-    if (getMembers()->m_queueHasLostChunks.load(std::memory_order_relaxed))
+    if (getMembers()->m_queueHasLostChunks->load(std::memory_order_relaxed))
     {
-        getMembers()->m_queueHasLostChunks.store(false, std::memory_order_relaxed);
+        getMembers()->m_queueHasLostChunks->store(false, std::memory_order_relaxed);
         return true;
     }
     return false;
@@ -121,6 +167,28 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // PRQA S 4117 4 # d'tor of SharedChunk will release the memory, so RAII has the side effect here
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+
+    notifyBlockedSenders();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyBlockedSenders(const uint64_t numberOfFreedSlots) noexcept
+{
+    if (getMembers()->m_queueFullPolicy != QueueFullPolicy::BLOCK_PUBLISHER)
+    {
+        return;
+    }
+
+    // pairs with the fence of the sender which announces itself before it retries to push; either the sender sees the
+    // free space or we see the blocked sender
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t numberOfBlockedSenders = getMembers()->m_numberOfBlockedSenders.load(std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < std::min(numberOfFreedSlots, numberOfBlockedSenders); ++i)
+    {
+        getMembers()->m_spaceAvailableSemaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT, nullptr, ErrorLevel::FATAL);
+        });
+    }
 }
 
 template <typename ChunkQueueDataType>
@@ -50,9 +50,23 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the consumer, e.g. to push multiple chunks and
+    /// notify only once with notify()
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notify the consumer that new chunks are available in the chunk queue
+    void notify() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief applies the decimation and the minimum delivery interval of the queue to the next offered chunk, a
+    /// skipped chunk is counted in the delivery filter state
+    /// @return true if the next chunk shall be pushed into the queue, false if it shall be skipped
+    bool shouldDeliverNextChunk() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -45,6 +45,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -57,23 +65,73 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
     }
-
-    return !hasQueueOverflow;
 }
 
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
-    getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    // the flag is only written when it changes, a slow consumer would otherwise cause a cache line transfer on every
+    // overflow
+    if (!getMembers()->m_queueHasLostChunks->load(std::memory_order_relaxed))
+    {
+        getMembers()->m_queueHasLostChunks->store(true, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::shouldDeliverNextChunk() noexcept
+{
+    const uint64_t decimationFactor = getMembers()->m_decimationFactor;
+    const uint64_t minDeliveryInterval = getMembers()->m_minDeliveryIntervalInNanoseconds;
+
+    // the common case without a filter does not touch the cache line of the filter state
+    if (decimationFactor <= 1U && minDeliveryInterval == 0U)
+    {
+        return true;
+    }
+
+    auto& filterState = *getMembers()->m_deliveryFilterState;
+    bool shouldDeliver = true;
+
+    if (decimationFactor > 1U)
+    {
+        const uint64_t numberOfOfferedChunks =
+            filterState.m_numberOfOfferedChunks.fetch_add(1U, std::memory_order_relaxed);
+        shouldDeliver = (numberOfOfferedChunks % decimationFactor == 0U);
+    }
+
+    if (shouldDeliver && minDeliveryInterval != 0U)
+    {
+        const uint64_t now = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch())
+                .count());
+        uint64_t lastDelivery = filterState.m_lastDeliveryTimestampInNanoseconds.load(std::memory_order_relaxed);
+
+        // with multiple publishers only the one which wins the compare and swap delivers its chunk in the interval
+        shouldDeliver = (lastDelivery == 0U || now - lastDelivery >= minDeliveryInterval)
+                        && filterState.m_lastDeliveryTimestampInNanoseconds.compare_exchange_strong(
+                            lastDelivery, now, std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+
+    if (!shouldDeliver)
+    {
+        filterState.m_numberOfSkippedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    return shouldDeliver;
 }
 
 } // namespace popo
@@ -63,6 +63,16 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get multiple received chunks in one pass. The ownership of the SharedChunks remains in the
+    /// ChunkReceiver like with tryGet
+    /// @param[out] chunkHeaders array with at least maxNumberOfChunks elements to store the received chunk headers in
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to receive
+    /// @return the number of received chunks, ChunkReceiveResult::NO_CHUNK_AVAILABLE if there are no new chunks in the
+    /// underlying queue or ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL if the user side cannot hold a further
+    /// chunk; in the latter case the chunks remain in the queue
+    cxx::expected<uint32_t, ChunkReceiveResult> tryGetBatch(cxx::not_null<const mepoo::ChunkHeader**> chunkHeaders,
+                                                            const uint32_t maxNumberOfChunks) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -20,6 +20,8 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -71,6 +73,42 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
     return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(cxx::not_null<const mepoo::ChunkHeader**> chunkHeaders,
+                                                  const uint32_t maxNumberOfChunks) noexcept
+{
+    // only request as many chunks as can be held, the others remain in the queue instead of being dropped
+    const uint32_t numberOfChunksToGet = std::min(maxNumberOfChunks, getMembers()->m_chunksInUse.freeSpace());
+    if (numberOfChunksToGet == 0U)
+    {
+        if (maxNumberOfChunks == 0U || this->empty())
+        {
+            return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+        }
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_IN_USE];
+    const auto numberOfChunks = static_cast<uint32_t>(this->tryPopBatch(chunks, numberOfChunksToGet));
+    if (numberOfChunks == 0U)
+    {
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    if (!getMembers()->m_chunksInUse.insert(chunks, numberOfChunks))
+    {
+        // cannot happen since the free space was checked before, the chunks are released when going out of scope
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+    }
+    return cxx::success<uint32_t>(numberOfChunks);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
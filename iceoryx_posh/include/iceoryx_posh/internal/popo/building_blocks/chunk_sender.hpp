@@ -76,6 +76,22 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                     const uint32_t userHeaderSize,
                                                                     const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate a chunk like tryAllocate; if the user-payload does not fit into the largest mempool, it is split
+    /// into a chain of chunks which can be accessed with the chunk chain API of the ChunkHeader
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the whole user-payload of the chain without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload of each chunk of the chain
+    /// @param[in] userHeaderSize, size of the user-header of the first chunk; use iox::CHUNK_NO_USER_HEADER_SIZE to
+    /// omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return on success pointer to the ChunkHeader of the first chunk of the chain, error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChained(const UniquePortId originId,
+                                                                           const uint32_t userPayloadSize,
+                                                                           const uint32_t userPayloadAlignment,
+                                                                           const uint32_t userHeaderSize,
+                                                                           const uint32_t userHeaderAlignment) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -84,6 +100,19 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send an allocated chunk only to the connected ChunkQueuePopper with the provided unique id, e.g. a
+    /// response to the client which sent the request. The chunk is not added to the history
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    /// @param[in] uniqueQueueId, the unique id of the queue to which the chunk shall be sent
+    /// @return true if a queue with this unique id is connected, false if not; the chunk is released in this case
+    bool sendToQueue(mepoo::ChunkHeader* const chunkHeader, const UniquePortId uniqueQueueId) noexcept;
+
+    /// @brief Send multiple allocated chunks in the given order to all connected ChunkQueuePopper, each of them is
+    /// notified only once
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of chunks to send
+    void sendBatch(cxx::not_null<mepoo::ChunkHeader* const*> chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -101,8 +130,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
     /// @param[in] chunkHeader of the chunk that shall be send
     /// @param[in][out] chunk that corresponds to the chunk header
+    /// @param[in] publishTimestamp which is stored in the chunk header
     /// @return true if there was a matching chunk with this header, false if not
-    bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
+    bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
+                              mepoo::SharedChunk& chunk,
+                              const uint64_t publishTimestamp) noexcept;
+
+    /// @brief the current time of the mepoo::BaseClock_t in nanoseconds if the chunks shall be stamped, otherwise
+    /// ChunkHeader::NO_PUBLISH_TIMESTAMP; this is not done per chunk to read the clock only once per batch
+    uint64_t currentPublishTimestamp() const noexcept;
 
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
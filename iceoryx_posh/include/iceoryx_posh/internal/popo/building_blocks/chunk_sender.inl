@@ -52,6 +52,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     //   - there is a valid chunk
     //   - there is no other owner
     //   - the new user-payload still fits in it
+    //   - it is not the head of a chunk chain
     const auto chunkSettingsResult =
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
@@ -66,7 +67,8 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
 
-    if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
+    if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize)
+        && (lastChunkChunkHeader->nextChainedChunk() == nullptr))
     {
         auto sharedChunk = lastChunkUnmanaged.cloneToSharedChunk();
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
@@ -85,7 +87,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache);
 
         if (chunk)
         {
@@ -110,6 +112,42 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline cxx::expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateChained(const UniquePortId originId,
+                                                     const uint32_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment,
+                                                     const uint32_t userHeaderSize,
+                                                     const uint32_t userHeaderAlignment) noexcept
+{
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChainedChunk(chunkSettingsResult.value());
+
+    if (!chunk)
+    {
+        return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    }
+
+    // the head of the chain owns the whole chain, therefore only the head is tracked
+    if (!getMembers()->m_chunksInUse.insert(chunk))
+    {
+        // release the allocated chain
+        chunk = nullptr;
+        return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+    // END of critical section, chunks will be lost if process gets hard terminated in between
+
+    chunk.getChunkHeader()->setOriginId(originId);
+    return cxx::success<mepoo::ChunkHeader*>(chunk.getChunkHeader());
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -126,7 +164,7 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
 {
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
-    if (getChunkReadyForSend(chunkHeader, chunk))
+    if (getChunkReadyForSend(chunkHeader, chunk, currentPublishTimestamp()))
     {
         this->deliverToAllStoredQueues(chunk);
 
@@ -136,12 +174,53 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
     // END of critical section, chunk will be lost if process gets hard terminated in between
 }
 
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                                                          const UniquePortId uniqueQueueId) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
+    if (getChunkReadyForSend(chunkHeader, chunk, currentPublishTimestamp()))
+    {
+        return !this->deliverToQueue(uniqueQueueId, chunk).has_error();
+    }
+    // END of critical section, chunk will be lost if process gets hard terminated in between
+    return false;
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::sendBatch(cxx::not_null<mepoo::ChunkHeader* const*> chunkHeaders,
+                                                        const uint32_t numberOfChunks) noexcept
+{
+    // a valid batch cannot contain more chunks than can be allocated in parallel
+    cxx::vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    const uint64_t publishTimestamp = currentPublishTimestamp();
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeaders[i], chunk, publishTimestamp))
+        {
+            chunks.emplace_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        this->deliverToAllStoredQueues(chunks.begin(), chunks.size());
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section, chunks will be lost if process gets hard terminated in between
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
-    if (getChunkReadyForSend(chunkHeader, chunk))
+    if (getChunkReadyForSend(chunkHeader, chunk, currentPublishTimestamp()))
     {
         this->addToHistoryWithoutDelivery(chunk);
 
@@ -170,15 +249,18 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_memoryMgr->releaseChunkCache(getMembers()->m_chunkCache);
 }
 
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
-                                                                   mepoo::SharedChunk& chunk) noexcept
+                                                                   mepoo::SharedChunk& chunk,
+                                                                   const uint64_t publishTimestamp) noexcept
 {
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        chunk.getChunkHeader()->setPublishTimestamp(publishTimestamp);
         return true;
     }
     else
@@ -188,6 +270,17 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::currentPublishTimestamp() const noexcept
+{
+    if (!getMembers()->m_publishTimestamp)
+    {
+        return mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP;
+    }
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+}
+
 } // namespace popo
 } // namespace iox
 
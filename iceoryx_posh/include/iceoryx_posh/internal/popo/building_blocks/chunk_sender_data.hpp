@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -35,15 +36,21 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const units::Duration maxBlockingTime = units::Duration::fromNanoseconds(0U),
+                             const uint32_t chunkCacheSize = 0U,
+                             const bool publishTimestamp = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY = MaxChunksAllocatedSimultaneously;
 
     const rp::RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkCache m_chunkCache;
+    const bool m_publishTimestamp{false};
 };
 
 } // namespace popo
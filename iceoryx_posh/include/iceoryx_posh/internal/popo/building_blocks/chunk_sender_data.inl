@@ -26,10 +26,15 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(subscriberTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const units::Duration maxBlockingTime,
+    const uint32_t chunkCacheSize,
+    const bool publishTimestamp) noexcept
+    : ChunkDistributorDataType(subscriberTooSlowPolicy, historyCapacity, maxBlockingTime)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_chunkCache(chunkCacheSize)
+    , m_publishTimestamp(publishTimestamp)
 {
 }
 
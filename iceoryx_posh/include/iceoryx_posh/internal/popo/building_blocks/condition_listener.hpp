@@ -70,8 +70,9 @@ class ConditionListener
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void reset(const uint64_t index) noexcept;
-    void resetSemaphore() noexcept;
+    /// @brief resets all active notifications and appends their indices in ascending order
+    /// @param[in] activeNotifications vector to which the indices are appended
+    void collectNotifications(NotificationVector_t& activeNotifications) noexcept;
 
     NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
 
@@ -27,8 +27,16 @@ namespace iox
 {
 namespace popo
 {
+/// @brief The notifications are stored in a bitset of atomic words. A notifier sets its bit and only posts the
+/// semaphore when the listener announced that it is going to sleep. Therefore the listener neither has to scan an
+/// entry per notifier nor to count down posts which were done while it was not waiting.
 struct ConditionVariableData
 {
+    using NotificationWord_t = uint64_t;
+    static constexpr uint64_t BITS_PER_NOTIFICATION_WORD = 64U;
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS =
+        (MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE + BITS_PER_NOTIFICATION_WORD - 1U) / BITS_PER_NOTIFICATION_WORD;
+
     ConditionVariableData() noexcept;
     ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,6 +46,15 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() = default;
 
+    /// @brief checks if the notification with the provided index is active
+    /// @param[in] index of the notification
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
+    /// @brief checks if any notification is active
+    /// @return true if at least one notification is active, otherwise false
+    bool hasActiveNotifications() const noexcept;
+
     posix::Semaphore m_semaphore =
         std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0u)
                       .or_else([](posix::SemaphoreError&) {
@@ -49,7 +66,8 @@ struct ConditionVariableData
 
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE];
+    std::atomic<NotificationWord_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
+    std::atomic_bool m_isListenerWaiting{false};
 };
 
 } // namespace popo
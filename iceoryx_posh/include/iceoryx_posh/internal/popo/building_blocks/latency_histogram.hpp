@@ -0,0 +1,78 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief the evaluation of a LatencyHistogram, the percentiles are the upper bound of the bucket they fall into
+struct LatencyStatistics
+{
+    uint64_t numberOfSamples{0U};
+    uint64_t p50InNanoseconds{0U};
+    uint64_t p99InNanoseconds{0U};
+    uint64_t maxInNanoseconds{0U};
+};
+
+/// @brief A log-linear histogram for latencies which is located in the shared memory. Every power of two is split
+/// into NUMBER_OF_SUB_BUCKETS linear buckets, which bounds the relative error of the percentiles to
+/// 1 / NUMBER_OF_SUB_BUCKETS. The buckets are atomic counters, therefore recording is lock-free and the histogram can
+/// be evaluated from another process, e.g. RouDi, while it is recorded.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS{2U};
+    static constexpr uint32_t NUMBER_OF_SUB_BUCKETS{1U << SUB_BUCKET_BITS};
+    /// @brief latencies from 2^MAX_EXPONENT ns, i.e. about 18 minutes, on are recorded in the last bucket
+    static constexpr uint32_t MAX_EXPONENT{40U};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{(MAX_EXPONENT - SUB_BUCKET_BITS + 1U) * NUMBER_OF_SUB_BUCKETS};
+
+    LatencyHistogram() noexcept;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief adds a latency to the histogram
+    /// @param[in] latencyInNanoseconds the latency to add
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief evaluates the latencies which were recorded so far
+    /// @return the number of samples, the median, the 99th percentile and the maximum
+    LatencyStatistics statistics() const noexcept;
+
+    /// @brief returns the bucket a latency is counted in
+    static uint32_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief returns the largest latency which is counted in the bucket
+    static uint64_t bucketUpperBound(const uint32_t index) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+    std::atomic<uint64_t> m_maxInNanoseconds{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
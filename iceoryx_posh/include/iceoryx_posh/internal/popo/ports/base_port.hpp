@@ -85,6 +85,10 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Pushes the port into the discovery request queue, if one is set, and wakes up RouDi to do the
+    /// discovery for this port. Nothing happens if the port already requested a discovery which was not yet done.
+    void requestDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
+#include "iceoryx_posh/internal/popo/ports/discovery_request_queue_data.hpp"
 
 #include <atomic>
 
@@ -54,6 +55,10 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief set by RouDi for ports which shall request their discovery, a nullptr disables the requests
+    rp::RelativePointer<DiscoveryRequestQueueData> m_discoveryRequestQueue;
+    std::atomic_bool m_isDiscoveryRequested{false};
 };
 
 } // namespace popo
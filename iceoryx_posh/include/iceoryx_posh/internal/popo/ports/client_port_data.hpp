@@ -17,11 +17,13 @@
 #ifndef IOX_POSH_POPO_PORTS_CLIENT_PORT_DATA_HPP
 #define IOX_POSH_POPO_PORTS_CLIENT_PORT_DATA_HPP
 
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -34,8 +36,8 @@ struct ClientPortData : public BasePortData
 {
     ClientPortData(const capro::ServiceDescription& serviceDescription,
                    const RuntimeName_t& runtimeName,
-                   const NodeName_t& nodeName,
                    mepoo::MemoryManager* const memoryManager,
+                   const ClientOptions& clientOptions,
                    const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
     static constexpr SubscriberTooSlowPolicy CLIENT_SUBSCRIBER_POLICY = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA;
@@ -44,6 +46,9 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    /// @brief the request queue of the server the client is connected to, a STOP_OFFER of any other server of the
+    /// same service does not affect the connection
+    rp::RelativePointer<ServerChunkQueueData_t> m_connectedServerQueue;
 };
 
 } // namespace popo
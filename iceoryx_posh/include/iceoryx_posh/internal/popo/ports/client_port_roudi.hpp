@@ -54,11 +54,18 @@ class ClientPortRouDi : public BasePort
     cxx::optional<capro::CaproMessage>
     dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief get the current connection state of the client
+    /// @return the connection state as seen by the discovery
+    ConnectionState getConnectionState() const noexcept;
+
     /// @brief cleanup the client and release all the chunks it currently holds
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
   private:
+    /// @brief creates a CONNECT or DISCONNECT message which carries the response queue of the client
+    capro::CaproMessage createConnectionMessage(const capro::CaproMessageType type) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
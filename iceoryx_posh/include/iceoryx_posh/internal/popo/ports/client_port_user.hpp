@@ -49,20 +49,24 @@ class ClientPortUser : public BasePort
     ClientPortUser& operator=(ClientPortUser&& rhs) = default;
     ~ClientPortUser() = default;
 
-    /// @brief Allocate a chunk, the ownerhip of the SharedChunk remains in the ClientPortUser for being able to
-    /// cleanup if the user process disappears
+    /// @brief Allocate a request, the ownerhip of the SharedChunk remains in the ClientPortUser for being able to
+    /// cleanup if the user process disappears. The RequestHeader is the user-header of the chunk
     /// @param[in] userPayloadSize, size of the user-paylaod without additional headers
-    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
-    /// user-payload fields, error if not
-    cxx::expected<RequestHeader*, AllocationError> allocateRequest(const uint32_t userPayloadSize) noexcept;
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @return on success pointer to a RequestHeader which can be used to access the chunk-header and the
+    /// user-payload of the request, error if not
+    cxx::expected<RequestHeader*, AllocationError>
+    allocateRequest(const uint32_t userPayloadSize,
+                    const uint32_t userPayloadAlignment = CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
 
     /// @brief Free an allocated request without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to free
+    /// @param[in] requestHeader, pointer to the RequestHeader to free
     void freeRequest(RequestHeader* const requestHeader) noexcept;
 
     /// @brief Send an allocated request chunk to the server port
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
-    void sendRequest(RequestHeader* const requestHeader) noexcept;
+    /// @param[in] requestHeader, pointer to the RequestHeader to send
+    /// @return ClientSendError::NOT_CONNECTED if the client is not connected, the request is freed in this case
+    cxx::expected<ClientSendError> sendRequest(RequestHeader* const requestHeader) noexcept;
 
     /// @brief try to connect to the server Caution: There can be delays between calling connect and a change
     /// in the connection state
@@ -82,14 +86,14 @@ class ClientPortUser : public BasePort
     /// @return ConnectionState
     ConnectionState getConnectionState() const noexcept;
 
-    /// @brief Tries to get the next response from the queue. If there is a new one, the ChunkHeader of the oldest
+    /// @brief Tries to get the next response from the queue. If there is a new one, the ResponseHeader of the oldest
     /// response in the queue is returned (FiFo queue)
-    /// @return optional that has a new chunk header or no value if there are no new responses in the underlying queue,
-    /// ChunkReceiveResult on error
-    cxx::expected<cxx::optional<const ResponseHeader*>, ChunkReceiveResult> getResponse() noexcept;
+    /// @return the ResponseHeader of the next response, ChunkReceiveResult::NO_CHUNK_AVAILABLE if there are no new
+    /// responses in the underlying queue or another ChunkReceiveResult on error
+    cxx::expected<const ResponseHeader*, ChunkReceiveResult> getResponse() noexcept;
 
-    /// @brief Release a response that was obtained with getResponseChunk
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @brief Release a response that was obtained with getResponse
+    /// @param[in] responseHeader, pointer to the ResponseHeader to release
     void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
 
     /// @brief check if there are responses in the queue
@@ -121,4 +125,4 @@ class ClientPortUser : public BasePort
 } // namespace popo
 } // namespace iox
 
-#endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
+#endif // IOX_POSH_POPO_PORTS_CLIENT_PORT_USER_HPP
@@ -16,11 +16,11 @@
 #ifndef IOX_POSH_POPO_PORTS_CLIENT_SERVER_PORT_TYPES_HPP
 #define IOX_POSH_POPO_PORTS_CLIENT_SERVER_PORT_TYPES_HPP
 
-#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <cstdint>
 
@@ -43,11 +43,13 @@ struct ServerChunkDistributorConfig
 struct ClientChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_RESPONSE_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
 };
 
 struct ServerChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_REQUEST_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
 };
 
 using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafePolicy>;
@@ -68,65 +70,82 @@ using ClientChunkSenderData_t = ChunkSenderData<MAX_REQUESTS_ALLOCATED_SIMULTANE
 
 using ServerChunkSenderData_t = ChunkSenderData<MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY, ServerChunkDistributorData_t>;
 
+/// @brief Error which can occur when a client sends a request
+enum class ClientSendError
+{
+    INVALID_STATE,
+    /// @brief the client is not connected to a server, the request is released
+    NOT_CONNECTED
+};
+
+/// @brief Error which can occur when a server sends a response
+enum class ServerSendError
+{
+    INVALID_STATE,
+    /// @brief the server is not offered, the response is released
+    NOT_OFFERED,
+    /// @brief the client which sent the request is not connected anymore, the response is released
+    CLIENT_NOT_AVAILABLE
+};
+
+/// @brief The RPCBaseHeader is the user-header of request and response chunks. It identifies the client, to which a
+/// response is routed back, with the unique id of the client port. It resides in shared memory and must therefore
+/// not have virtual functions
 class RPCBaseHeader
 {
   public:
-    explicit RPCBaseHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr, const int64_t sequenceNumber)
-        : m_clientQueueDataPtr(chunkQueueDataPtr)
-        , m_sequenceNumber(sequenceNumber)
-    {
-    }
+    RPCBaseHeader(const UniquePortId& clientId, const int64_t sequenceNumber) noexcept;
 
     RPCBaseHeader(const RPCBaseHeader& other) = delete;
     RPCBaseHeader& operator=(const RPCBaseHeader&) = delete;
-    RPCBaseHeader(RPCBaseHeader&& rhs) = default;
-    RPCBaseHeader& operator=(RPCBaseHeader&& rhs) = default;
-    virtual ~RPCBaseHeader() = default;
+    RPCBaseHeader(RPCBaseHeader&& rhs) = delete;
+    RPCBaseHeader& operator=(RPCBaseHeader&& rhs) = delete;
+    ~RPCBaseHeader() = default;
+
+    /// @brief the unique id of the client port which sent the request or receives the response
+    UniquePortId getClientId() const noexcept;
+
+    /// @brief the sequence number which is set by the client for a request and copied to the response
+    int64_t getSequenceNumber() const noexcept;
+
+    /// @brief the ChunkHeader of the chunk which carries this header as user-header
+    mepoo::ChunkHeader* getChunkHeader() noexcept;
+
+    /// @brief the ChunkHeader of the chunk which carries this header as user-header
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept;
+
+    /// @brief the user-payload of the chunk which carries this header as user-header
+    void* getUserPayload() noexcept;
 
-    int64_t getSequenceNumber() const noexcept
-    {
-        return m_sequenceNumber;
-    }
+    /// @brief the user-payload of the chunk which carries this header as user-header
+    const void* getUserPayload() const noexcept;
 
   protected:
-    rp::RelativePointer<ClientChunkQueueData_t> m_clientQueueDataPtr;
+    UniquePortId m_clientId;
     int64_t m_sequenceNumber{0};
 };
 
 class RequestHeader : public RPCBaseHeader
 {
   public:
-    explicit RequestHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr) noexcept
-        : RPCBaseHeader(chunkQueueDataPtr, 0)
-    {
-    }
-
-    RequestHeader(const RequestHeader& other) = delete;
-    RequestHeader& operator=(const RequestHeader&) = delete;
-    RequestHeader(RequestHeader&& rhs) = default;
-    RequestHeader& operator=(RequestHeader&& rhs) = default;
-    virtual ~RequestHeader() = default;
-
-    void setSequenceNumber(const int64_t sequenceNumber) noexcept
-    {
-        this->m_sequenceNumber = sequenceNumber;
-    }
-
-    void setFireAndForget(const bool fireAndForget) noexcept
-    {
-        m_isFireAndForget = fireAndForget;
-    }
-
-    mepoo::ChunkHeader* getChunkHeader() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
-    void* getUserPayload() noexcept
-    {
-        /// todo
-        return nullptr;
-    }
+    explicit RequestHeader(const UniquePortId& clientId) noexcept;
+
+    void setSequenceNumber(const int64_t sequenceNumber) noexcept;
+
+    void setFireAndForget(const bool fireAndForget) noexcept;
+
+    /// @brief a fire and forget request does not expect a response
+    bool isFireAndForget() const noexcept;
+
+    /// @brief get the RequestHeader of a request from its user-payload
+    /// @param[in] userPayload of the request
+    /// @return the RequestHeader or a nullptr if the userPayload is a nullptr
+    static RequestHeader* fromUserPayload(void* const userPayload) noexcept;
+
+    /// @brief get the RequestHeader of a request from its user-payload
+    /// @param[in] userPayload of the request
+    /// @return the RequestHeader or a nullptr if the userPayload is a nullptr
+    static const RequestHeader* fromUserPayload(const void* const userPayload) noexcept;
 
   private:
     bool m_isFireAndForget{false};
@@ -135,44 +154,26 @@ class RequestHeader : public RPCBaseHeader
 class ResponseHeader : public RPCBaseHeader
 {
   public:
-    ResponseHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr,
-                   const int64_t sequenceNumber) noexcept
-        : RPCBaseHeader(chunkQueueDataPtr, sequenceNumber)
-    {
-    }
-
-    ResponseHeader(const ResponseHeader& other) = delete;
-    ResponseHeader& operator=(const ResponseHeader&) = delete;
-    ResponseHeader(ResponseHeader&& rhs) = default;
-    ResponseHeader& operator=(ResponseHeader&& rhs) = default;
-    virtual ~ResponseHeader() = default;
-
-    void setServerError(bool serverError) noexcept
-    {
-        m_hasServerError = serverError;
-    }
-
-    bool hasServerError() const noexcept
-    {
-        return m_hasServerError;
-    }
-
-    const mepoo::ChunkHeader* getChunkHeader() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
-    const void* getUserPayload() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
+    ResponseHeader(const UniquePortId& clientId, const int64_t sequenceNumber) noexcept;
+
+    void setServerError(bool serverError) noexcept;
+
+    bool hasServerError() const noexcept;
+
+    /// @brief get the ResponseHeader of a response from its user-payload
+    /// @param[in] userPayload of the response
+    /// @return the ResponseHeader or a nullptr if the userPayload is a nullptr
+    static ResponseHeader* fromUserPayload(void* const userPayload) noexcept;
+
+    /// @brief get the ResponseHeader of a response from its user-payload
+    /// @param[in] userPayload of the response
+    /// @return the ResponseHeader or a nullptr if the userPayload is a nullptr
+    static const ResponseHeader* fromUserPayload(const void* const userPayload) noexcept;
 
   private:
     bool m_hasServerError{false};
 };
 
-
 } // namespace popo
 } // namespace iox
 
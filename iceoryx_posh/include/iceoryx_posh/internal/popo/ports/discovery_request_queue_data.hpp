@@ -0,0 +1,46 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_PORTS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
+#define IOX_POSH_POPO_PORTS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+struct BasePortData;
+
+/// @brief Ports push themselves into this queue when their state changed in a way RouDi has to react on, e.g. an
+/// offer or a subscription, and wake up RouDi via the condition variable. RouDi then only does the discovery for the
+/// ports in the queue instead of waiting for the next cyclic discovery of all ports.
+/// A port is pushed at most once until RouDi popped it, therefore the queue cannot overflow.
+struct DiscoveryRequestQueueData
+{
+    static constexpr uint32_t NOTIFICATION_INDEX = 0U;
+    static constexpr uint64_t CAPACITY = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
+
+    concurrent::LockFreeQueue<rp::RelativePointer<BasePortData>, CAPACITY> m_requests;
+    ConditionVariableData m_conditionVariableData{"RouDi"};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
@@ -63,6 +63,20 @@ class PublisherPortUser : public BasePort
                      const uint32_t userHeaderSize = 0U,
                      const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a chunk like tryAllocateChunk; if the user-payload does not fit into the largest mempool, it is
+    /// split into a chain of chunks which can be accessed with the chunk chain API of the ChunkHeader
+    /// @param[in] userPayloadSize, size of the whole user-payload of the chain without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return on success pointer to the ChunkHeader of the first chunk of the chain, error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateChainedChunk(const uint32_t userPayloadSize,
+                            const uint32_t userPayloadAlignment,
+                            const uint32_t userHeaderSize = 0U,
+                            const uint32_t userHeaderAlignment = 1U) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -71,6 +85,12 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the given order to all connected subscriber ports, each subscriber is
+    /// notified only once for all of them
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of chunks to send
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -89,6 +109,10 @@ class PublisherPortUser : public BasePort
     /// @return true if there are subscribers otherwise false
     bool hasSubscribers() const noexcept;
 
+    /// @brief Returns the accumulated time this publisher was blocked by subscribers which are too slow
+    /// @return the accumulated blocking time
+    units::Duration getAccumulatedBlockingTime() const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
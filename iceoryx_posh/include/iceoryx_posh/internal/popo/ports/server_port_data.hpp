@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -34,8 +35,8 @@ struct ServerPortData : public BasePortData
 {
     ServerPortData(const capro::ServiceDescription& serviceDescription,
                    const RuntimeName_t& runtimeName,
-                   const NodeName_t& nodeName,
                    mepoo::MemoryManager* const memoryManager,
+                   const ServerOptions& serverOptions,
                    const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
     static constexpr SubscriberTooSlowPolicy SERVER_SUBSCRIBER_POLICY = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA;
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 
@@ -48,6 +49,8 @@ struct SubscriberPortData : public BasePortData
     const uint64_t m_historyRequest;
     std::atomic_bool m_subscribeRequested{false};
     std::atomic<SubscribeState> m_subscriptionState{SubscribeState::NOT_SUBSCRIBED};
+    /// @brief the time the chunks with a publish timestamp spent in the queue, evaluated by the port introspection
+    LatencyHistogram m_queueLatencyHistogram;
 };
 
 } // namespace popo
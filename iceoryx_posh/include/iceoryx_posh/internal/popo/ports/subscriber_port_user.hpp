@@ -63,11 +63,20 @@ class SubscriberPortUser : public BasePort
     SubscribeState getSubscriptionState() const noexcept;
 
     /// @brief Tries to get the next chunk from the queue. If there is a new one, the ChunkHeader of the oldest chunk in
-    /// the queue is returned (FiFo queue)
+    /// the queue is returned (FiFo queue). If the chunk carries a publish timestamp, the time it spent in the queue is
+    /// recorded in the latency histogram of the port
     /// @return New chunk header, ChunkReceiveResult on error
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get multiple chunks from the queue in one pass, starting with the oldest one (FiFo queue)
+    /// @param[out] chunkHeaders array with at least maxNumberOfChunks elements to store the new chunk headers in
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @return Number of new chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    cxx::expected<uint32_t, ChunkReceiveResult> tryGetChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                                             const uint32_t maxNumberOfChunks) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -97,6 +106,9 @@ class SubscriberPortUser : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    void recordQueueLatencies(const mepoo::ChunkHeader* const* const chunkHeaders,
+                              const uint32_t numberOfChunks) noexcept;
+
     ChunkReceiver<SubscriberPortData::ChunkReceiverData_t> m_chunkReceiver;
 };
 
@@ -88,6 +88,51 @@ inline void PublisherImpl<T, H, BasePublisher_t>::publish(Sample<T, H>&& sample)
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisher_t>
+inline cxx::expected<typename PublisherImpl<T, H, BasePublisher_t>::SampleBatch_t, AllocationError>
+PublisherImpl<T, H, BasePublisher_t>::loanBatch(const uint32_t numberOfSamples) noexcept
+{
+    SampleBatch_t samples;
+    if (numberOfSamples > samples.capacity())
+    {
+        return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    for (uint32_t i = 0U; i < numberOfSamples; ++i)
+    {
+        auto result = loanSample();
+        if (result.has_error())
+        {
+            // the already loaned samples are released when the batch goes out of scope
+            return cxx::error<AllocationError>(result.get_error());
+        }
+        new (result.value().get()) T();
+        samples.emplace_back(std::move(result.value()));
+    }
+
+    return cxx::success<SampleBatch_t>(std::move(samples));
+}
+
+template <typename T, typename H, typename BasePublisher_t>
+inline void PublisherImpl<T, H, BasePublisher_t>::publishBatch(SampleBatch_t&& samples) noexcept
+{
+    if (samples.empty())
+    {
+        return;
+    }
+
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    uint32_t numberOfChunks{0U};
+    for (auto& sample : samples)
+    {
+        auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders[numberOfChunks++] = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    }
+    samples.clear();
+
+    port().sendChunks(chunkHeaders, numberOfChunks);
+}
+
 template <typename T, typename H, typename BasePublisher_t>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisher_t>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -18,6 +18,10 @@
 #ifndef IOX_POSH_POPO_TYPED_SUBSCRIBER_INL
 #define IOX_POSH_POPO_TYPED_SUBSCRIBER_INL
 
+#include "iceoryx_hoofs/cxx/type_traits.hpp"
+
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -43,6 +47,40 @@ SubscriberImpl<T, H, BaseSubscriber_t>::take() noexcept
     return cxx::success<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriber_t>::takeBatch(const uint32_t maxNumberOfSamples, Callable&& callback) noexcept
+{
+    static_assert(cxx::is_invocable<Callable, Sample<const T, const H>&&>::value,
+                  "Subscriber<T>::takeBatch expects a callable with the signature void(Sample<const T, const H>&&)");
+
+    const mepoo::ChunkHeader* chunkHeaders[MAX_SUBSCRIBER_QUEUE_CAPACITY];
+    auto result =
+        BaseSubscriber_t::takeChunks(chunkHeaders, std::min(maxNumberOfSamples, MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+
+    const uint32_t numberOfSamples = result.value();
+    for (uint32_t i = 0U; i < numberOfSamples; ++i)
+    {
+        auto userPayloadPtr = static_cast<const T*>(chunkHeaders[i]->userPayload());
+        callback(Sample<const T, const H>(cxx::unique_ptr<const T>(userPayloadPtr, m_sampleDeleter)));
+    }
+    return cxx::success<uint32_t>(numberOfSamples);
+}
+
+template <typename T, typename H, typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriber_t>::takeAll(Callable&& callback) noexcept
+{
+    // the receive queue cannot hold more samples, therefore one batch drains it
+    return takeBatch(MAX_SUBSCRIBER_QUEUE_CAPACITY, std::forward<Callable>(callback));
+}
+
 template <typename T, typename H, typename BaseSubscriber_t>
 inline SubscriberImpl<T, H, BaseSubscriber_t>::~SubscriberImpl() noexcept
 {
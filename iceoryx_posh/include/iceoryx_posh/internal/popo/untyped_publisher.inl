@@ -18,6 +18,8 @@
 #ifndef IOX_POSH_POPO_UNTYPED_PUBLISHER_INL
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_INL
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -54,6 +56,76 @@ UntypedPublisherImpl<BasePublisher_t>::loan(const uint32_t userPayloadSize,
     }
 }
 
+template <typename BasePublisher_t>
+inline cxx::expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisher_t>::loanChained(const uint32_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment) noexcept
+{
+    auto result =
+        port().tryAllocateChainedChunk(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return cxx::success<void*>(result.value()->userPayload());
+    }
+}
+
+template <typename BasePublisher_t>
+inline cxx::expected<AllocationError>
+UntypedPublisherImpl<BasePublisher_t>::loanBatch(void** const userPayloads,
+                                                 const uint32_t numberOfChunks,
+                                                 const uint32_t userPayloadSize,
+                                                 const uint32_t userPayloadAlignment,
+                                                 const uint32_t userHeaderSize,
+                                                 const uint32_t userHeaderAlignment) noexcept
+{
+    if (numberOfChunks > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto result =
+            port().tryAllocateChunk(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+        if (result.has_error())
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                release(userPayloads[j]);
+                userPayloads[j] = nullptr;
+            }
+            return cxx::error<AllocationError>(result.get_error());
+        }
+        userPayloads[i] = result.value()->userPayload();
+    }
+
+    return cxx::success<>();
+}
+
+template <typename BasePublisher_t>
+inline void UntypedPublisherImpl<BasePublisher_t>::publishBatch(void* const* const userPayloads,
+                                                                const uint32_t numberOfChunks) noexcept
+{
+    // more chunks than can be allocated in parallel are not possible, this is just a safeguard for invalid input
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    for (uint32_t offset = 0U; offset < numberOfChunks; offset += MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        const uint32_t numberOfChunksToSend =
+            std::min(numberOfChunks - offset, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY);
+        for (uint32_t i = 0U; i < numberOfChunksToSend; ++i)
+        {
+            chunkHeaders[i] = mepoo::ChunkHeader::fromUserPayload(userPayloads[offset + i]);
+        }
+        port().sendChunks(chunkHeaders, numberOfChunksToSend);
+    }
+}
+
 template <typename BasePublisher_t>
 inline void UntypedPublisherImpl<BasePublisher_t>::release(void* const userPayload) noexcept
 {
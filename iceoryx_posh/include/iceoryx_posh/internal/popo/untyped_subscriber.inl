@@ -18,6 +18,10 @@
 #ifndef IOX_POSH_POPO_UNTYPED_SUBSCRIBER_INL
 #define IOX_POSH_POPO_UNTYPED_SUBSCRIBER_INL
 
+#include "iceoryx_hoofs/cxx/type_traits.hpp"
+
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -40,6 +44,38 @@ inline cxx::expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<Base
     return cxx::success<const void*>(result.value()->userPayload());
 }
 
+template <typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriber_t>::takeBatch(const uint32_t maxNumberOfChunks, Callable&& callback) noexcept
+{
+    static_assert(cxx::is_invocable<Callable, const void*>::value,
+                  "UntypedSubscriber::takeBatch expects a callable with the signature void(const void*)");
+
+    const mepoo::ChunkHeader* chunkHeaders[MAX_SUBSCRIBER_QUEUE_CAPACITY];
+    auto result = BaseSubscriber::takeChunks(chunkHeaders, std::min(maxNumberOfChunks, MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+
+    const uint32_t numberOfChunks = result.value();
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        callback(static_cast<const void*>(chunkHeaders[i]->userPayload()));
+    }
+    return cxx::success<uint32_t>(numberOfChunks);
+}
+
+template <typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriber_t>::takeAll(Callable&& callback) noexcept
+{
+    // the receive queue cannot hold more chunks, therefore one batch drains it
+    return takeBatch(MAX_SUBSCRIBER_QUEUE_CAPACITY, std::forward<Callable>(callback));
+}
+
 template <typename BaseSubscriber_t>
 inline void UntypedSubscriberImpl<BaseSubscriber_t>::release(const void* const userPayload) noexcept
 {
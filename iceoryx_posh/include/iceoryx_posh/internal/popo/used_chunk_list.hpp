@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -28,6 +29,14 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+constexpr uint32_t smallestPowerOfTwoNotLessThan(const uint32_t value, const uint32_t candidate = 1U) noexcept
+{
+    return (candidate >= value) ? candidate : smallestPowerOfTwoNotLessThan(value, 2U * candidate);
+}
+} // namespace internal
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +47,10 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        To find the entry of a chunk on removal without a linear search, the indices of the used entries are
+///        additionally stored in an open addressing hash table with the address of the ChunkHeader as key. The hash
+///        table is only used from the runtime context, RouDi does the cleanup solely with the array of
+///        ChunkManagement pointers, therefore a corrupted hash table does not affect the cleanup.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -53,7 +66,20 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief Removes a chunk from the list
+    /// @brief Inserts multiple SharedChunks into the list
+    /// @param[in] chunks to store in the list
+    /// @param[in] numberOfChunks is the number of chunks to store
+    /// @return true if successful, otherwise false if the list has not enough space for all chunks; in this case none
+    /// of the chunks is inserted
+    /// @note only from runtime context
+    bool insert(cxx::not_null<const mepoo::SharedChunk*> chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Get the number of chunks which can still be inserted
+    /// @return the number of free entries of the list
+    /// @note only from runtime context
+    uint32_t freeSpace() const noexcept;
+
+    /// @brief Removes a chunk from the list in constant time on average
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
     /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
@@ -68,18 +94,34 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    /// @brief Inserts a chunk without synchronization, the caller must ensure that there is a free entry
+    void insertWithoutSynchronization(const mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief returns the bucket of the hash table where the search for the chunk starts
+    static uint32_t hashBucket(const mepoo::ChunkHeader* chunkHeader) noexcept;
+
+    /// @brief empties a bucket of the hash table and moves the following entries of the probe sequence to the front,
+    /// which keeps the table free of tombstones
+    void eraseFromHashTable(uint32_t bucket) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @brief at least twice the capacity to keep the load factor of the hash table at or below 0.5
+    static constexpr uint32_t HASH_TABLE_SIZE{internal::smallestPowerOfTwoNotLessThan(2U * Capacity)};
+    static constexpr uint32_t HASH_TABLE_MASK{HASH_TABLE_SIZE - 1U};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_numberOfFreeEntries{Capacity};
+    /// @brief the next free entry for every free entry
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
+    /// @brief the indices of the used entries of m_listData or INVALID_INDEX for an empty bucket
+    uint32_t m_hashTable[HASH_TABLE_SIZE];
 };
 
 } // namespace popo
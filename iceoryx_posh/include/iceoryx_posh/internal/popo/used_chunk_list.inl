@@ -41,17 +41,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        insertWithoutSynchronization(chunk);
 
         /// @todo can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
@@ -64,44 +54,107 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+bool UsedChunkList<Capacity>::insert(cxx::not_null<const mepoo::SharedChunk*> chunks,
+                                     const uint32_t numberOfChunks) noexcept
 {
-    auto previous = INVALID_INDEX;
+    if (numberOfChunks > m_numberOfFreeEntries)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        insertWithoutSynchronization(chunks[i]);
+    }
+
+    // one synchronization for all chunks is sufficient since cleanup is only done once the application is gone
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::freeSpace() const noexcept
+{
+    return m_numberOfFreeEntries;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertWithoutSynchronization(const mepoo::SharedChunk& chunk) noexcept
+{
+    // take the entry from the head of the free list
+    auto current = m_freeListHead;
+    m_freeListHead = m_listIndices[current];
+    --m_numberOfFreeEntries;
+
+    m_listData[current] = DataElement_t(chunk);
+
+    // the load factor is at most 0.5, therefore there is always an empty bucket
+    auto bucket = hashBucket(chunk.getChunkHeader());
+    while (m_hashTable[bucket] != INVALID_INDEX)
+    {
+        bucket = (bucket + 1U) & HASH_TABLE_MASK;
+    }
+    m_hashTable[bucket] = current;
+}
 
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+{
+    // go through the probe sequence of the chunk until it is found or an empty bucket terminates the search
+    for (auto bucket = hashBucket(chunkHeader); m_hashTable[bucket] != INVALID_INDEX;
+         bucket = (bucket + 1U) & HASH_TABLE_MASK)
     {
-        if (!m_listData[current].isLogicalNullptr())
+        const auto current = m_hashTable[bucket];
+        if (m_listData[current].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                /// @todo can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[current].releaseToSharedChunk();
+
+            eraseFromHashTable(bucket);
+
+            // insert index to free list
+            m_listIndices[current] = m_freeListHead;
+            m_freeListHead = current;
+            ++m_numberOfFreeEntries;
+
+            /// @todo can we do this cheaper with a global fence in cleanup?
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::hashBucket(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // Fibonacci hashing; the multiplication spreads the address bits, which are zero due to the alignment of the
+    // chunks, over the upper half which is then used for the bucket
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15U};
+    constexpr uint64_t UPPER_HALF_SHIFT{32U};
+    const auto address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(chunkHeader));
+    return static_cast<uint32_t>((address * GOLDEN_RATIO) >> UPPER_HALF_SHIFT) & HASH_TABLE_MASK;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::eraseFromHashTable(uint32_t bucket) noexcept
+{
+    for (auto next = (bucket + 1U) & HASH_TABLE_MASK; m_hashTable[next] != INVALID_INDEX;
+         next = (next + 1U) & HASH_TABLE_MASK)
+    {
+        // an entry can only be moved to the empty bucket if the empty bucket is not before its home bucket in the
+        // probe sequence, i.e. the home bucket is not cyclically in (bucket, next]
+        const auto home = hashBucket(m_listData[m_hashTable[next]].getChunkHeader());
+        const bool isHomeInBetween =
+            (bucket <= next) ? (bucket < home && home <= next) : (bucket < home || home <= next);
+        if (!isHomeInBetween)
+        {
+            m_hashTable[bucket] = m_hashTable[next];
+            bucket = next;
+        }
+    }
+    m_hashTable[bucket] = INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -122,7 +175,7 @@ void UsedChunkList<Capacity>::cleanup() noexcept
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::init() noexcept
 {
-    // build list
+    // build free list
     for (uint32_t i = 0U; i < Capacity; ++i)
     {
         m_listIndices[i] = i + 1u;
@@ -138,8 +191,13 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_numberOfFreeEntries = Capacity;
+
+    for (auto& bucket : m_hashTable)
+    {
+        bucket = INVALID_INDEX;
+    }
 
     // clear data
     for (auto& data : m_listData)
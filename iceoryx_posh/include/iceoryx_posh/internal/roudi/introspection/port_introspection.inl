@@ -578,9 +578,63 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
-    PortThroughputIntrospectionTopic& topic IOX_MAYBE_UNUSED) noexcept
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo #402 re-add port throughput
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto& publisherInfo = m_publisherContainer[publisherIndex];
+                PublisherPort port(publisherInfo.portData);
+
+                /// @todo #402 re-add the remaining port throughput data
+                PortThroughputData throughputData;
+                throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+                throughputData.m_accumulatedBlockingTimeInNanoseconds =
+                    port.getAccumulatedBlockingTime().toNanoseconds();
+                topic.m_throughputList.push_back(throughputData);
+            }
+        }
+    }
+
+    // there is one connection entry per subscriber; the latency histogram belongs to the queue of the subscriber
+    // which is shared by all its publishers, therefore it is reported without a publisher
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            auto connectionIndex = pair.second;
+            if (connectionIndex >= 0)
+            {
+                auto& connection = m_connectionContainer[connectionIndex];
+                auto subscriberPortData = connection.subscriberInfo.portData;
+                if (subscriberPortData == nullptr)
+                {
+                    continue;
+                }
+
+                auto statistics = subscriberPortData->m_queueLatencyHistogram.statistics();
+                // only subscribers which received chunks with a publish timestamp are reported
+                if (statistics.numberOfSamples == 0U)
+                {
+                    continue;
+                }
+
+                SubscriberLatencyData latencyData;
+                latencyData.m_subscriberPortID = static_cast<uint64_t>(subscriberPortData->m_uniqueId);
+                latencyData.m_numberOfSamples = statistics.numberOfSamples;
+                latencyData.m_p50LatencyInNanoseconds = statistics.p50InNanoseconds;
+                latencyData.m_p99LatencyInNanoseconds = statistics.p99InNanoseconds;
+                latencyData.m_maxLatencyInNanoseconds = statistics.maxInNanoseconds;
+                topic.m_latencyList.push_back(latencyData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -606,6 +660,9 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
                     // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+                    subscriberData.numberOfSkippedSamples =
+                        subscriberInfo.portData->m_chunkReceiverData.m_deliveryFilterState->m_numberOfSkippedChunks
+                            .load(std::memory_order_relaxed);
                 }
                 else
                 {
@@ -613,6 +670,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     subscriberData.fifoSize = 0u;
                     subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
                     subscriberData.propagationScope = capro::Scope::INVALID;
+                    subscriberData.numberOfSkippedSamples = 0U;
                 }
                 topic.subscriberPortChangingDataList.push_back(subscriberData);
             }
@@ -22,8 +22,11 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/discovery_request_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
@@ -45,6 +48,12 @@ class FixedPositionContainer
 
     void erase(T* const element);
 
+    /// @brief returns the stored element which contains the provided base object in constant time
+    /// @param[in] base pointer to the base object, it does not have to point into the container
+    /// @return pointer to the element or nullptr if no stored element contains the base object
+    template <typename Base>
+    T* get(const Base* const base);
+
     cxx::vector<T*, Capacity> content();
 
   private:
@@ -60,10 +69,14 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+    FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
 
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
     std::atomic<uint64_t> m_serviceRegistryChangeCounter{0};
+
+    popo::DiscoveryRequestQueueData m_discoveryRequestQueue;
 };
 
 } // namespace roudi
@@ -70,6 +70,32 @@ void FixedPositionContainer<T, Capacity>::erase(T* const element)
     }
 }
 
+template <typename T, uint64_t Capacity>
+template <typename Base>
+T* FixedPositionContainer<T, Capacity>::get(const Base* const base)
+{
+    if (m_data.empty())
+    {
+        return nullptr;
+    }
+
+    // the elements are stored in a contiguous array, the base object lies within the storage of its element
+    const auto address = reinterpret_cast<uintptr_t>(base);
+    const auto firstAddress = reinterpret_cast<uintptr_t>(&m_data[0]);
+    if (address < firstAddress)
+    {
+        return nullptr;
+    }
+
+    const uint64_t position = (address - firstAddress) / sizeof(cxx::optional<T>);
+    if (position >= m_data.size() || !m_data[position].has_value()
+        || static_cast<const Base*>(&m_data[position].value()) != base)
+    {
+        return nullptr;
+    }
+    return &m_data[position].value();
+}
+
 template <typename T, uint64_t Capacity>
 cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content()
 {
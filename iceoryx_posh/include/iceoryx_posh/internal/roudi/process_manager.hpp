@@ -19,18 +19,21 @@
 
 #include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/port_request.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <vector>
 
 namespace iox
 {
@@ -126,12 +129,31 @@ class ProcessManager : public ProcessManagerInterface
                                 const popo::PublisherOptions& publisherOptions,
                                 const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
+    void addClientForProcess(const RuntimeName_t& name,
+                             const capro::ServiceDescription& service,
+                             const popo::ClientOptions& clientOptions,
+                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    void addServerForProcess(const RuntimeName_t& name,
+                             const capro::ServiceDescription& service,
+                             const popo::ServerOptions& serverOptions,
+                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief Creates all requested publishers and subscribers and sends the result of every request with one
+    ///        CREATE_PORTS_ACK message to the application
+    /// @param [in] name of the process runtime which requested the ports
+    /// @param [in] portRequests the publishers and subscribers to create
+    void addPortsForProcess(const RuntimeName_t& name, const std::vector<runtime::PortRequest>& portRequests) noexcept;
+
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Does the discovery for the ports which requested it since the last call
+    void handleDiscoveryRequests() noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service,
                                                            const RuntimeName_t& process_name) noexcept;
 
@@ -145,6 +167,34 @@ class ProcessManager : public ProcessManagerInterface
                                  cxx::function_ref<void(Process&)> AndThenCallable,
                                  cxx::function_ref<void()> OrElseCallable) noexcept;
 
+    /// @return the offset of the new publisher port in the management segment or the error for the application
+    cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquirePublisherPortForProcess(Process& process,
+                                   const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @return the offset of the new subscriber port in the management segment or the error for the application
+    cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireSubscriberPortForProcess(Process& process,
+                                    const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @return the offset of the new client port in the management segment or the error for the application
+    cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireClientPortForProcess(Process& process,
+                                const capro::ServiceDescription& service,
+                                const popo::ClientOptions& clientOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @return the offset of the new server port in the management segment or the error for the application
+    cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireServerPortForProcess(Process& process,
+                                const capro::ServiceDescription& service,
+                                const popo::ServerOptions& serverOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
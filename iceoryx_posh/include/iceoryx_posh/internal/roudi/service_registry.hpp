@@ -1,4 +1,5 @@
 // Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,40 +17,170 @@
 #ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_HPP
 #define IOX_POSH_ROUDI_SERVICE_REGISTRY_HPP
 
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/cxx/set.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <cstdint>
-#include <map>
+#include <limits>
 
 namespace iox
 {
 namespace roudi
 {
-class ServiceRegistry
+enum class ServiceRegistryError
+{
+    INVALID_STATE,
+    SERVICE_REGISTRY_FULL
+};
+
+namespace internal
+{
+constexpr uint64_t powerOfTwoNotLessThan(const uint64_t value, const uint64_t candidate = 1U) noexcept
+{
+    return (candidate >= value) ? candidate : powerOfTwoNotLessThan(value, 2U * candidate);
+}
+} // namespace internal
+
+/// @brief The ServiceRegistry stores the offered services as pairs of service and instance. It does not allocate and
+/// has a fixed capacity. The entries are indexed by open addressing hash tables, one for the pair and one each for the
+/// service and the instance which are used for the wildcard queries. All entries with the same service, respectively
+/// the same instance, are linked with each other, so that a wildcard query only visits the matching entries.
+/// @tparam Capacity the maximum number of service and instance pairs
+template <uint32_t Capacity>
+class ServiceRegistryImpl
 {
   public:
     static constexpr uint32_t MAX_INSTANCES_PER_SERVICE = 100u;
     using CaproIdString_t = capro::IdString_t;
     using InstanceSet_t = cxx::vector<CaproIdString_t, MAX_INSTANCES_PER_SERVICE>;
-    struct instance_t
-    {
-        InstanceSet_t instanceSet;
-    };
-    using serviceMap_t = std::map<CaproIdString_t, instance_t>;
+    using EntryCallback_t = cxx::function_ref<void(const CaproIdString_t&, const CaproIdString_t&)>;
+
+    ServiceRegistryImpl() noexcept;
 
-    void add(const CaproIdString_t& service, const CaproIdString_t& instance);
-    void remove(const CaproIdString_t& service, const CaproIdString_t& instance);
+    ServiceRegistryImpl(const ServiceRegistryImpl&) = delete;
+    ServiceRegistryImpl(ServiceRegistryImpl&&) = delete;
+    ServiceRegistryImpl& operator=(const ServiceRegistryImpl&) = delete;
+    ServiceRegistryImpl& operator=(ServiceRegistryImpl&&) = delete;
+    ~ServiceRegistryImpl() noexcept = default;
+
+    /// @brief adds the service and instance pair, if the pair is already stored nothing happens
+    /// @param[in] service of the pair
+    /// @param[in] instance of the pair
+    /// @return ServiceRegistryError::SERVICE_REGISTRY_FULL if the capacity is exhausted, otherwise success
+    cxx::expected<ServiceRegistryError> add(const CaproIdString_t& service, const CaproIdString_t& instance) noexcept;
+
+    /// @brief removes the service and instance pair, if the pair is not stored nothing happens
+    /// @param[in] service of the pair
+    /// @param[in] instance of the pair
+    void remove(const CaproIdString_t& service, const CaproIdString_t& instance) noexcept;
+
+    /// @brief adds the instances of the stored pairs which match the provided service and instance to instances
+    /// @param[out] instances to which the matching instances are added, every instance is added only once
+    /// @param[in] service to search for, capro::AnyServiceString matches all services
+    /// @param[in] instance to search for, capro::AnyInstanceString matches all instances
     void find(InstanceSet_t& instances,
               const CaproIdString_t& service,
-              const CaproIdString_t& instance = capro::AnyInstanceString) const;
-    const serviceMap_t& getServiceMap() const;
+              const CaproIdString_t& instance = capro::AnyInstanceString) const noexcept;
+
+    /// @brief calls the callback for every stored pair which matches the provided service and instance
+    /// @param[in] service to search for, cxx::nullopt matches all services
+    /// @param[in] instance to search for, cxx::nullopt matches all instances
+    /// @param[in] callback which is called with the service and instance of every matching pair
+    void find(const cxx::optional<CaproIdString_t>& service,
+              const cxx::optional<CaproIdString_t>& instance,
+              const EntryCallback_t& callback) const noexcept;
+
+    /// @brief calls the callback for every stored pair
+    /// @param[in] callback which is called with the service and instance of every pair
+    void forEach(const EntryCallback_t& callback) const noexcept;
+
+    /// @brief returns the number of stored pairs
+    uint32_t size() const noexcept;
+
+    /// @brief returns the maximum number of pairs which can be stored
+    static constexpr uint32_t capacity() noexcept;
 
   private:
-    mutable serviceMap_t m_serviceMap;
+    using Index_t = uint32_t;
+    static constexpr Index_t INVALID_INDEX = std::numeric_limits<Index_t>::max();
+
+    /// @brief a load factor of at most 0.5 keeps the probe sequences short
+    static constexpr uint64_t NUMBER_OF_BUCKETS =
+        internal::powerOfTwoNotLessThan(2U * static_cast<uint64_t>(Capacity));
+
+    static_assert(Capacity > 0U, "The ServiceRegistry must be able to store at least one entry");
+    static_assert(Capacity < INVALID_INDEX, "The capacity exceeds the index range");
+
+    /// @brief the hash tables which index the entries
+    enum class Key : uint8_t
+    {
+        SERVICE_AND_INSTANCE,
+        SERVICE,
+        INSTANCE
+    };
+
+    struct Entry
+    {
+        CaproIdString_t service;
+        CaproIdString_t instance;
+        uint64_t serviceHash{0U};
+        uint64_t instanceHash{0U};
+        // circular lists of the entries with the same service, respectively instance; the next free entry is
+        // linked via nextWithSameService when the entry is not used
+        Index_t nextWithSameService{INVALID_INDEX};
+        Index_t previousWithSameService{INVALID_INDEX};
+        Index_t nextWithSameInstance{INVALID_INDEX};
+        Index_t previousWithSameInstance{INVALID_INDEX};
+        bool isUsed{false};
+    };
+
+    static uint64_t hash(const CaproIdString_t& value) noexcept;
+    static uint64_t combineHashes(const uint64_t serviceHash, const uint64_t instanceHash) noexcept;
+
+    uint64_t hashOf(const Key key, const Index_t entryIndex) const noexcept;
+    Index_t* bucketsOf(const Key key) noexcept;
+    const Index_t* bucketsOf(const Key key) const noexcept;
+
+    /// @brief searches the bucket of the entry with the provided key
+    /// @return the position of the bucket, INVALID_INDEX if there is no such entry
+    Index_t findBucket(const Key key,
+                       const uint64_t keyHash,
+                       const CaproIdString_t* const service,
+                       const CaproIdString_t* const instance) const noexcept;
+    void insertIntoBuckets(const Key key, const uint64_t keyHash, const Index_t entryIndex) noexcept;
+    /// @brief removes the bucket and moves the following entries of the probe sequence back to keep them reachable
+    void eraseBucket(const Key key, Index_t bucketPosition) noexcept;
+
+    void link(const Key key, const Index_t entryIndex) noexcept;
+    void unlink(const Key key, const Index_t entryIndex) noexcept;
+
+    Index_t& next(const Key key, const Index_t entryIndex) noexcept;
+    Index_t& previous(const Key key, const Index_t entryIndex) noexcept;
+    Index_t next(const Key key, const Index_t entryIndex) const noexcept;
+
+    void forEachWithSame(const Key key, const Index_t bucketPosition, const EntryCallback_t& callback) const noexcept;
+
+  private:
+    Entry m_entries[Capacity];
+    Index_t m_serviceAndInstanceBuckets[NUMBER_OF_BUCKETS];
+    Index_t m_serviceBuckets[NUMBER_OF_BUCKETS];
+    Index_t m_instanceBuckets[NUMBER_OF_BUCKETS];
+    Index_t m_freeListHead{0U};
+    uint32_t m_size{0U};
 };
+
+/// @brief every offered service stems from a publisher or an application port, the capacity accounts for all
+/// publishers and one offer per process
+using ServiceRegistry = ServiceRegistryImpl<MAX_PUBLISHERS + MAX_PROCESS_NUMBER>;
+
 } // namespace roudi
 } // namespace iox
 
+#include "iceoryx_posh/internal/roudi/service_registry.inl"
+
 #endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_HPP
@@ -0,0 +1,404 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_INL
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_INL
+
+namespace iox
+{
+namespace roudi
+{
+template <uint32_t Capacity>
+constexpr uint32_t ServiceRegistryImpl<Capacity>::MAX_INSTANCES_PER_SERVICE;
+template <uint32_t Capacity>
+constexpr typename ServiceRegistryImpl<Capacity>::Index_t ServiceRegistryImpl<Capacity>::INVALID_INDEX;
+template <uint32_t Capacity>
+constexpr uint64_t ServiceRegistryImpl<Capacity>::NUMBER_OF_BUCKETS;
+
+template <uint32_t Capacity>
+inline ServiceRegistryImpl<Capacity>::ServiceRegistryImpl() noexcept
+{
+    for (Index_t i = 0U; i < Capacity; ++i)
+    {
+        m_entries[i].nextWithSameService = (i + 1U < Capacity) ? i + 1U : INVALID_INDEX;
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        m_serviceAndInstanceBuckets[i] = INVALID_INDEX;
+        m_serviceBuckets[i] = INVALID_INDEX;
+        m_instanceBuckets[i] = INVALID_INDEX;
+    }
+}
+
+template <uint32_t Capacity>
+inline cxx::expected<ServiceRegistryError> ServiceRegistryImpl<Capacity>::add(const CaproIdString_t& service,
+                                                                              const CaproIdString_t& instance) noexcept
+{
+    const uint64_t serviceHash = hash(service);
+    const uint64_t instanceHash = hash(instance);
+    const uint64_t serviceAndInstanceHash = combineHashes(serviceHash, instanceHash);
+
+    if (findBucket(Key::SERVICE_AND_INSTANCE, serviceAndInstanceHash, &service, &instance) != INVALID_INDEX)
+    {
+        return cxx::success<>();
+    }
+
+    if (m_freeListHead == INVALID_INDEX)
+    {
+        return cxx::error<ServiceRegistryError>(ServiceRegistryError::SERVICE_REGISTRY_FULL);
+    }
+
+    const Index_t entryIndex = m_freeListHead;
+    auto& entry = m_entries[entryIndex];
+    m_freeListHead = entry.nextWithSameService;
+
+    entry.service = service;
+    entry.instance = instance;
+    entry.serviceHash = serviceHash;
+    entry.instanceHash = instanceHash;
+    entry.isUsed = true;
+
+    insertIntoBuckets(Key::SERVICE_AND_INSTANCE, serviceAndInstanceHash, entryIndex);
+    link(Key::SERVICE, entryIndex);
+    link(Key::INSTANCE, entryIndex);
+    ++m_size;
+
+    return cxx::success<>();
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::remove(const CaproIdString_t& service,
+                                                  const CaproIdString_t& instance) noexcept
+{
+    const uint64_t serviceAndInstanceHash = combineHashes(hash(service), hash(instance));
+    const Index_t bucketPosition = findBucket(Key::SERVICE_AND_INSTANCE, serviceAndInstanceHash, &service, &instance);
+    if (bucketPosition == INVALID_INDEX)
+    {
+        return;
+    }
+
+    const Index_t entryIndex = m_serviceAndInstanceBuckets[bucketPosition];
+    eraseBucket(Key::SERVICE_AND_INSTANCE, bucketPosition);
+    unlink(Key::SERVICE, entryIndex);
+    unlink(Key::INSTANCE, entryIndex);
+
+    auto& entry = m_entries[entryIndex];
+    entry.isUsed = false;
+    entry.nextWithSameService = m_freeListHead;
+    m_freeListHead = entryIndex;
+    --m_size;
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::find(InstanceSet_t& instances,
+                                                const CaproIdString_t& service,
+                                                const CaproIdString_t& instance) const noexcept
+{
+    cxx::optional<CaproIdString_t> serviceToFind;
+    if (service != CaproIdString_t(capro::AnyServiceString))
+    {
+        serviceToFind.emplace(service);
+    }
+
+    cxx::optional<CaproIdString_t> instanceToFind;
+    if (instance != CaproIdString_t(capro::AnyInstanceString))
+    {
+        instanceToFind.emplace(instance);
+    }
+
+    find(serviceToFind, instanceToFind, [&](const CaproIdString_t&, const CaproIdString_t& foundInstance) {
+        cxx::set::add(instances, foundInstance);
+    });
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::find(const cxx::optional<CaproIdString_t>& service,
+                                                const cxx::optional<CaproIdString_t>& instance,
+                                                const EntryCallback_t& callback) const noexcept
+{
+    if (service.has_value() && instance.has_value())
+    {
+        const uint64_t serviceAndInstanceHash = combineHashes(hash(*service), hash(*instance));
+        const Index_t bucketPosition =
+            findBucket(Key::SERVICE_AND_INSTANCE, serviceAndInstanceHash, &service.value(), &instance.value());
+        if (bucketPosition != INVALID_INDEX)
+        {
+            const auto& entry = m_entries[m_serviceAndInstanceBuckets[bucketPosition]];
+            callback(entry.service, entry.instance);
+        }
+    }
+    else if (service.has_value())
+    {
+        const Index_t bucketPosition = findBucket(Key::SERVICE, hash(*service), &service.value(), nullptr);
+        if (bucketPosition != INVALID_INDEX)
+        {
+            forEachWithSame(Key::SERVICE, bucketPosition, callback);
+        }
+    }
+    else if (instance.has_value())
+    {
+        const Index_t bucketPosition = findBucket(Key::INSTANCE, hash(*instance), nullptr, &instance.value());
+        if (bucketPosition != INVALID_INDEX)
+        {
+            forEachWithSame(Key::INSTANCE, bucketPosition, callback);
+        }
+    }
+    else
+    {
+        forEach(callback);
+    }
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::forEach(const EntryCallback_t& callback) const noexcept
+{
+    for (const auto& entry : m_entries)
+    {
+        if (entry.isUsed)
+        {
+            callback(entry.service, entry.instance);
+        }
+    }
+}
+
+template <uint32_t Capacity>
+inline uint32_t ServiceRegistryImpl<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint32_t Capacity>
+inline constexpr uint32_t ServiceRegistryImpl<Capacity>::capacity() noexcept
+{
+    return Capacity;
+}
+
+template <uint32_t Capacity>
+inline uint64_t ServiceRegistryImpl<Capacity>::hash(const CaproIdString_t& value) noexcept
+{
+    // FNV-1a
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t result = FNV_OFFSET_BASIS;
+    const char* const characters = value.c_str();
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        result ^= static_cast<uint8_t>(characters[i]);
+        result *= FNV_PRIME;
+    }
+    return result;
+}
+
+template <uint32_t Capacity>
+inline uint64_t ServiceRegistryImpl<Capacity>::combineHashes(const uint64_t serviceHash,
+                                                             const uint64_t instanceHash) noexcept
+{
+    constexpr uint64_t GOLDEN_RATIO{0x9e3779b97f4a7c15U};
+    return serviceHash ^ (instanceHash + GOLDEN_RATIO + (serviceHash << 6U) + (serviceHash >> 2U));
+}
+
+template <uint32_t Capacity>
+inline uint64_t ServiceRegistryImpl<Capacity>::hashOf(const Key key, const Index_t entryIndex) const noexcept
+{
+    const auto& entry = m_entries[entryIndex];
+    switch (key)
+    {
+    case Key::SERVICE:
+        return entry.serviceHash;
+    case Key::INSTANCE:
+        return entry.instanceHash;
+    default:
+        return combineHashes(entry.serviceHash, entry.instanceHash);
+    }
+}
+
+template <uint32_t Capacity>
+inline typename ServiceRegistryImpl<Capacity>::Index_t*
+ServiceRegistryImpl<Capacity>::bucketsOf(const Key key) noexcept
+{
+    return const_cast<Index_t*>(static_cast<const ServiceRegistryImpl*>(this)->bucketsOf(key));
+}
+
+template <uint32_t Capacity>
+inline const typename ServiceRegistryImpl<Capacity>::Index_t*
+ServiceRegistryImpl<Capacity>::bucketsOf(const Key key) const noexcept
+{
+    switch (key)
+    {
+    case Key::SERVICE:
+        return m_serviceBuckets;
+    case Key::INSTANCE:
+        return m_instanceBuckets;
+    default:
+        return m_serviceAndInstanceBuckets;
+    }
+}
+
+template <uint32_t Capacity>
+inline typename ServiceRegistryImpl<Capacity>::Index_t
+ServiceRegistryImpl<Capacity>::findBucket(const Key key,
+                                          const uint64_t keyHash,
+                                          const CaproIdString_t* const service,
+                                          const CaproIdString_t* const instance) const noexcept
+{
+    const Index_t* const buckets = bucketsOf(key);
+    // the load factor is at most 0.5, therefore the probing always reaches an empty bucket
+    for (uint64_t position = keyHash & (NUMBER_OF_BUCKETS - 1U); buckets[position] != INVALID_INDEX;
+         position = (position + 1U) & (NUMBER_OF_BUCKETS - 1U))
+    {
+        const Index_t entryIndex = buckets[position];
+        const auto& entry = m_entries[entryIndex];
+        if (hashOf(key, entryIndex) == keyHash && (service == nullptr || entry.service == *service)
+            && (instance == nullptr || entry.instance == *instance))
+        {
+            return static_cast<Index_t>(position);
+        }
+    }
+    return INVALID_INDEX;
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::insertIntoBuckets(const Key key,
+                                                             const uint64_t keyHash,
+                                                             const Index_t entryIndex) noexcept
+{
+    Index_t* const buckets = bucketsOf(key);
+    uint64_t position = keyHash & (NUMBER_OF_BUCKETS - 1U);
+    while (buckets[position] != INVALID_INDEX)
+    {
+        position = (position + 1U) & (NUMBER_OF_BUCKETS - 1U);
+    }
+    buckets[position] = entryIndex;
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::eraseBucket(const Key key, Index_t bucketPosition) noexcept
+{
+    Index_t* const buckets = bucketsOf(key);
+    buckets[bucketPosition] = INVALID_INDEX;
+
+    for (uint64_t position = (bucketPosition + 1U) & (NUMBER_OF_BUCKETS - 1U); buckets[position] != INVALID_INDEX;
+         position = (position + 1U) & (NUMBER_OF_BUCKETS - 1U))
+    {
+        const uint64_t homePosition = hashOf(key, buckets[position]) & (NUMBER_OF_BUCKETS - 1U);
+        const uint64_t distanceFromHome = (position - homePosition) & (NUMBER_OF_BUCKETS - 1U);
+        const uint64_t distanceFromGap = (position - bucketPosition) & (NUMBER_OF_BUCKETS - 1U);
+        // the entry may only be moved into the gap when the gap does not precede its home position
+        if (distanceFromHome >= distanceFromGap)
+        {
+            buckets[bucketPosition] = buckets[position];
+            buckets[position] = INVALID_INDEX;
+            bucketPosition = static_cast<Index_t>(position);
+        }
+    }
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::link(const Key key, const Index_t entryIndex) noexcept
+{
+    const auto& entry = m_entries[entryIndex];
+    const uint64_t keyHash = hashOf(key, entryIndex);
+    const Index_t bucketPosition = findBucket(key,
+                                              keyHash,
+                                              (key == Key::INSTANCE) ? nullptr : &entry.service,
+                                              (key == Key::SERVICE) ? nullptr : &entry.instance);
+    if (bucketPosition == INVALID_INDEX)
+    {
+        insertIntoBuckets(key, keyHash, entryIndex);
+        next(key, entryIndex) = entryIndex;
+        previous(key, entryIndex) = entryIndex;
+        return;
+    }
+
+    // append to the tail to keep the entries in the order they were added
+    const Index_t head = bucketsOf(key)[bucketPosition];
+    const Index_t tail = previous(key, head);
+    next(key, tail) = entryIndex;
+    previous(key, entryIndex) = tail;
+    next(key, entryIndex) = head;
+    previous(key, head) = entryIndex;
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::unlink(const Key key, const Index_t entryIndex) noexcept
+{
+    const auto& entry = m_entries[entryIndex];
+    const Index_t bucketPosition = findBucket(key,
+                                              hashOf(key, entryIndex),
+                                              (key == Key::INSTANCE) ? nullptr : &entry.service,
+                                              (key == Key::SERVICE) ? nullptr : &entry.instance);
+
+    const Index_t nextEntry = next(key, entryIndex);
+    if (nextEntry == entryIndex)
+    {
+        eraseBucket(key, bucketPosition);
+        return;
+    }
+
+    const Index_t previousEntry = previous(key, entryIndex);
+    next(key, previousEntry) = nextEntry;
+    previous(key, nextEntry) = previousEntry;
+
+    Index_t* const buckets = bucketsOf(key);
+    if (buckets[bucketPosition] == entryIndex)
+    {
+        buckets[bucketPosition] = nextEntry;
+    }
+}
+
+template <uint32_t Capacity>
+inline typename ServiceRegistryImpl<Capacity>::Index_t&
+ServiceRegistryImpl<Capacity>::next(const Key key, const Index_t entryIndex) noexcept
+{
+    return (key == Key::INSTANCE) ? m_entries[entryIndex].nextWithSameInstance
+                                  : m_entries[entryIndex].nextWithSameService;
+}
+
+template <uint32_t Capacity>
+inline typename ServiceRegistryImpl<Capacity>::Index_t&
+ServiceRegistryImpl<Capacity>::previous(const Key key, const Index_t entryIndex) noexcept
+{
+    return (key == Key::INSTANCE) ? m_entries[entryIndex].previousWithSameInstance
+                                  : m_entries[entryIndex].previousWithSameService;
+}
+
+template <uint32_t Capacity>
+inline typename ServiceRegistryImpl<Capacity>::Index_t
+ServiceRegistryImpl<Capacity>::next(const Key key, const Index_t entryIndex) const noexcept
+{
+    return (key == Key::INSTANCE) ? m_entries[entryIndex].nextWithSameInstance
+                                  : m_entries[entryIndex].nextWithSameService;
+}
+
+template <uint32_t Capacity>
+inline void ServiceRegistryImpl<Capacity>::forEachWithSame(const Key key,
+                                                           const Index_t bucketPosition,
+                                                           const EntryCallback_t& callback) const noexcept
+{
+    const Index_t head = bucketsOf(key)[bucketPosition];
+    Index_t entryIndex = head;
+    do
+    {
+        const auto& entry = m_entries[entryIndex];
+        callback(entry.service, entry.instance);
+        entryIndex = next(key, entryIndex);
+    } while (entryIndex != head);
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_INL
@@ -75,6 +75,12 @@ enum class IpcMessageType : int32_t
     REPLAY,
     SERVICE_REGISTRY_CHANGE_COUNTER,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS, // create multiple publishers and subscribers with one round trip
+    CREATE_PORTS_ACK,
+    CREATE_CLIENT,
+    CREATE_CLIENT_ACK,
+    CREATE_SERVER,
+    CREATE_SERVER_ACK,
     // etc..
     END,
 };
@@ -97,6 +103,12 @@ enum class IpcMessageErrorType : int32_t
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
+    REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT,
+    REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT,
+    CLIENT_LIST_FULL,
+    SERVER_LIST_FULL,
     END,
 };
 
@@ -0,0 +1,75 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief A single publisher or subscriber request of an IpcMessageType::CREATE_PORTS message. All ports which
+///         are requested in one CREATE_PORTS message are created by RouDi within one round trip.
+struct PortRequest
+{
+    enum class PortType : uint8_t
+    {
+        INVALID,
+        PUBLISHER,
+        SUBSCRIBER
+    };
+
+    /// @brief creates the request for a publisher port
+    /// @param[in] service the service description of the publisher
+    /// @param[in] publisherOptions the options of the publisher
+    /// @param[in] portConfigInfo the port configuration of the publisher
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::PublisherOptions& publisherOptions,
+                const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief creates the request for a subscriber port
+    /// @param[in] service the service description of the subscriber
+    /// @param[in] subscriberOptions the options of the subscriber
+    /// @param[in] portConfigInfo the port configuration of the subscriber
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::SubscriberOptions& subscriberOptions,
+                const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief serialization constructor, used by RouDi to create the PortRequest from a received CREATE_PORTS message
+    /// @param[in] serialized raw serialized string where all the values are stored
+    /// @note if the serialization is invalid, the port type is PortType::INVALID
+    PortRequest(const cxx::Serialization& serialized) noexcept;
+
+    /// @brief serialization of the port request
+    operator cxx::Serialization() const noexcept;
+
+    PortType m_portType{PortType::INVALID};
+    capro::ServiceDescription m_service;
+    popo::PublisherOptions m_publisherOptions;
+    popo::SubscriberOptions m_subscriberOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUEST_HPP
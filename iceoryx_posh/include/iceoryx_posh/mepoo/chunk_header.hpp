@@ -33,11 +33,27 @@ class ChunkSender;
 
 namespace mepoo
 {
+class MemoryManager;
+
 /// @brief Helper struct to use as default template parameter when no user-header is used
 struct NoUserHeader
 {
 };
 
+/// @brief Describes a contiguous part of the user-payload of a chunk chain, similar to an iovec
+struct UserPayloadPart
+{
+    void* data{nullptr};
+    uint32_t size{0U};
+};
+
+/// @brief Describes a contiguous read-only part of the user-payload of a chunk chain, similar to an iovec
+struct ConstUserPayloadPart
+{
+    const void* data{nullptr};
+    uint32_t size{0U};
+};
+
 struct ChunkHeader
 {
     using UserPayloadOffset_t = uint32_t;
@@ -59,7 +75,7 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{3U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -100,6 +116,16 @@ struct ChunkHeader
     /// @return the const pointer to the `ChunkHeader` or a `nullptr` if `userPayload` is a `nullptr`
     static const ChunkHeader* fromUserPayload(const void* const userPayload) noexcept;
 
+    /// @brief Get a pointer to the `ChunkHeader` associated to the user-header of the chunk
+    /// @param[in] userHeader is the pointer to the user-header of the chunk
+    /// @return the pointer to the `ChunkHeader` or a `nullptr` if `userHeader` is a `nullptr`
+    static ChunkHeader* fromUserHeader(void* const userHeader) noexcept;
+
+    /// @brief Get a const pointer to the `ChunkHeader` associated to the user-header of the chunk
+    /// @param[in] userHeader is the const pointer to the user-header of the chunk
+    /// @return the const pointer to the `ChunkHeader` or a `nullptr` if `userHeader` is a `nullptr`
+    static const ChunkHeader* fromUserHeader(const void* const userHeader) noexcept;
+
     /// @brief Calculates the used size of the chunk with the ChunkHeader, user-heander and user-payload
     /// @return the used size of the chunk
     uint32_t usedSizeOfChunk() const noexcept;
@@ -128,14 +154,64 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time the chunk was sent, if the publisher was created with the publishTimestamp option
+    /// @return the time since the epoch of the monotonic mepoo::BaseClock_t in nanoseconds or
+    /// NO_PUBLISH_TIMESTAMP if the chunk was not stamped
+    uint64_t publishTimestamp() const noexcept;
+
+    /// @brief Publish timestamp of a chunk which was not stamped by the publisher
+    static constexpr uint64_t NO_PUBLISH_TIMESTAMP{0U};
+
+    /// @brief A user-payload which is larger than the chunks of the mempools can be split into a chain of chunks, see
+    /// MemoryManager::getChainedChunk; only the first chunk of the chain has a user-header
+    /// @return the pointer to the ChunkHeader of the next chunk of the chain or a `nullptr` if there is none
+    ChunkHeader* nextChainedChunk() noexcept;
+
+    /// @brief Get a const pointer to the ChunkHeader of the next chunk of the chain
+    /// @return the const pointer to the ChunkHeader of the next chunk of the chain or a `nullptr` if there is none
+    const ChunkHeader* nextChainedChunk() const noexcept;
+
+    /// @brief The size of the user-payload of this chunk and all the following chunks of the chain
+    /// @return the accumulated user-payload size, which is the user-payload size if the chunk is not chained
+    uint64_t chainedUserPayloadSize() const noexcept;
+
+    /// @brief Describes the user-payload of this chunk and all the following chunks of the chain, like an iovec array
+    /// @param[in] parts the array which is filled with the parts of the user-payload in their order
+    /// @param[in] capacity the number of elements of the array
+    /// @return the number of parts of the chain; if it is larger than the capacity only the first parts are filled
+    uint64_t userPayloadParts(UserPayloadPart* const parts, const uint64_t capacity) noexcept;
+
+    /// @brief Describes the read-only user-payload of this chunk and all the following chunks of the chain
+    /// @param[in] parts the array which is filled with the parts of the user-payload in their order
+    /// @param[in] capacity the number of elements of the array
+    /// @return the number of parts of the chain; if it is larger than the capacity only the first parts are filled
+    uint64_t userPayloadParts(ConstUserPayloadPart* const parts, const uint64_t capacity) const noexcept;
+
+    /// @brief Scatters contiguous data into the user-payload of this chunk and the following chunks of the chain
+    /// @param[in] source the data to copy
+    /// @param[in] size the size of the data to copy
+    /// @return the number of copied bytes, which is less than size if the chain is too small
+    uint64_t copyToChainedUserPayload(const void* const source, const uint64_t size) noexcept;
+
+    /// @brief Gathers the user-payload of this chunk and the following chunks of the chain into contiguous memory
+    /// @param[in] destination the memory to copy the user-payload to
+    /// @param[in] size the size of the destination
+    /// @return the number of copied bytes, which is less than size if the chain is too small
+    uint64_t copyFromChainedUserPayload(void* const destination, const uint64_t size) const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
+    friend class MemoryManager;
 
     void setOriginId(UniquePortId originId) noexcept;
 
     void setSequenceNumber(uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(uint64_t publishTimestamp) noexcept;
+
+    void setNextChainedChunk(ChunkHeader* const nextChainedChunk) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -153,6 +229,10 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     UniquePortId m_originId{popo::InvalidId};
     uint64_t m_sequenceNumber{0U};
+    uint64_t m_publishTimestamp{NO_PUBLISH_TIMESTAMP};
+    // offset from this ChunkHeader to the ChunkHeader of the next chunk of a chunk chain, `0` if there is none; the
+    // chunks of a chain are in the same shared memory segment, therefore the offset is valid in every process
+    int64_t m_nextChainedChunkOffset{0};
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
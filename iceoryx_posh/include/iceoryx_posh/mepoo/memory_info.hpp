@@ -16,6 +16,8 @@
 #ifndef IOX_POSH_MEPOO_MEMORY_INFO_HPP
 #define IOX_POSH_MEPOO_MEMORY_INFO_HPP
 
+#include "iceoryx_hoofs/internal/posix_wrapper/numa.hpp"
+
 #include <cstdint>
 
 namespace iox
@@ -36,6 +38,8 @@ struct MemoryInfo
 
     uint32_t deviceId{DEFAULT_DEVICE_ID};
     uint32_t memoryType{DEFAULT_MEMORY_TYPE};
+    /// @brief the NUMA node the memory is preferably located on, posix::ANY_NUMA_NODE if there is no preference
+    uint32_t numaNode{posix::ANY_NUMA_NODE};
 
     MemoryInfo(const MemoryInfo&) = default;
     MemoryInfo(MemoryInfo&&) = default;
@@ -45,7 +49,10 @@ struct MemoryInfo
     /// @brief creates a MemoryInfo object
     /// @param[in] deviceId specifies the device where the memory is located
     /// @param[in] memoryType encodes additional information about the memory
-    MemoryInfo(uint32_t deviceId = DEFAULT_DEVICE_ID, uint32_t memoryType = DEFAULT_MEMORY_TYPE);
+    /// @param[in] numaNode specifies the NUMA node where the memory is preferably located
+    MemoryInfo(uint32_t deviceId = DEFAULT_DEVICE_ID,
+               uint32_t memoryType = DEFAULT_MEMORY_TYPE,
+               uint32_t numaNode = posix::ANY_NUMA_NODE);
 };
 } // namespace mepoo
 } // namespace iox
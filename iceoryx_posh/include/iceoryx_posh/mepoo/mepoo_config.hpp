@@ -47,6 +47,10 @@ struct MePooConfig
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief if enabled, a chunk is acquired from the next larger mempool with free chunks when the best fitting
+    /// mempool is exhausted, otherwise the allocation fails
+    bool m_fallbackToLargerMemPool{false};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
 
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -34,11 +35,13 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::string_t& readerGroup,
                      const posix::PosixGroup::string_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo())
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const posix::MappingOptions& mappingOptions = posix::MappingOptions())
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_mappingOptions(mappingOptions)
 
         {
         }
@@ -47,6 +50,9 @@ struct SegmentConfig
         posix::PosixGroup::string_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief huge pages, prefaulting and locking of the segment; applied by RouDi and by every application
+        /// which maps the segment
+        posix::MappingOptions m_mappingOptions;
     };
 
     cxx::vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
@@ -118,6 +118,10 @@ class BaseSubscriber
     /// port
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method to take multiple chunks in one pass with the `tryGetChunks` method of the port
+    cxx::expected<uint32_t, ChunkReceiveResult> takeChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                                           const uint32_t maxNumberOfChunks) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
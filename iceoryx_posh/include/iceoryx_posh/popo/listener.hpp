@@ -20,8 +20,10 @@
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
@@ -44,7 +46,9 @@ enum class ListenerError
 
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
-///        an encapsulated thread inside this class.
+///        an encapsulated thread inside this class. Optionally, the callbacks are executed by a fixed number of
+///        worker threads instead. Every event is bound to one worker, therefore the callbacks of an event are
+///        never executed concurrently and stay in order while a slow callback only delays the events of its worker.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
@@ -67,6 +71,12 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener which executes the callbacks in a pool of worker threads
+    /// @param[in] numberOfWorkers the number of worker threads, with 0 the callbacks are executed by the thread which
+    ///            waits for the events. At most MAX_NUMBER_OF_WORKERS_PER_LISTENER workers are created.
+    explicit Listener(const uint64_t numberOfWorkers) noexcept;
+
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener();
@@ -131,13 +141,20 @@ class Listener
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns the number of worker threads which execute the callbacks
+    /// @return number of worker threads, 0 when the callbacks are executed by the thread which waits for the events
+    uint64_t numberOfWorkers() const noexcept;
+
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkers = 0U) noexcept;
 
   private:
     class Event_t;
+    class Worker_t;
 
     void threadLoop() noexcept;
+    void workerLoop(Worker_t& worker) noexcept;
+    void scheduleEvent(const uint64_t eventId) noexcept;
     cxx::expected<uint32_t, ListenerError>
     addEvent(void* const origin,
              void* const userType,
@@ -203,6 +220,18 @@ class Listener
         std::atomic<uint64_t> m_indicesInUse{0U};
     } m_indexManager;
 
+    class Worker_t
+    {
+      public:
+        /// @brief the fifo is never full since an event is scheduled at most once
+        concurrent::FiFo<uint32_t, MAX_NUMBER_OF_EVENTS_PER_LISTENER> m_scheduledEvents;
+        posix::Semaphore m_wakeUp{posix::Semaphore::create(posix::CreateUnnamedSingleProcessSemaphore, 0U).value()};
+        std::thread m_thread;
+    };
+
+    uint64_t m_numberOfWorkers{0U};
+    Worker_t m_workers[MAX_NUMBER_OF_WORKERS_PER_LISTENER];
+    std::atomic_bool m_isEventScheduled[MAX_NUMBER_OF_EVENTS_PER_LISTENER];
 
     std::thread m_thread;
     concurrent::smart_lock<Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS_PER_LISTENER];
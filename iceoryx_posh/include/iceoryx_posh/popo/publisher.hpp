@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_TYPED_PUBLISHER_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 
@@ -57,6 +58,8 @@ class PublisherImpl : public BasePublisher_t, public PublisherInterface<T, H>
     static_assert(!std::is_pointer<H>::value, "The user-header must `H` not be a pointer.");
 
   public:
+    using SampleBatch_t = cxx::vector<Sample<T, H>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     PublisherImpl(const capro::ServiceDescription& service,
                   const PublisherOptions& publisherOptions = PublisherOptions());
     PublisherImpl(const PublisherImpl& other) = delete;
@@ -81,6 +84,22 @@ class PublisherImpl : public BasePublisher_t, public PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief loanBatch Get multiple samples from loaned shared memory and default construct their data.
+    /// @param numberOfSamples The number of samples to loan.
+    /// @return The samples that reside in shared memory or an error if not all of them could be loaned.
+    /// @details Either all or none of the requested samples are loaned. The loaned samples are automatically
+    /// released when they go out of scope.
+    ///
+    cxx::expected<SampleBatch_t, AllocationError> loanBatch(const uint32_t numberOfSamples) noexcept;
+
+    ///
+    /// @brief publishBatch Publishes the given samples in their order and then releases their loans.
+    /// @param samples The samples to publish.
+    /// @details Each subscriber is notified only once for the whole batch.
+    ///
+    void publishBatch(SampleBatch_t&& samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
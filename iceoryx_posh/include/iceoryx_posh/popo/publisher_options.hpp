@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 #define IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "port_queue_policies.hpp"
 #include <cstdint>
@@ -39,6 +40,22 @@ struct PublisherOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     SubscriberTooSlowPolicy subscriberTooSlowPolicy{SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The maximum time the publisher blocks on a full subscriber queue when the subscriberTooSlowPolicy is
+    /// WAIT_FOR_SUBSCRIBER, afterwards the sample is not delivered to this subscriber. Zero blocks until the subscriber
+    /// has space available
+    units::Duration maxBlockingTime{units::Duration::fromNanoseconds(0U)};
+
+    /// @brief The number of chunks the publisher acquires at once from the mempool and keeps for the following
+    /// allocations, at most MAX_CHUNKS_IN_CHUNK_CACHE. This reduces the contention on the mempools when multiple
+    /// publishers allocate with a high rate but the cached chunks are not available for other publishers. Zero disables
+    /// the cache
+    uint32_t chunkCacheSize{0U};
+
+    /// @brief The option whether the publisher stores the time of sending in the ChunkHeader of every sample. The
+    /// subscribers record the time the samples spent in their queue and the RouDi introspection reports the latency
+    /// percentiles per connection
+    bool publishTimestamp{false};
 };
 
 } // namespace popo
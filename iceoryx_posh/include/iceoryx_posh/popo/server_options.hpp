@@ -0,0 +1,44 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_SERVER_OPTIONS_HPP
+#define IOX_POSH_POPO_SERVER_OPTIONS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure the server
+struct ServerOptions
+{
+    /// @brief The size of the request queue where requests are stored before they are passed to the user
+    uint64_t requestQueueCapacity{ServerChunkQueueData_t::MAX_CAPACITY};
+
+    /// @brief The name of the node where the server should belong to
+    iox::NodeName_t nodeName{""};
+
+    /// @brief The option whether the server shall be offered when creating it
+    bool offerOnCreate{true};
+};
+
+} // namespace popo
+} // namespace iox
+#endif // IOX_POSH_POPO_SERVER_OPTIONS_HPP
@@ -48,6 +48,28 @@ class SubscriberImpl : public BaseSubscriber_t
     ///
     cxx::expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to maxNumberOfSamples samples from the top of the receive queue in one pass.
+    /// @param maxNumberOfSamples The maximum number of samples to take, at most MAX_SUBSCRIBER_QUEUE_CAPACITY.
+    /// @param callback Callable with the signature void(Sample<const T, const H>&&) which is called for every taken
+    /// sample in the order of reception.
+    /// @return Either the number of taken samples or a ChunkReceiveResult.
+    /// @details If the subscriber cannot hold all samples in parallel, only as many samples as can be held are taken
+    /// and the others stay in the receive queue.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, ChunkReceiveResult> takeBatch(const uint32_t maxNumberOfSamples,
+                                                          Callable&& callback) noexcept;
+
+    ///
+    /// @brief Take all samples which are currently in the receive queue in one pass.
+    /// @param callback Callable with the signature void(Sample<const T, const H>&&) which is called for every taken
+    /// sample in the order of reception.
+    /// @return Either the number of taken samples or a ChunkReceiveResult.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, ChunkReceiveResult> takeAll(Callable&& callback) noexcept;
+
     using PortType = typename BaseSubscriber_t::PortType;
     using SubscriberSampleDeleter = SampleDeleter<PortType>;
 
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_SUBSCRIBER_OPTIONS_HPP
 #define IOX_POSH_POPO_SUBSCRIBER_OPTIONS_HPP
 
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "port_queue_policies.hpp"
 
@@ -44,6 +45,14 @@ struct SubscriberOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     QueueFullPolicy queueFullPolicy{QueueFullPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief Only every n-th sample which is published is delivered to the subscriber, the other samples are skipped
+    /// by the publisher without touching the receiver queue; 1 delivers every sample
+    uint64_t decimationFactor{1U};
+
+    /// @brief The minimum time between two samples which are delivered to the subscriber, samples which are
+    /// published earlier are skipped by the publisher; it is applied after the decimation and zero disables the limit
+    units::Duration minDeliveryInterval{units::Duration::fromNanoseconds(0U)};
 };
 
 } // namespace popo
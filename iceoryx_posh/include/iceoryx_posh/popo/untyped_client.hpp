@@ -0,0 +1,156 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_CLIENT_HPP
+#define IOX_POSH_POPO_UNTYPED_CLIENT_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+
+namespace iox
+{
+namespace popo
+{
+enum class ClientEvent : EventEnumIdentifier
+{
+    RESPONSE_RECEIVED
+};
+
+enum class ClientState : StateEnumIdentifier
+{
+    HAS_RESPONSE
+};
+
+/// @brief The UntypedClient sends requests to the server which offers the same service and receives the responses.
+/// Requests and responses are transferred without copy, the payload is accessed via void pointers.
+/// @code
+/// iox::popo::UntypedClient client({"Radar", "FrontLeft", "Calibration"});
+/// client.loan(sizeof(uint64_t), alignof(uint64_t)).and_then([&](auto& requestPayload) {
+///     *static_cast<uint64_t*>(requestPayload) = 42U;
+///     client.send(requestPayload);
+/// });
+/// client.take().and_then([&](auto& responsePayload) {
+///     // process the response
+///     client.release(responsePayload);
+/// });
+/// @endcode
+class UntypedClient
+{
+  public:
+    UntypedClient(const capro::ServiceDescription& service, const ClientOptions& clientOptions = {}) noexcept;
+    ~UntypedClient() noexcept;
+
+    UntypedClient(const UntypedClient&) = delete;
+    UntypedClient(UntypedClient&&) = delete;
+    UntypedClient& operator=(const UntypedClient&) = delete;
+    UntypedClient& operator=(UntypedClient&&) = delete;
+
+    /// @brief Get the unique ID of the client
+    /// @return the client's unique ID
+    UniquePortId getUid() const noexcept;
+
+    /// @brief Get the service description of the client
+    /// @return the service description
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    /// @brief Initiate the connection to the server
+    void connect() noexcept;
+
+    /// @brief Disconnect from the server, requests cannot be sent anymore
+    void disconnect() noexcept;
+
+    /// @brief Get the current connection state
+    /// @return the current connection state
+    ConnectionState getConnectionState() const noexcept;
+
+    /// @brief Get a request chunk from the shared memory
+    /// @param[in] userPayloadSize the size of the request payload
+    /// @param[in] userPayloadAlignment the alignment of the request payload
+    /// @return on success a pointer to the request payload, otherwise the allocation error
+    cxx::expected<void*, AllocationError>
+    loan(const uint32_t userPayloadSize,
+         const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
+    /// @brief Release a loaned request without sending it
+    /// @param[in] requestPayload pointer to the payload of the loaned request
+    void releaseRequest(void* const requestPayload) noexcept;
+
+    /// @brief Send a loaned request to the server, the ownership of the request is transferred
+    /// @param[in] requestPayload pointer to the payload of the loaned request
+    /// @return ClientSendError::NOT_CONNECTED if the client is not connected, the request is released in this case
+    cxx::expected<ClientSendError> send(void* const requestPayload) noexcept;
+
+    /// @brief Take the next response from the response queue
+    /// @return on success a pointer to the response payload, otherwise ChunkReceiveResult
+    cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
+
+    /// @brief Release a response which was obtained with take
+    /// @param[in] responsePayload pointer to the payload of the response
+    void release(const void* const responsePayload) noexcept;
+
+    /// @brief Check if responses are available
+    /// @return true if there are responses in the queue
+    bool hasResponses() const noexcept;
+
+    /// @brief Check if responses have been missed since the last call of this method
+    /// @return true if responses have been missed due to an overflowing response queue
+    bool hasMissedResponses() noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] clientState the state which should be attached
+    void enableState(TriggerHandle&& triggerHandle, const ClientState clientState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the state corresponding
+    /// hasTriggered method callback
+    /// @param[in] clientState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const ClientState clientState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] clientState the state which should be detached
+    void disableState(const ClientState clientState) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    /// trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] clientEvent the event which should be attached
+    void enableEvent(TriggerHandle&& triggerHandle, const ClientEvent clientEvent) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Resets the internal triggerHandle
+    /// @param[in] clientEvent the event which should be detached
+    void disableEvent(const ClientEvent clientEvent) noexcept;
+
+  private:
+    ClientPortUser m_port;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_UNTYPED_CLIENT_HPP
@@ -51,6 +51,23 @@ class UntypedPublisherImpl : public BasePublisher_t
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
          const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
 
+    ///
+    /// @brief Get a chunk from loaned shared memory; if the user-payload does not fit into the largest mempool, it is
+    ///        split into a chain of chunks.
+    /// @param usePayloadSize The expected user-payload size of the whole chain.
+    /// @param userPayloadAlignment The expected user-payload alignment of each chunk of the chain.
+    /// @return A pointer to the user-payload of the first chunk of the chain or an AllocationError if the chain could
+    ///         not be loaned.
+    /// @note The user-payload is only contiguous within each chunk of the chain. The parts of the user-payload are
+    ///       accessed with mepoo::ChunkHeader::userPayloadParts or copied with
+    ///       mepoo::ChunkHeader::copyToChainedUserPayload. The chain is published and released like a single chunk.
+    ///
+    cxx::expected<void*, AllocationError>
+    loanChained(const uint32_t userPayloadSize,
+                const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+                const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
     ///
     /// @brief Publish the provided memory chunk.
     /// @param userPayload Pointer to the user-payload of the allocated shared memory chunk.
@@ -58,6 +75,29 @@ class UntypedPublisherImpl : public BasePublisher_t
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Get multiple chunks with the same layout from loaned shared memory.
+    /// @param userPayloads Array with at least numberOfChunks elements to store the user-payload pointers in.
+    /// @param numberOfChunks The number of chunks to loan.
+    /// @param usePayloadSize The expected user-payload size of the chunks.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunks.
+    /// @return An AllocationError if not all chunks could be loaned. In this case none of the chunks is loaned.
+    ///
+    cxx::expected<AllocationError>
+    loanBatch(void** const userPayloads,
+              const uint32_t numberOfChunks,
+              const uint32_t userPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+              const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+              const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
+    ///
+    /// @brief Publish the provided memory chunks in their order, each subscriber is notified only once.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks.
+    /// @param numberOfChunks The number of chunks to publish.
+    ///
+    void publishBatch(void* const* const userPayloads, const uint32_t numberOfChunks) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
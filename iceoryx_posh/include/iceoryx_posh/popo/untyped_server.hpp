@@ -0,0 +1,164 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_SERVER_HPP
+#define IOX_POSH_POPO_UNTYPED_SERVER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+
+namespace iox
+{
+namespace popo
+{
+enum class ServerEvent : EventEnumIdentifier
+{
+    REQUEST_RECEIVED
+};
+
+enum class ServerState : StateEnumIdentifier
+{
+    HAS_REQUEST
+};
+
+/// @brief The UntypedServer receives the requests of the connected clients and sends the responses back to the
+/// client which sent the corresponding request. Requests and responses are transferred without copy, the payload
+/// is accessed via void pointers.
+/// @code
+/// iox::popo::UntypedServer server({"Radar", "FrontLeft", "Calibration"});
+/// server.take().and_then([&](auto& requestPayload) {
+///     server.loan(requestPayload, sizeof(uint64_t), alignof(uint64_t)).and_then([&](auto& responsePayload) {
+///         *static_cast<uint64_t*>(responsePayload) = *static_cast<const uint64_t*>(requestPayload) + 1U;
+///         server.send(responsePayload);
+///     });
+///     server.release(requestPayload);
+/// });
+/// @endcode
+class UntypedServer
+{
+  public:
+    UntypedServer(const capro::ServiceDescription& service, const ServerOptions& serverOptions = {}) noexcept;
+    ~UntypedServer() noexcept;
+
+    UntypedServer(const UntypedServer&) = delete;
+    UntypedServer(UntypedServer&&) = delete;
+    UntypedServer& operator=(const UntypedServer&) = delete;
+    UntypedServer& operator=(UntypedServer&&) = delete;
+
+    /// @brief Get the unique ID of the server
+    /// @return the server's unique ID
+    UniquePortId getUid() const noexcept;
+
+    /// @brief Get the service description of the server
+    /// @return the service description
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    /// @brief Offer the service, clients can connect afterwards
+    void offer() noexcept;
+
+    /// @brief Stop offering the service, all clients are disconnected
+    void stopOffer() noexcept;
+
+    /// @brief Check if the service is offered
+    /// @return true if the service is offered
+    bool isOffered() const noexcept;
+
+    /// @brief Check if clients are connected
+    /// @return true if at least one client is connected
+    bool hasClients() const noexcept;
+
+    /// @brief Take the next request from the request queue
+    /// @return on success a pointer to the request payload, otherwise ChunkReceiveResult
+    cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
+
+    /// @brief Release a request which was obtained with take
+    /// @param[in] requestPayload pointer to the payload of the request
+    void release(const void* const requestPayload) noexcept;
+
+    /// @brief Get a response chunk from the shared memory for a received request
+    /// @param[in] requestPayload pointer to the payload of the request to which the response belongs
+    /// @param[in] userPayloadSize the size of the response payload
+    /// @param[in] userPayloadAlignment the alignment of the response payload
+    /// @return on success a pointer to the response payload, otherwise the allocation error
+    cxx::expected<void*, AllocationError>
+    loan(const void* const requestPayload,
+         const uint32_t userPayloadSize,
+         const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
+    /// @brief Release a loaned response without sending it
+    /// @param[in] responsePayload pointer to the payload of the loaned response
+    void releaseResponse(void* const responsePayload) noexcept;
+
+    /// @brief Send a loaned response to the client which sent the request, the ownership of the response is
+    /// transferred
+    /// @param[in] responsePayload pointer to the payload of the loaned response
+    /// @return ServerSendError if the server is not offered or the client is not connected anymore, the response is
+    /// released in this case
+    cxx::expected<ServerSendError> send(void* const responsePayload) noexcept;
+
+    /// @brief Check if requests are available
+    /// @return true if there are requests in the queue
+    bool hasRequests() const noexcept;
+
+    /// @brief Check if requests have been missed since the last call of this method
+    /// @return true if requests have been missed due to an overflowing request queue
+    bool hasMissedRequests() noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] serverState the state which should be attached
+    void enableState(TriggerHandle&& triggerHandle, const ServerState serverState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the state corresponding
+    /// hasTriggered method callback
+    /// @param[in] serverState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const ServerState serverState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] serverState the state which should be detached
+    void disableState(const ServerState serverState) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    /// trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] serverEvent the event which should be attached
+    void enableEvent(TriggerHandle&& triggerHandle, const ServerEvent serverEvent) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Resets the internal triggerHandle
+    /// @param[in] serverEvent the event which should be detached
+    void disableEvent(const ServerEvent serverEvent) noexcept;
+
+  private:
+    ServerPortUser m_port;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_UNTYPED_SERVER_HPP
@@ -55,6 +55,27 @@ class UntypedSubscriberImpl : public BaseSubscriber_t
     ///
     cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to maxNumberOfChunks chunks from the top of the receive queue in one pass.
+    /// @param maxNumberOfChunks The maximum number of chunks to take, at most MAX_SUBSCRIBER_QUEUE_CAPACITY.
+    /// @param callback Callable with the signature void(const void*) which is called with the user-payload pointer of
+    /// every taken chunk in the order of reception.
+    /// @return Either the number of taken chunks or a ChunkReceiveResult.
+    /// @details Like with take, every chunk must be manually released by calling `release`.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, ChunkReceiveResult> takeBatch(const uint32_t maxNumberOfChunks,
+                                                          Callable&& callback) noexcept;
+
+    ///
+    /// @brief Take all chunks which are currently in the receive queue in one pass.
+    /// @param callback Callable with the signature void(const void*) which is called with the user-payload pointer of
+    /// every taken chunk in the order of reception.
+    /// @return Either the number of taken chunks or a ChunkReceiveResult.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, ChunkReceiveResult> takeAll(Callable&& callback) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
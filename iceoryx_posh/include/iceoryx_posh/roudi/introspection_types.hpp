@@ -42,6 +42,7 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    uint64_t m_numFallbackChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -99,13 +100,27 @@ struct PortThroughputData
     uint32_t m_chunkSize{0};
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
+    uint64_t m_accumulatedBlockingTimeInNanoseconds{0};
     bool m_isField{false};
 };
 
+/// @brief the time samples spent in the queue of a subscriber since it was created, only samples from publishers
+/// with the publishTimestamp option are taken into account; the queue is shared by all publishers the subscriber is
+/// connected to, therefore the latencies are reported once per subscriber and not per publisher
+struct SubscriberLatencyData
+{
+    uint64_t m_subscriberPortID{0};
+    uint64_t m_numberOfSamples{0};
+    uint64_t m_p50LatencyInNanoseconds{0};
+    uint64_t m_p99LatencyInNanoseconds{0};
+    uint64_t m_maxLatencyInNanoseconds{0};
+};
+
 /// @brief the topic for the port throughput that a user can subscribe to
 struct PortThroughputIntrospectionFieldTopic
 {
     cxx::vector<PortThroughputData, MAX_PUBLISHERS> m_throughputList;
+    cxx::vector<SubscriberLatencyData, MAX_SUBSCRIBERS> m_latencyList;
 };
 
 const capro::ServiceDescription
@@ -118,6 +133,8 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // number of samples which were skipped by the publishers due to the decimation or the rate limit of the subscriber
+    uint64_t numberOfSkippedSamples{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -39,9 +39,12 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] ownership defines the ownership of the shared memory. "mine" controls the lifetime of the memory and
     /// "openExisting" will just use an already existing shared memory
+    /// @param [in] mappingOptions defines the huge pages, prefaulting and locking of the shared memory, every process
+    /// mapping the shared memory has to use the same page type
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OwnerShip ownership) noexcept;
+                           const posix::OwnerShip ownership,
+                           const posix::MappingOptions& mappingOptions = posix::MappingOptions()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -66,6 +69,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OwnerShip m_ownership{posix::OwnerShip::OPEN_EXISTING};
+    posix::MappingOptions m_mappingOptions;
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
 };
 
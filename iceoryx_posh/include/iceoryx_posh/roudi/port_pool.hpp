@@ -21,15 +21,21 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
 namespace iox
@@ -44,6 +50,8 @@ enum class PortPoolError : uint8_t
     UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS,
     PUBLISHER_PORT_LIST_FULL,
     SUBSCRIBER_PORT_LIST_FULL,
+    CLIENT_PORT_LIST_FULL,
+    SERVER_PORT_LIST_FULL,
     INTERFACE_PORT_LIST_FULL,
     APPLICATION_PORT_LIST_FULL,
     NODE_DATA_LIST_FULL,
@@ -63,6 +71,8 @@ class PortPool
     /// update this member if the publisher ports actually changed
     cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getPublisherPortDataList() noexcept;
     cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getSubscriberPortDataList() noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList() noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList() noexcept;
     cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
     cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER> getApplicationPortDataList() noexcept;
     cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
@@ -82,6 +92,20 @@ class PortPool
                       const popo::SubscriberOptions& subscriberOptions,
                       const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
+    cxx::expected<popo::ClientPortData*, PortPoolError>
+    addClientPort(const capro::ServiceDescription& serviceDescription,
+                  mepoo::MemoryManager* const memoryManager,
+                  const RuntimeName_t& runtimeName,
+                  const popo::ClientOptions& clientOptions,
+                  const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+
+    cxx::expected<popo::ServerPortData*, PortPoolError>
+    addServerPort(const capro::ServiceDescription& serviceDescription,
+                  mepoo::MemoryManager* const memoryManager,
+                  const RuntimeName_t& runtimeName,
+                  const popo::ServerOptions& serverOptions,
+                  const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+
     template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>* = nullptr>
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
@@ -109,13 +133,37 @@ class PortPool
 
     void removePublisherPort(PublisherPortRouDiType::MemberType_t* const portData) noexcept;
     void removeSubscriberPort(SubscriberPortType::MemberType_t* const portData) noexcept;
+    void removeClientPort(popo::ClientPortData* const portData) noexcept;
+    void removeServerPort(popo::ServerPortData* const portData) noexcept;
     void removeInterfacePort(popo::InterfacePortData* const portData) noexcept;
     void removeApplicationPort(popo::ApplicationPortData* const portData) noexcept;
     void removeNodeData(runtime::NodeData* const nodeData) noexcept;
     void removeConditionVariableData(popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief returns the publisher port which contains the provided base port data
+    /// @param[in] basePortData of the publisher port
+    /// @return the publisher port data or nullptr if basePortData does not belong to a publisher port in the pool
+    PublisherPortRouDiType::MemberType_t* getPublisherPortData(const popo::BasePortData* const basePortData) noexcept;
+
+    /// @brief returns the subscriber port which contains the provided base port data
+    /// @param[in] basePortData of the subscriber port
+    /// @return the subscriber port data or nullptr if basePortData does not belong to a subscriber port in the pool
+    SubscriberPortType::MemberType_t* getSubscriberPortData(const popo::BasePortData* const basePortData) noexcept;
+
+    /// @brief returns the client port which contains the provided base port data
+    /// @param[in] basePortData of the client port
+    /// @return the client port data or nullptr if basePortData does not belong to a client port in the pool
+    popo::ClientPortData* getClientPortData(const popo::BasePortData* const basePortData) noexcept;
+
+    /// @brief returns the server port which contains the provided base port data
+    /// @param[in] basePortData of the server port
+    /// @return the server port data or nullptr if basePortData does not belong to a server port in the pool
+    popo::ServerPortData* getServerPortData(const popo::BasePortData* const basePortData) noexcept;
+
     std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
 
+    popo::DiscoveryRequestQueueData& discoveryRequestQueue() noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
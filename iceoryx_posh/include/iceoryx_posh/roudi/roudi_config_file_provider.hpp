@@ -35,6 +35,9 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// SEGMENT_WITH_HUGE_PAGES_AND_SEPARATE_READER_GROUP - a hugetlbfs does not support access control lists, therefore
+///                                                     a segment with explicit huge pages must not have a reader group
+///                                                     which differs from the writer group
 enum class RouDiConfigFileParseError
 {
     INVALID_STATE,
@@ -46,7 +49,11 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
-    EXCEPTION_IN_PARSER
+    EXCEPTION_IN_PARSER,
+    SEGMENT_WITH_INVALID_PAGE_TYPE,
+    SEGMENT_WITH_INVALID_ZERO_INITIALIZATION,
+    SEGMENT_WITH_INVALID_NUMA_NODE,
+    SEGMENT_WITH_HUGE_PAGES_AND_SEPARATE_READER_GROUP
 };
 
 constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"INVALID_STATE",
@@ -58,7 +65,11 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"INVALID_STATE"
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
-                                                                 "EXCEPTION_IN_PARSER"};
+                                                                 "EXCEPTION_IN_PARSER",
+                                                                 "SEGMENT_WITH_INVALID_PAGE_TYPE",
+                                                                 "SEGMENT_WITH_INVALID_ZERO_INITIALIZATION",
+                                                                 "SEGMENT_WITH_INVALID_NUMA_NODE",
+                                                                 "SEGMENT_WITH_HUGE_PAGES_AND_SEPARATE_READER_GROUP"};
 
 /// @brief Base class for a config file provider.
 class RouDiConfigFileProvider
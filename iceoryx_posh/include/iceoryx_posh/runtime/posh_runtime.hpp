@@ -20,16 +20,22 @@
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/numa.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
+#include "iceoryx_posh/internal/runtime/port_request.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
@@ -121,6 +127,53 @@ class PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
+    /// @brief request the RouDi daemon to create a client port
+    /// @param[in] serviceDescription service description for the new client port
+    /// @param[in] clientOptions like the response queue capacity of a client
+    /// @param[in] portConfigInfo configuration information for the port
+    /// (what type of port is requested, device where its payload memory is located on etc.)
+    /// @return pointer to a created client port data
+    popo::ClientPortData* getMiddlewareClient(const capro::ServiceDescription& service,
+                                              const popo::ClientOptions& clientOptions = popo::ClientOptions(),
+                                              const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief request the RouDi daemon to create a server port
+    /// @param[in] serviceDescription service description for the new server port
+    /// @param[in] serverOptions like the request queue capacity of a server
+    /// @param[in] portConfigInfo configuration information for the port
+    /// (what type of port is requested, device where its payload memory is located on etc.)
+    /// @return pointer to a created server port data
+    popo::ServerPortData* getMiddlewareServer(const capro::ServiceDescription& service,
+                                              const popo::ServerOptions& serverOptions = popo::ServerOptions(),
+                                              const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief prepares the request of a publisher port. All prepared ports are created by the RouDi daemon with as
+    ///        few round trips as possible with the next call of getMiddlewarePublisher or getMiddlewareSubscriber.
+    ///        This speeds up the startup of applications with many ports.
+    /// @param[in] serviceDescription service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @note the prepared port is returned by getMiddlewarePublisher when it is called with the same arguments,
+    ///       a port which is prepared but never requested stays unused until the application terminates
+    /// @code
+    /// runtime.preparePublisher({"Radar", "FrontLeft", "Object"});
+    /// runtime.prepareSubscriber({"Radar", "FrontRight", "Object"});
+    /// // creates both ports with one request to RouDi
+    /// auto publisherPortData = runtime.getMiddlewarePublisher({"Radar", "FrontLeft", "Object"});
+    /// auto subscriberPortData = runtime.getMiddlewareSubscriber({"Radar", "FrontRight", "Object"});
+    /// @endcode
+    void preparePublisher(const capro::ServiceDescription& service,
+                          const popo::PublisherOptions& publisherOptions = popo::PublisherOptions(),
+                          const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief prepares the request of a subscriber port, see preparePublisher
+    /// @param[in] serviceDescription service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    void prepareSubscriber(const capro::ServiceDescription& service,
+                           const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
+                           const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -190,11 +243,44 @@ class PoshRuntime
     static PoshRuntime& getInstance(cxx::optional<const RuntimeName_t*> name) noexcept;
 
   private:
+    popo::PublisherOptions adjustedPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+
+    popo::SubscriberOptions adjustedSubscriberOptions(const popo::SubscriberOptions& subscriberOptions) const noexcept;
+
+    /// @brief sets the NUMA node of the process if the port does not request a specific one, RouDi prefers a segment
+    /// on this node for the chunks of the port
+    PortConfigInfo adjustedPortConfigInfo(const PortConfigInfo& portConfigInfo) const noexcept;
+
     cxx::expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestPublisherFromRoudi(const IpcMessage& sendBuffer, const PortRequest& portRequest) noexcept;
 
     cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestSubscriberFromRoudi(const IpcMessage& sendBuffer, const PortRequest& portRequest) noexcept;
+
+    cxx::expected<popo::ClientPortData*, IpcMessageErrorType>
+    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
+
+    cxx::expected<popo::ServerPortData*, IpcMessageErrorType>
+    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
+
+    void preparePort(const PortRequest& portRequest) noexcept;
+
+    /// @brief takes the response of RouDi to a prepared port request, all pending prepared ports are requested
+    ///        from RouDi beforehand
+    /// @param[in] portRequest the request of the port
+    /// @param[out] answer the response of RouDi in the format of a CREATE_PUBLISHER or CREATE_SUBSCRIBER request
+    /// @return true if the port was prepared and requested from RouDi, false otherwise, e.g. when the CREATE_PORTS
+    ///         request could not be sent; the answer is empty if RouDi responded with an unexpected message to the
+    ///         CREATE_PORTS request
+    bool takePreparedPort(const PortRequest& portRequest, IpcMessage& answer) noexcept;
+
+    /// @brief sends the pending prepared port requests with as few CREATE_PORTS messages as possible to RouDi; until
+    ///        RouDi acknowledged a CREATE_PORTS message, the messages are limited to LEGACY_ROUDI_MESSAGE_SIZE
+    void requestPreparedPortsFromRoudi() noexcept;
+
+    void sendCreatePortsRequestToRouDi(const IpcMessage& sendBuffer,
+                                       std::vector<std::string>::const_iterator firstPortRequest,
+                                       std::vector<std::string>::const_iterator endOfPortRequests) noexcept;
 
     cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
@@ -210,6 +296,18 @@ class PoshRuntime
     // Shared memory interface for POSIX IPC from RouDi
     SharedMemoryUser m_ShmInterface;
     popo::ApplicationPort m_applicationPort;
+    // the node is determined once so that prepared and acquired port requests are identical; a process which shall
+    // use the memory of a specific node is expected to be bound to it, e.g. with numactl
+    const uint32_t m_numaNode{posix::NumaTopology().nodeOfCurrentCpu().value_or(posix::ANY_NUMA_NODE)};
+
+    // the serialized port requests which are not yet sent to RouDi and the responses of RouDi to the sent ones
+    std::mutex m_preparedPortsMutex;
+    std::vector<std::string> m_preparedPortRequests;
+    std::multimap<std::string, std::string> m_preparedPorts;
+    // RouDi versions without CREATE_PORTS respond with MESSAGE_NOT_SUPPORTED, all ports are requested separately then
+    std::atomic<bool> m_isCreatePortsSupported{true};
+    // set with the first CREATE_PORTS_ACK, RouDi receives messages larger than LEGACY_ROUDI_MESSAGE_SIZE then
+    std::atomic<bool> m_isCreatePortsAcknowledged{false};
 
     std::atomic<bool> m_shutdownRequested{false};
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
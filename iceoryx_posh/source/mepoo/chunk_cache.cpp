@@ -0,0 +1,31 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+ChunkCache::ChunkCache(const uint32_t capacity) noexcept
+    : m_capacity(std::min(capacity, MAX_CHUNKS_IN_CHUNK_CACHE))
+{
+}
+
+} // namespace mepoo
+} // namespace iox
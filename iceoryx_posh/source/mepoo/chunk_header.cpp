@@ -16,13 +16,18 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
+#include <cstring>
+
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t ChunkHeader::NO_PUBLISH_TIMESTAMP;
+
 ChunkHeader::ChunkHeader(const uint32_t chunkSize, const ChunkSettings& chunkSettings) noexcept
     : m_chunkSize(chunkSize)
     , m_userHeaderSize(chunkSettings.userHeaderSize())
@@ -160,6 +165,21 @@ const ChunkHeader* ChunkHeader::fromUserPayload(const void* const userPayload) n
     return ChunkHeader::fromUserPayload(const_cast<void*>(userPayload));
 }
 
+ChunkHeader* ChunkHeader::fromUserHeader(void* const userHeader) noexcept
+{
+    if (userHeader == nullptr)
+    {
+        return nullptr;
+    }
+    // the user-header is always located directly after the ChunkHeader
+    return reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint64_t>(userHeader) - sizeof(ChunkHeader));
+}
+
+const ChunkHeader* ChunkHeader::fromUserHeader(const void* const userHeader) noexcept
+{
+    return ChunkHeader::fromUserHeader(const_cast<void*>(userHeader));
+}
+
 uint32_t ChunkHeader::usedSizeOfChunk() const noexcept
 {
     return static_cast<uint32_t>(overflowSafeUsedSizeOfChunk());
@@ -205,6 +225,107 @@ void ChunkHeader::setSequenceNumber(uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+    return m_publishTimestamp;
+}
+
+void ChunkHeader::setPublishTimestamp(uint64_t publishTimestamp) noexcept
+{
+    m_publishTimestamp = publishTimestamp;
+}
+
+ChunkHeader* ChunkHeader::nextChainedChunk() noexcept
+{
+    if (m_nextChainedChunkOffset == 0)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<ChunkHeader*>(reinterpret_cast<int64_t>(this) + m_nextChainedChunkOffset);
+}
+
+const ChunkHeader* ChunkHeader::nextChainedChunk() const noexcept
+{
+    return const_cast<ChunkHeader*>(this)->nextChainedChunk();
+}
+
+void ChunkHeader::setNextChainedChunk(ChunkHeader* const nextChainedChunk) noexcept
+{
+    m_nextChainedChunkOffset = (nextChainedChunk == nullptr)
+                                   ? 0
+                                   : reinterpret_cast<int64_t>(nextChainedChunk) - reinterpret_cast<int64_t>(this);
+}
+
+uint64_t ChunkHeader::chainedUserPayloadSize() const noexcept
+{
+    uint64_t size{0U};
+    for (auto chunkHeader = this; chunkHeader != nullptr; chunkHeader = chunkHeader->nextChainedChunk())
+    {
+        size += chunkHeader->userPayloadSize();
+    }
+    return size;
+}
+
+uint64_t ChunkHeader::userPayloadParts(UserPayloadPart* const parts, const uint64_t capacity) noexcept
+{
+    uint64_t numberOfParts{0U};
+    for (auto chunkHeader = this; chunkHeader != nullptr; chunkHeader = chunkHeader->nextChainedChunk())
+    {
+        if (numberOfParts < capacity)
+        {
+            parts[numberOfParts].data = chunkHeader->userPayload();
+            parts[numberOfParts].size = chunkHeader->userPayloadSize();
+        }
+        ++numberOfParts;
+    }
+    return numberOfParts;
+}
+
+uint64_t ChunkHeader::userPayloadParts(ConstUserPayloadPart* const parts, const uint64_t capacity) const noexcept
+{
+    uint64_t numberOfParts{0U};
+    for (auto chunkHeader = this; chunkHeader != nullptr; chunkHeader = chunkHeader->nextChainedChunk())
+    {
+        if (numberOfParts < capacity)
+        {
+            parts[numberOfParts].data = chunkHeader->userPayload();
+            parts[numberOfParts].size = chunkHeader->userPayloadSize();
+        }
+        ++numberOfParts;
+    }
+    return numberOfParts;
+}
+
+uint64_t ChunkHeader::copyToChainedUserPayload(const void* const source, const uint64_t size) noexcept
+{
+    auto sourceBytes = static_cast<const uint8_t*>(source);
+    uint64_t copiedBytes{0U};
+    for (auto chunkHeader = this; chunkHeader != nullptr && copiedBytes < size;
+         chunkHeader = chunkHeader->nextChainedChunk())
+    {
+        const uint64_t partSize = algorithm::min(static_cast<uint64_t>(chunkHeader->userPayloadSize()),
+                                                 size - copiedBytes);
+        std::memcpy(chunkHeader->userPayload(), sourceBytes + copiedBytes, partSize);
+        copiedBytes += partSize;
+    }
+    return copiedBytes;
+}
+
+uint64_t ChunkHeader::copyFromChainedUserPayload(void* const destination, const uint64_t size) const noexcept
+{
+    auto destinationBytes = static_cast<uint8_t*>(destination);
+    uint64_t copiedBytes{0U};
+    for (auto chunkHeader = this; chunkHeader != nullptr && copiedBytes < size;
+         chunkHeader = chunkHeader->nextChainedChunk())
+    {
+        const uint64_t partSize = algorithm::min(static_cast<uint64_t>(chunkHeader->userPayloadSize()),
+                                                 size - copiedBytes);
+        std::memcpy(destinationBytes + copiedBytes, chunkHeader->userPayload(), partSize);
+        copiedBytes += partSize;
+    }
+    return copiedBytes;
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
@@ -30,11 +30,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t numFallbackChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_numFallbackChunks(numFallbackChunks)
 {
 }
 
@@ -93,6 +95,25 @@ void* MemPool::getChunk() noexcept
     return m_rawMemory + l_index * m_chunkSize;
 }
 
+uint32_t MemPool::getChunkIndices(cxx::not_null<freeList_t::Index_t*> chunkIndices,
+                                  const uint32_t maxNumberOfChunks) noexcept
+{
+    const auto numberOfChunks = m_freeIndices.popBatch(chunkIndices, maxNumberOfChunks);
+
+    if (numberOfChunks > 0U)
+    {
+        m_usedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return numberOfChunks;
+}
+
+void* MemPool::getChunkFromIndex(const freeList_t::Index_t chunkIndex) const noexcept
+{
+    return m_rawMemory + static_cast<uint64_t>(chunkIndex) * m_chunkSize;
+}
+
 void MemPool::freeChunk(const void* chunk) noexcept
 {
     cxx::Expects(m_rawMemory <= chunk
@@ -111,6 +132,17 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+void MemPool::freeChunkIndices(cxx::not_null<const freeList_t::Index_t*> chunkIndices,
+                               const uint32_t numberOfChunks) noexcept
+{
+    if (!m_freeIndices.pushBatch(chunkIndices, numberOfChunks))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -131,12 +163,23 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint64_t MemPool::getNumFallbackChunks() const noexcept
+{
+    return m_numFallbackChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::increaseNumFallbackChunks() noexcept
+{
+    m_numFallbackChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_numFallbackChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
@@ -20,9 +20,10 @@ namespace iox
 {
 namespace mepoo
 {
-MemoryInfo::MemoryInfo(uint32_t deviceId, uint32_t memoryType)
+MemoryInfo::MemoryInfo(uint32_t deviceId, uint32_t memoryType, uint32_t numaNode)
     : deviceId(deviceId)
     , memoryType(memoryType)
+    , numaNode(numaNode)
 {
 }
 } // namespace mepoo
@@ -27,11 +27,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::MAX_NUMBER_OF_CHAINED_CHUNKS;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -67,6 +70,7 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
     }
 
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_chunkSizeLookupTable.emplace_back(adjustedChunkSize);
     m_totalNumberOfChunks += numberOfChunks;
 }
 
@@ -86,7 +90,7 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
 {
     if (index >= m_memPoolVector.size())
     {
-        return {0, 0, 0, 0};
+        return {0, 0, 0, 0, 0};
     }
     return m_memPoolVector[index].getInfo();
 }
@@ -145,30 +149,36 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_fallbackToLargerMemPool = mePooConfig.m_fallbackToLargerMemPool;
 
     generateChunkManagementPool(managementAllocator);
 }
 
-SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+uint32_t MemoryManager::getIndexOfBestFittingMemPool(const uint32_t requiredChunkSize) const noexcept
 {
-    void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
-
-    uint32_t aquiredChunkSize = 0U;
+    // branchless lower bound search; the number of iterations only depends on the number of mempools and the
+    // comparison is compiled to a conditional move, therefore there are no mispredicted branches
+    if (m_chunkSizeLookupTable.empty())
+    {
+        return 0U;
+    }
 
-    for (auto& memPool : m_memPoolVector)
+    const uint32_t* base = m_chunkSizeLookupTable.begin();
+    auto length = m_chunkSizeLookupTable.size();
+    while (length > 1U)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
-        {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
-        }
+        const auto half = length / 2U;
+        base = (base[half] < requiredChunkSize) ? base + half : base;
+        length -= half;
     }
 
+    return static_cast<uint32_t>(base - m_chunkSizeLookupTable.begin()) + ((*base < requiredChunkSize) ? 1U : 0U);
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+
     if (m_memPoolVector.size() == 0)
     {
         LogFatal() << "There are no mempools available!";
@@ -176,7 +186,9 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, nullptr, ErrorLevel::SEVERE);
         return SharedChunk(nullptr);
     }
-    else if (memPoolPointer == nullptr)
+
+    const auto bestFittingIndex = getIndexOfBestFittingMemPool(requiredChunkSize);
+    if (bestFittingIndex >= m_memPoolVector.size())
     {
         auto log = LogFatal();
         log << "The following mempools are available:";
@@ -187,7 +199,25 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, nullptr, ErrorLevel::SEVERE);
         return SharedChunk(nullptr);
     }
-    else if (chunk == nullptr)
+
+    MemPool* memPoolPointer = &m_memPoolVector[bestFittingIndex];
+    void* chunk = memPoolPointer->getChunk();
+
+    if (chunk == nullptr && m_fallbackToLargerMemPool)
+    {
+        for (auto index = bestFittingIndex + 1U; chunk == nullptr && index < m_memPoolVector.size(); ++index)
+        {
+            memPoolPointer = &m_memPoolVector[index];
+            chunk = memPoolPointer->getChunk();
+        }
+
+        if (chunk != nullptr)
+        {
+            m_memPoolVector[bestFittingIndex].increaseNumFallbackChunks();
+        }
+    }
+
+    if (chunk == nullptr)
     {
         auto log = LogError();
         log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
@@ -198,13 +228,199 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
         return SharedChunk(nullptr);
     }
-    else
+
+    auto chunkHeader = new (chunk) ChunkHeader(memPoolPointer->getChunkSize(), chunkSettings);
+    auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+    return SharedChunk(chunkManagement);
+}
+
+SharedChunk MemoryManager::getChainedChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    if (m_memPoolVector.empty()
+        || getIndexOfBestFittingMemPool(chunkSettings.requiredChunkSize()) < m_memPoolVector.size())
+    {
+        // no chain is required, the error handling is done by getChunk
+        return getChunk(chunkSettings);
+    }
+
+    // the required chunk size grows linearly with the user-payload size, therefore the space which is not available
+    // for the user-payload can be determined with an empty user-payload; only the first chunk has a user-header
+    const uint32_t userPayloadAlignment = chunkSettings.userPayloadAlignment();
+    const uint32_t firstChunkOverhead = chunkSettings.requiredChunkSize() - chunkSettings.userPayloadSize();
+    const uint32_t followingChunkOverhead =
+        ChunkSettings::create(0U, userPayloadAlignment).value().requiredChunkSize();
+
+    auto reportUnavailableChain = [&] {
+        auto log = LogError();
+        log << "MemoryManager: unable to acquire a chunk chain with a user-payload size of "
+            << chunkSettings.userPayloadSize() << " from at most " << MAX_NUMBER_OF_CHAINED_CHUNKS << " chunks";
+        log << "The following mempools are available:";
+        printMemPoolVector(log);
+        log.Flush();
+        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+    };
+
+    // the chain is planned with the free chunks of the mempools before any chunk is acquired, this way a chain which
+    // cannot be completed or which exceeds MAX_NUMBER_OF_CHAINED_CHUNKS does not drain the smaller mempools
+    cxx::vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> numberOfFreeChunks;
+    for (auto& memPool : m_memPoolVector)
+    {
+        numberOfFreeChunks.emplace_back(memPool.getChunkCount() - memPool.getUsedChunks());
+    }
+
+    cxx::vector<uint32_t, MAX_NUMBER_OF_CHAINED_CHUNKS> memPoolIndices;
+    uint64_t remainingUserPayloadSize = chunkSettings.userPayloadSize();
+    while (memPoolIndices.empty() || remainingUserPayloadSize > 0U)
+    {
+        const uint32_t overhead = memPoolIndices.empty() ? firstChunkOverhead : followingChunkOverhead;
+
+        // the remaining user-payload might fit into a smaller mempool, otherwise the largest one is used; when the
+        // mempool is exhausted the next smaller one which can hold more than the overhead is tried
+        const uint64_t requiredChunkSize = overhead + remainingUserPayloadSize;
+        auto index = static_cast<int64_t>(getIndexOfBestFittingMemPool(static_cast<uint32_t>(
+            algorithm::min(requiredChunkSize, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())))));
+        for (index = algorithm::min(index, static_cast<int64_t>(m_memPoolVector.size()) - 1); index >= 0; --index)
+        {
+            const auto i = static_cast<uint64_t>(index);
+            if (numberOfFreeChunks[i] > 0U && m_memPoolVector[i].getChunkSize() > overhead)
+            {
+                break;
+            }
+        }
+
+        if (index < 0 || memPoolIndices.size() == MAX_NUMBER_OF_CHAINED_CHUNKS)
+        {
+            reportUnavailableChain();
+            return SharedChunk(nullptr);
+        }
+
+        const auto i = static_cast<uint64_t>(index);
+        --numberOfFreeChunks[i];
+        memPoolIndices.emplace_back(static_cast<uint32_t>(index));
+        const uint64_t userPayloadSize = m_memPoolVector[i].getChunkSize() - overhead;
+        remainingUserPayloadSize -= algorithm::min(remainingUserPayloadSize, userPayloadSize);
+    }
+
+    SharedChunk firstChunk;
+    ChunkHeader* previousChunkHeader{nullptr};
+    ChunkManagement* previousChunkManagement{nullptr};
+    remainingUserPayloadSize = chunkSettings.userPayloadSize();
+    for (const auto index : memPoolIndices)
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        const bool isFirstChunk = !firstChunk;
+        const uint32_t overhead = isFirstChunk ? firstChunkOverhead : followingChunkOverhead;
+
+        MemPool* memPoolPointer = &m_memPoolVector[index];
+        void* chunk = memPoolPointer->getChunk();
+        if (chunk == nullptr)
+        {
+            // another thread acquired a planned chunk in the meantime; the already acquired chunks of the chain are
+            // released with the first chunk
+            reportUnavailableChain();
+            return SharedChunk(nullptr);
+        }
+
+        const uint32_t userPayloadSize = static_cast<uint32_t>(
+            algorithm::min(remainingUserPayloadSize, static_cast<uint64_t>(memPoolPointer->getChunkSize() - overhead)));
+        const auto partSettings = isFirstChunk ? ChunkSettings::create(userPayloadSize,
+                                                                       userPayloadAlignment,
+                                                                       chunkSettings.userHeaderSize(),
+                                                                       chunkSettings.userHeaderAlignment())
+                                               : ChunkSettings::create(userPayloadSize, userPayloadAlignment);
+
+        auto chunkHeader = new (chunk) ChunkHeader(memPoolPointer->getChunkSize(), partSettings.value());
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return SharedChunk(chunkManagement);
+
+        if (isFirstChunk)
+        {
+            firstChunk = SharedChunk(chunkManagement);
+        }
+        else
+        {
+            previousChunkHeader->setNextChainedChunk(chunkHeader);
+            previousChunkManagement->m_nextChainedChunk = chunkManagement;
+        }
+        previousChunkHeader = chunkHeader;
+        previousChunkManagement = chunkManagement;
+        remainingUserPayloadSize -= userPayloadSize;
+    }
+
+    return firstChunk;
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept
+{
+    if (chunkCache.m_capacity == 0U)
+    {
+        return getChunk(chunkSettings);
+    }
+
+    const auto bestFittingIndex = getIndexOfBestFittingMemPool(chunkSettings.requiredChunkSize());
+    if (bestFittingIndex >= m_memPoolVector.size())
+    {
+        // the error handling is done by the uncached getChunk
+        return getChunk(chunkSettings);
+    }
+
+    MemPool* memPool = &m_memPoolVector[bestFittingIndex];
+    if (chunkCache.m_memPool.get() != memPool)
+    {
+        releaseChunkCache(chunkCache);
+        chunkCache.m_memPool = memPool;
+    }
+
+    if (chunkCache.m_size == 0U)
+    {
+        refillChunkCache(chunkCache);
+
+        if (chunkCache.m_size == 0U)
+        {
+            // the mempool is exhausted, the uncached getChunk takes care of the fallback and the error handling
+            return getChunk(chunkSettings);
+        }
+    }
+
+    --chunkCache.m_size;
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+    auto chunkHeader = new (memPool->getChunkFromIndex(chunkCache.m_chunkIndices[chunkCache.m_size]))
+        ChunkHeader(memPool->getChunkSize(), chunkSettings);
+    auto chunkManagement =
+        new (chunkManagementPool.getChunkFromIndex(chunkCache.m_chunkManagementIndices[chunkCache.m_size]))
+            ChunkManagement(chunkHeader, memPool, &chunkManagementPool);
+    return SharedChunk(chunkManagement);
+}
+
+void MemoryManager::refillChunkCache(ChunkCache& chunkCache) noexcept
+{
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    auto numberOfChunks = chunkCache.m_memPool->getChunkIndices(chunkCache.m_chunkIndices, chunkCache.m_capacity);
+    auto numberOfChunkManagements =
+        m_chunkManagementPool.front().getChunkIndices(chunkCache.m_chunkManagementIndices, numberOfChunks);
+
+    if (numberOfChunkManagements < numberOfChunks)
+    {
+        chunkCache.m_memPool->freeChunkIndices(&chunkCache.m_chunkIndices[numberOfChunkManagements],
+                                               numberOfChunks - numberOfChunkManagements);
+    }
+    chunkCache.m_size = numberOfChunkManagements;
+    // END of critical section
+}
+
+void MemoryManager::releaseChunkCache(ChunkCache& chunkCache) noexcept
+{
+    if (chunkCache.m_size == 0U)
+    {
+        return;
     }
+
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    chunkCache.m_memPool->freeChunkIndices(chunkCache.m_chunkIndices, chunkCache.m_size);
+    m_chunkManagementPool.front().freeChunkIndices(chunkCache.m_chunkManagementIndices, chunkCache.m_size);
+    chunkCache.m_size = 0U;
+    // END of critical section
 }
+
 } // namespace mepoo
 } // namespace iox
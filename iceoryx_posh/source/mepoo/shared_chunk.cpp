@@ -61,8 +61,15 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    // the chunks of a chunk chain have no reference counter of their own and are released with the first chunk
+    ChunkManagement* chunkManagement = m_chunkManagement;
+    while (chunkManagement != nullptr)
+    {
+        ChunkManagement* nextChainedChunk = chunkManagement->m_nextChainedChunk.get();
+        chunkManagement->m_mempool->freeChunk(chunkManagement->m_chunkHeader);
+        chunkManagement->m_chunkManagementPool->freeChunk(chunkManagement);
+        chunkManagement = nextChainedChunk;
+    }
     m_chunkManagement = nullptr;
 }
 
@@ -22,26 +22,26 @@ namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
-    : m_condVarDataPtr(&condVarData)
+namespace
 {
-}
-
-void ConditionListener::resetSemaphore() noexcept
+uint64_t countTrailingZeros(const uint64_t value) noexcept
 {
-    // Count the semaphore down to zero
-    bool hasFatalError = false;
-    while (!hasFatalError
-           && getMembers()
-                  ->m_semaphore.tryWait()
-                  .or_else([&](posix::SemaphoreError) {
-                      errorHandler(
-                          Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET, nullptr, ErrorLevel::FATAL);
-                      hasFatalError = true;
-                  })
-                  .value())
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t count = 0U;
+    for (uint64_t bits = value; (bits & 1U) == 0U; bits >>= 1U)
     {
+        ++count;
     }
+    return count;
+#endif
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+    : m_condVarDataPtr(&condVarData)
+{
 }
 
 void ConditionListener::destroy() noexcept
@@ -54,14 +54,7 @@ void ConditionListener::destroy() noexcept
 
 bool ConditionListener::wasNotified() const noexcept
 {
-    auto result = getMembers()->m_semaphore.getValue();
-    if (result.has_error())
-    {
-        errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAS_TRIGGERED, nullptr, ErrorLevel::FATAL);
-        return false;
-    }
-
-    return *result != 0;
+    return getMembers()->hasActiveNotifications();
 }
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
@@ -90,37 +83,50 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
 
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
-    resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                reset(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
+        // announce the upcoming sleep before checking the notifications a last time, a notifier which sets its
+        // notification afterwards sees the announcement and posts the semaphore
+        getMembers()->m_isListenerWaiting.store(true, std::memory_order_seq_cst);
+        if (getMembers()->hasActiveNotifications())
+        {
+            getMembers()->m_isListenerWaiting.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
+        getMembers()->m_isListenerWaiting.store(false, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::reset(const uint64_t index) noexcept
+void ConditionListener::collectNotifications(NotificationVector_t& activeNotifications) noexcept
 {
-    if (index < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
+    using Type_t = NotificationVector_t::value_type;
+    using NotificationWord_t = ConditionVariableData::NotificationWord_t;
+
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
     {
-        getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
+        NotificationWord_t word =
+            getMembers()->m_activeNotifications[wordIndex].exchange(0U, std::memory_order_acquire);
+        while (word != 0U)
+        {
+            const uint64_t index =
+                wordIndex * ConditionVariableData::BITS_PER_NOTIFICATION_WORD + countTrailingZeros(word);
+            activeNotifications.emplace_back(static_cast<Type_t>(index));
+            // clear the lowest set bit
+            word &= word - 1U;
+        }
     }
 }
 
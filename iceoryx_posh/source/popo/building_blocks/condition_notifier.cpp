@@ -38,11 +38,21 @@ void ConditionNotifier::notify() noexcept
 {
     if (m_notificationIndex < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
     {
-        getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+        const auto bitMask = ConditionVariableData::NotificationWord_t(1U)
+                             << (m_notificationIndex % ConditionVariableData::BITS_PER_NOTIFICATION_WORD);
+        getMembers()
+            ->m_activeNotifications[m_notificationIndex / ConditionVariableData::BITS_PER_NOTIFICATION_WORD]
+            .fetch_or(bitMask, std::memory_order_seq_cst);
+    }
+
+    // pairs with the listener which announces that it is going to sleep before it checks the notifications again;
+    // either the listener sees the notification or we see the sleeping listener
+    if (getMembers()->m_isListenerWaiting.exchange(false, std::memory_order_seq_cst))
+    {
+        getMembers()->m_semaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
+        });
     }
-    getMembers()->m_semaphore.post().or_else([](auto) {
-        errorHandler(Error::kPOPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
-    });
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
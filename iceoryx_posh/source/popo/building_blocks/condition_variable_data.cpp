@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -29,10 +32,33 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
+    {
+        word.store(0U, std::memory_order_relaxed);
+    }
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    if (index >= MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
+    {
+        return false;
+    }
+
+    const NotificationWord_t bitMask = NotificationWord_t(1U) << (index % BITS_PER_NOTIFICATION_WORD);
+    return (m_activeNotifications[index / BITS_PER_NOTIFICATION_WORD].load(std::memory_order_relaxed) & bitMask) != 0U;
+}
+
+bool ConditionVariableData::hasActiveNotifications() const noexcept
+{
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        if (word.load(std::memory_order_seq_cst) != 0U)
+        {
+            return true;
+        }
     }
+    return false;
 }
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,150 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+uint32_t indexOfMostSignificantBit(const uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63U - static_cast<uint32_t>(__builtin_clzll(value));
+#else
+    uint32_t index = 0U;
+    for (uint64_t bits = value >> 1U; bits != 0U; bits >>= 1U)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/// @brief nearest-rank method, the rank of the sample below which the percentage of all samples lie
+uint64_t rankOfPercentile(const uint64_t numberOfSamples, const uint64_t percent) noexcept
+{
+    return std::max((numberOfSamples * percent + 99U) / 100U, static_cast<uint64_t>(1U));
+}
+} // namespace
+
+constexpr uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint32_t LatencyHistogram::NUMBER_OF_SUB_BUCKETS;
+constexpr uint32_t LatencyHistogram::MAX_EXPONENT;
+constexpr uint32_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+LatencyHistogram::LatencyHistogram() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    m_buckets[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+
+    uint64_t maxInNanoseconds = m_maxInNanoseconds.load(std::memory_order_relaxed);
+    while (latencyInNanoseconds > maxInNanoseconds
+           && !m_maxInNanoseconds.compare_exchange_weak(
+               maxInNanoseconds, latencyInNanoseconds, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencyStatistics LatencyHistogram::statistics() const noexcept
+{
+    // work on a snapshot to have consistent ranks while the histogram is recorded concurrently
+    uint64_t counts[NUMBER_OF_BUCKETS];
+    LatencyStatistics statistics;
+    for (uint32_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        statistics.numberOfSamples += counts[i];
+    }
+    statistics.maxInNanoseconds = m_maxInNanoseconds.load(std::memory_order_relaxed);
+
+    if (statistics.numberOfSamples == 0U)
+    {
+        return statistics;
+    }
+
+    const uint64_t rankOfP50 = rankOfPercentile(statistics.numberOfSamples, 50U);
+    const uint64_t rankOfP99 = rankOfPercentile(statistics.numberOfSamples, 99U);
+    uint64_t accumulatedCount{0U};
+    for (uint32_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        const uint64_t previousAccumulatedCount = accumulatedCount;
+        accumulatedCount += counts[i];
+        // the maximum is exact and therefore a tighter bound for the highest bucket
+        const uint64_t upperBound = std::min(bucketUpperBound(i), statistics.maxInNanoseconds);
+        if (previousAccumulatedCount < rankOfP50 && accumulatedCount >= rankOfP50)
+        {
+            statistics.p50InNanoseconds = upperBound;
+        }
+        if (previousAccumulatedCount < rankOfP99 && accumulatedCount >= rankOfP99)
+        {
+            statistics.p99InNanoseconds = upperBound;
+            break;
+        }
+    }
+
+    return statistics;
+}
+
+uint32_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    if (latencyInNanoseconds < NUMBER_OF_SUB_BUCKETS)
+    {
+        return static_cast<uint32_t>(latencyInNanoseconds);
+    }
+
+    const uint32_t exponent = indexOfMostSignificantBit(latencyInNanoseconds);
+    if (exponent >= MAX_EXPONENT)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    // the sub bucket consists of the SUB_BUCKET_BITS below the most significant bit
+    const uint32_t shift = exponent - SUB_BUCKET_BITS;
+    const auto subBucket = static_cast<uint32_t>(latencyInNanoseconds >> shift) - NUMBER_OF_SUB_BUCKETS;
+    return (shift + 1U) * NUMBER_OF_SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint32_t index) noexcept
+{
+    if (index < NUMBER_OF_SUB_BUCKETS)
+    {
+        return index;
+    }
+    if (index >= NUMBER_OF_BUCKETS - 1U)
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    const uint32_t shift = index / NUMBER_OF_SUB_BUCKETS - 1U;
+    const uint64_t subBucket = index % NUMBER_OF_SUB_BUCKETS + NUMBER_OF_SUB_BUCKETS;
+    return ((subBucket + 1U) << shift) - 1U;
+}
+
+} // namespace popo
+} // namespace iox
@@ -16,8 +16,12 @@
 
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
+#include <algorithm>
+#include <functional>
+
 namespace iox
 {
 namespace popo
@@ -27,10 +31,31 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
-    : m_conditionVariableData(&conditionVariable)
+Listener::Listener(const uint64_t numberOfWorkers) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), numberOfWorkers)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const uint64_t numberOfWorkers) noexcept
+    : m_numberOfWorkers(std::min(numberOfWorkers, static_cast<uint64_t>(MAX_NUMBER_OF_WORKERS_PER_LISTENER)))
+    , m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    if (numberOfWorkers > MAX_NUMBER_OF_WORKERS_PER_LISTENER)
+    {
+        LogWarn() << "Listener requested " << numberOfWorkers << " workers but supports at most "
+                  << MAX_NUMBER_OF_WORKERS_PER_LISTENER << ", limiting to " << MAX_NUMBER_OF_WORKERS_PER_LISTENER;
+    }
+
+    for (auto& isEventScheduled : m_isEventScheduled)
+    {
+        isEventScheduled.store(false, std::memory_order_relaxed);
+    }
+
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        m_workers[i].m_thread = std::thread(&Listener::workerLoop, this, std::ref(m_workers[i]));
+    }
     m_thread = std::thread(&Listener::threadLoop, this);
 }
 
@@ -40,6 +65,12 @@ Listener::~Listener()
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        cxx::Expects(!m_workers[i].m_wakeUp.post().has_error());
+        m_workers[i].m_thread.join();
+    }
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -81,13 +112,58 @@ uint64_t Listener::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+uint64_t Listener::numberOfWorkers() const noexcept
+{
+    return m_numberOfWorkers;
+}
+
 void Listener::threadLoop() noexcept
 {
     while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
     {
         auto activateNotificationIds = m_conditionListener.wait();
 
-        cxx::forEach(activateNotificationIds, [this](auto id) { m_events[id]->executeCallback(); });
+        if (m_numberOfWorkers == 0U)
+        {
+            cxx::forEach(activateNotificationIds, [this](auto id) { m_events[id]->executeCallback(); });
+        }
+        else
+        {
+            cxx::forEach(activateNotificationIds, [this](auto id) { scheduleEvent(id); });
+        }
+    }
+}
+
+void Listener::scheduleEvent(const uint64_t eventId) noexcept
+{
+    // an event which is already scheduled but not yet executed needs no second callback, like a notification which
+    // arrives while the condition listener is not waiting
+    if (m_isEventScheduled[eventId].exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // the fixed assignment of an event to a worker keeps the callbacks of an event in order
+    auto& worker = m_workers[eventId % m_numberOfWorkers];
+    cxx::Expects(worker.m_scheduledEvents.push(static_cast<uint32_t>(eventId)));
+    cxx::Expects(!worker.m_wakeUp.post().has_error());
+}
+
+void Listener::workerLoop(Worker_t& worker) noexcept
+{
+    while (true)
+    {
+        cxx::Expects(!worker.m_wakeUp.wait().has_error());
+        if (m_wasDtorCalled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        worker.m_scheduledEvents.pop().and_then([this](auto eventId) {
+            // reset before the execution, a notification during the callback schedules the event again
+            m_isEventScheduled[eventId].store(false, std::memory_order_release);
+            m_events[eventId]->executeCallback();
+        });
     }
 }
 
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -69,6 +70,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    requestDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +78,29 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::requestDiscovery() noexcept
+{
+    auto discoveryRequestQueue = getMembers()->m_discoveryRequestQueue.get();
+    if (discoveryRequestQueue == nullptr)
+    {
+        return;
+    }
+
+    if (getMembers()->m_isDiscoveryRequested.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    if (!discoveryRequestQueue->m_requests.tryPush(rp::RelativePointer<BasePortData>(getMembers())))
+    {
+        // the cyclic discovery of RouDi takes care of the port
+        getMembers()->m_isDiscoveryRequested.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    ConditionNotifier(discoveryRequestQueue->m_conditionVariableData, DiscoveryRequestQueueData::NOTIFICATION_INDEX)
+        .notify();
+}
+
 } // namespace popo
 } // namespace iox
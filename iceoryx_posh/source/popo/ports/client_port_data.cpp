@@ -23,13 +23,17 @@ namespace popo
 {
 ClientPortData::ClientPortData(const capro::ServiceDescription& serviceDescription,
                                const RuntimeName_t& runtimeName,
-                               const NodeName_t& nodeName,
                                mepoo::MemoryManager* const memoryManager,
+                               const ClientOptions& clientOptions,
                                const mepoo::MemoryInfo& memoryInfo) noexcept
-    : BasePortData(serviceDescription, runtimeName, nodeName)
+    : BasePortData(serviceDescription, runtimeName, clientOptions.nodeName)
     , m_chunkSenderData(memoryManager, CLIENT_SUBSCRIBER_POLICY, 0, memoryInfo)
     , m_chunkReceiverData(cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer, CLIENT_PUBLISHER_POLICY)
+    , m_connectRequested(clientOptions.connectOnCreate)
 {
+    m_chunkReceiverData.m_queue.setCapacity(clientOptions.responseQueueCapacity);
+    // the responses of the servers are routed back to the response queue with the unique id of the client
+    m_chunkReceiverData.m_uniqueId = m_uniqueId;
 }
 
 } // namespace popo
@@ -40,21 +40,131 @@ ClientPortRouDi::MemberType_t* ClientPortRouDi::getMembers() noexcept
 
 cxx::optional<capro::CaproMessage> ClientPortRouDi::tryGetCaProMessage() noexcept
 {
-    /// @todo
+    // get connect request from user side
+    const auto currentConnectRequest = getMembers()->m_connectRequested.load(std::memory_order_relaxed);
 
-    // nothing to change
-    return cxx::nullopt_t();
+    const auto currentConnectionState = getMembers()->m_connectionState.load(std::memory_order_relaxed);
+
+    if (currentConnectRequest && (ConnectionState::NOT_CONNECTED == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectionMessage(capro::CaproMessageType::CONNECT));
+    }
+    else if (!currentConnectRequest && (ConnectionState::CONNECTED == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::DISCONNECT_REQUESTED, std::memory_order_relaxed);
+
+        // no requests are sent to the server anymore
+        m_chunkSender.removeAllQueues();
+        getMembers()->m_connectedServerQueue = nullptr;
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectionMessage(capro::CaproMessageType::DISCONNECT));
+    }
+    else if (!currentConnectRequest && (ConnectionState::WAIT_FOR_OFFER == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        return cxx::nullopt_t();
+    }
+    else
+    {
+        // nothing to change
+        return cxx::nullopt_t();
+    }
 }
 
 cxx::optional<capro::CaproMessage>
-ClientPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& /*caProMessage*/) noexcept
+ClientPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept
 {
-    /// @todo
+    const auto currentConnectionState = getMembers()->m_connectionState.load(std::memory_order_relaxed);
+
+    if ((capro::CaproMessageType::OFFER == caProMessage.m_type)
+        && (ConnectionState::WAIT_FOR_OFFER == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectionMessage(capro::CaproMessageType::CONNECT));
+    }
+    else if ((capro::CaproMessageType::STOP_OFFER == caProMessage.m_type)
+             && (ConnectionState::CONNECTED == currentConnectionState)
+             && (caProMessage.m_chunkQueueData == static_cast<void*>(getMembers()->m_connectedServerQueue.get())))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+
+        m_chunkSender.removeAllQueues();
+        getMembers()->m_connectedServerQueue = nullptr;
 
-    capro::CaproMessage responseMessage(
-        capro::CaproMessageType::NACK, this->getCaProServiceDescription(), capro::CaproMessageSubType::NOSUBTYPE);
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::ACK == caProMessage.m_type)
+    {
+        if (ConnectionState::CONNECT_REQUESTED == currentConnectionState)
+        {
+            // the ACK of the server carries its request queue
+            auto serverQueue = static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData);
+            if (m_chunkSender.tryAddQueue(serverQueue).has_error())
+            {
+                getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+            }
+            else
+            {
+                getMembers()->m_connectedServerQueue = serverQueue;
+                getMembers()->m_connectionState.store(ConnectionState::CONNECTED, std::memory_order_relaxed);
+            }
+        }
+        else if (ConnectionState::DISCONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        }
+        else
+        {
+            errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::MODERATE);
+        }
 
-    return cxx::make_optional<capro::CaproMessage>(responseMessage);
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::NACK == caProMessage.m_type)
+    {
+        if (ConnectionState::CONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        }
+        else if (ConnectionState::DISCONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        }
+        else
+        {
+            errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::MODERATE);
+        }
+
+        return cxx::nullopt_t();
+    }
+    else if ((capro::CaproMessageType::OFFER == caProMessage.m_type)
+             || (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type))
+    {
+        // No state change, e.g. a further server offers the service while the client is already connected or a server
+        // the client is not connected to stops offering
+        return cxx::nullopt_t();
+    }
+    else
+    {
+        errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::SEVERE);
+        return cxx::nullopt_t();
+    }
+}
+
+ConnectionState ClientPortRouDi::getConnectionState() const noexcept
+{
+    return getMembers()->m_connectionState.load(std::memory_order_relaxed);
+}
+
+capro::CaproMessage ClientPortRouDi::createConnectionMessage(const capro::CaproMessageType type) noexcept
+{
+    capro::CaproMessage caproMessage(type, BasePort::getMembers()->m_serviceDescription);
+    // the server delivers the responses to the response queue of the client
+    caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+    return caproMessage;
 }
 
 void ClientPortRouDi::releaseAllChunks() noexcept
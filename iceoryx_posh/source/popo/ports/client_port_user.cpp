@@ -40,29 +40,57 @@ ClientPortUser::MemberType_t* ClientPortUser::getMembers() noexcept
 }
 
 cxx::expected<RequestHeader*, AllocationError>
-ClientPortUser::allocateRequest(const uint32_t /*userPayloadSize*/) noexcept
+ClientPortUser::allocateRequest(const uint32_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
 {
-    return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    auto allocateResult = m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(RequestHeader), alignof(RequestHeader));
+
+    if (allocateResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocateResult.get_error());
+    }
+
+    auto requestHeader = new (allocateResult.value()->userHeader()) RequestHeader(getUniqueID());
+    return cxx::success<RequestHeader*>(requestHeader);
 }
 
-void ClientPortUser::freeRequest(RequestHeader* const /*requestHeader*/) noexcept
+void ClientPortUser::freeRequest(RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    m_chunkSender.release(requestHeader->getChunkHeader());
 }
 
-void ClientPortUser::sendRequest(RequestHeader* const /*requestHeader*/) noexcept
+cxx::expected<ClientSendError> ClientPortUser::sendRequest(RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    if (getMembers()->m_connectionState.load(std::memory_order_relaxed) != ConnectionState::CONNECTED)
+    {
+        // without a server the request would be delivered to nobody and the user would wait in vain for a response
+        m_chunkSender.release(requestHeader->getChunkHeader());
+        return cxx::error<ClientSendError>(ClientSendError::NOT_CONNECTED);
+    }
+
+    m_chunkSender.send(requestHeader->getChunkHeader());
+    return cxx::success<void>();
 }
 
 void ClientPortUser::connect() noexcept
 {
-    /// @todo
+    if (!getMembers()->m_connectRequested.load(std::memory_order_relaxed))
+    {
+        // start with new responses, drop old ones that could be in the queue
+        m_chunkReceiver.clear();
+
+        getMembers()->m_connectRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
+    }
 }
 
 void ClientPortUser::disconnect() noexcept
 {
-    /// @todo
+    if (getMembers()->m_connectRequested.load(std::memory_order_relaxed))
+    {
+        getMembers()->m_connectRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
+    }
 }
 
 ConnectionState ClientPortUser::getConnectionState() const noexcept
@@ -70,15 +98,22 @@ ConnectionState ClientPortUser::getConnectionState() const noexcept
     return getMembers()->m_connectionState;
 }
 
-cxx::expected<cxx::optional<const ResponseHeader*>, ChunkReceiveResult> ClientPortUser::getResponse() noexcept
+cxx::expected<const ResponseHeader*, ChunkReceiveResult> ClientPortUser::getResponse() noexcept
 {
-    /// @todo
-    return cxx::success<cxx::optional<const ResponseHeader*>>(cxx::nullopt_t());
+    auto getChunkResult = m_chunkReceiver.tryGet();
+
+    if (getChunkResult.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(getChunkResult.get_error());
+    }
+
+    return cxx::success<const ResponseHeader*>(
+        static_cast<const ResponseHeader*>(getChunkResult.value()->userHeader()));
 }
 
-void ClientPortUser::releaseResponse(const ResponseHeader* const /*responseHeader*/) noexcept
+void ClientPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    m_chunkReceiver.release(responseHeader->getChunkHeader());
 }
 
 bool ClientPortUser::hasNewResponses() const noexcept
@@ -0,0 +1,123 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+
+namespace iox
+{
+namespace popo
+{
+RPCBaseHeader::RPCBaseHeader(const UniquePortId& clientId, const int64_t sequenceNumber) noexcept
+    : m_clientId(clientId)
+    , m_sequenceNumber(sequenceNumber)
+{
+}
+
+UniquePortId RPCBaseHeader::getClientId() const noexcept
+{
+    return m_clientId;
+}
+
+int64_t RPCBaseHeader::getSequenceNumber() const noexcept
+{
+    return m_sequenceNumber;
+}
+
+mepoo::ChunkHeader* RPCBaseHeader::getChunkHeader() noexcept
+{
+    return mepoo::ChunkHeader::fromUserHeader(this);
+}
+
+const mepoo::ChunkHeader* RPCBaseHeader::getChunkHeader() const noexcept
+{
+    return mepoo::ChunkHeader::fromUserHeader(this);
+}
+
+void* RPCBaseHeader::getUserPayload() noexcept
+{
+    return getChunkHeader()->userPayload();
+}
+
+const void* RPCBaseHeader::getUserPayload() const noexcept
+{
+    return getChunkHeader()->userPayload();
+}
+
+RequestHeader::RequestHeader(const UniquePortId& clientId) noexcept
+    : RPCBaseHeader(clientId, 0)
+{
+}
+
+void RequestHeader::setSequenceNumber(const int64_t sequenceNumber) noexcept
+{
+    m_sequenceNumber = sequenceNumber;
+}
+
+void RequestHeader::setFireAndForget(const bool fireAndForget) noexcept
+{
+    m_isFireAndForget = fireAndForget;
+}
+
+bool RequestHeader::isFireAndForget() const noexcept
+{
+    return m_isFireAndForget;
+}
+
+RequestHeader* RequestHeader::fromUserPayload(void* const userPayload) noexcept
+{
+    if (userPayload == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<RequestHeader*>(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader());
+}
+
+const RequestHeader* RequestHeader::fromUserPayload(const void* const userPayload) noexcept
+{
+    return RequestHeader::fromUserPayload(const_cast<void*>(userPayload));
+}
+
+ResponseHeader::ResponseHeader(const UniquePortId& clientId, const int64_t sequenceNumber) noexcept
+    : RPCBaseHeader(clientId, sequenceNumber)
+{
+}
+
+void ResponseHeader::setServerError(bool serverError) noexcept
+{
+    m_hasServerError = serverError;
+}
+
+bool ResponseHeader::hasServerError() const noexcept
+{
+    return m_hasServerError;
+}
+
+ResponseHeader* ResponseHeader::fromUserPayload(void* const userPayload) noexcept
+{
+    if (userPayload == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<ResponseHeader*>(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader());
+}
+
+const ResponseHeader* ResponseHeader::fromUserPayload(const void* const userPayload) noexcept
+{
+    return ResponseHeader::fromUserPayload(const_cast<void*>(userPayload));
+}
+
+} // namespace popo
+} // namespace iox
@@ -48,6 +48,16 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+cxx::expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateChainedChunk(const uint32_t userPayloadSize,
+                                           const uint32_t userPayloadAlignment,
+                                           const uint32_t userHeaderSize,
+                                           const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateChained(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +81,25 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders,
+                                   const uint32_t numberOfChunks) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // see sendChunk, the chunks are put in the history in the order they would have been sent
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +110,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -89,6 +119,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -102,5 +133,10 @@ bool PublisherPortUser::hasSubscribers() const noexcept
     return m_chunkSender.hasStoredQueues();
 }
 
+units::Duration PublisherPortUser::getAccumulatedBlockingTime() const noexcept
+{
+    return m_chunkSender.getAccumulatedBlockingTime();
+}
+
 } // namespace popo
 } // namespace iox
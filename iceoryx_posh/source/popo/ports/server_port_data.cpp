@@ -23,13 +23,15 @@ namespace popo
 {
 ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescription,
                                const RuntimeName_t& runtimeName,
-                               const NodeName_t& nodeName,
                                mepoo::MemoryManager* const memoryManager,
+                               const ServerOptions& serverOptions,
                                const mepoo::MemoryInfo& memoryInfo) noexcept
-    : BasePortData(serviceDescription, runtimeName, nodeName)
+    : BasePortData(serviceDescription, runtimeName, serverOptions.nodeName)
     , m_chunkSenderData(memoryManager, SERVER_SUBSCRIBER_POLICY, 0, memoryInfo)
     , m_chunkReceiverData(cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, SERVER_PUBLISHER_POLICY)
+    , m_offeringRequested(serverOptions.offerOnCreate)
 {
+    m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
 }
 
 } // namespace popo
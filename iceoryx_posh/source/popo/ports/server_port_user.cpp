@@ -39,15 +39,21 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
-
-cxx::expected<cxx::optional<const RequestHeader*>, ChunkReceiveResult> ServerPortUser::getRequest() noexcept
+cxx::expected<const RequestHeader*, ChunkReceiveResult> ServerPortUser::getRequest() noexcept
 {
-    return cxx::success<cxx::optional<const RequestHeader*>>(cxx::nullopt_t());
+    auto getChunkResult = m_chunkReceiver.tryGet();
+
+    if (getChunkResult.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(getChunkResult.get_error());
+    }
+
+    return cxx::success<const RequestHeader*>(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));
 }
 
-void ServerPortUser::releaseRequest(const RequestHeader* const /*requestHeader*/) noexcept
+void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    m_chunkReceiver.release(requestHeader->getChunkHeader());
 }
 
 bool ServerPortUser::hasNewRequests() const noexcept
@@ -61,20 +67,42 @@ bool ServerPortUser::hasLostRequestsSinceLastCall() noexcept
 }
 
 cxx::expected<ResponseHeader*, AllocationError>
-ServerPortUser::allocateResponse(const uint32_t /*userPayloadSize*/) noexcept
+ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
+                                 const uint32_t userPayloadSize,
+                                 const uint32_t userPayloadAlignment) noexcept
 {
-    /// @todo
-    return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    auto allocateResult = m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
+
+    if (allocateResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocateResult.get_error());
+    }
+
+    auto responseHeader = new (allocateResult.value()->userHeader())
+        ResponseHeader(requestHeader->getClientId(), requestHeader->getSequenceNumber());
+    return cxx::success<ResponseHeader*>(responseHeader);
 }
 
-void ServerPortUser::freeResponse(ResponseHeader* const /*responseHeader*/) noexcept
+void ServerPortUser::freeResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    m_chunkSender.release(responseHeader->getChunkHeader());
 }
 
-void ServerPortUser::sendResponse(ResponseHeader* const /*responseHeader*/) noexcept
+cxx::expected<ServerSendError> ServerPortUser::sendResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
+    {
+        m_chunkSender.release(responseHeader->getChunkHeader());
+        return cxx::error<ServerSendError>(ServerSendError::NOT_OFFERED);
+    }
+
+    // the response is only delivered to the response queue of the client which sent the request
+    if (!m_chunkSender.sendToQueue(responseHeader->getChunkHeader(), responseHeader->getClientId()))
+    {
+        return cxx::error<ServerSendError>(ServerSendError::CLIENT_NOT_AVAILABLE);
+    }
+    return cxx::success<void>();
 }
 
 void ServerPortUser::offer() noexcept
@@ -82,6 +110,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -90,6 +119,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -33,6 +33,8 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_decimationFactor = subscriberOptions.decimationFactor;
+    m_chunkReceiverData.m_minDeliveryIntervalInNanoseconds = subscriberOptions.minDeliveryInterval.toNanoseconds();
 }
 
 } // namespace popo
@@ -48,6 +48,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -56,6 +57,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -66,7 +68,46 @@ SubscribeState SubscriberPortUser::getSubscriptionState() const noexcept
 
 cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk() noexcept
 {
-    return m_chunkReceiver.tryGet();
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    if (!maybeChunkHeader.has_error())
+    {
+        recordQueueLatencies(&maybeChunkHeader.value(), 1U);
+    }
+    return maybeChunkHeader;
+}
+
+cxx::expected<uint32_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                 const uint32_t maxNumberOfChunks) noexcept
+{
+    auto maybeNumberOfChunks = m_chunkReceiver.tryGetBatch(chunkHeaders, maxNumberOfChunks);
+    if (!maybeNumberOfChunks.has_error())
+    {
+        recordQueueLatencies(chunkHeaders, maybeNumberOfChunks.value());
+    }
+    return maybeNumberOfChunks;
+}
+
+void SubscriberPortUser::recordQueueLatencies(const mepoo::ChunkHeader* const* const chunkHeaders,
+                                              const uint32_t numberOfChunks) noexcept
+{
+    // the clock is only read when a chunk was stamped, chunks of publishers without publishTimestamp cost nothing
+    uint64_t now{mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP};
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        const uint64_t publishTimestamp = chunkHeaders[i]->publishTimestamp();
+        if (publishTimestamp == mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP)
+        {
+            continue;
+        }
+        if (now == mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP)
+        {
+            now = static_cast<uint64_t>(
+                std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch())
+                    .count());
+        }
+        getMembers()->m_queueLatencyHistogram.record((now > publishTimestamp) ? now - publishTimestamp : 0U);
+    }
 }
 
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
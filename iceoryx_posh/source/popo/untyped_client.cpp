@@ -0,0 +1,200 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace popo
+{
+UntypedClient::UntypedClient(const capro::ServiceDescription& service, const ClientOptions& clientOptions) noexcept
+    : m_port(iox::runtime::PoshRuntime::getInstance().getMiddlewareClient(service, clientOptions))
+{
+}
+
+UntypedClient::~UntypedClient() noexcept
+{
+    m_trigger.reset();
+    m_port.destroy();
+}
+
+UniquePortId UntypedClient::getUid() const noexcept
+{
+    return m_port.getUniqueID();
+}
+
+capro::ServiceDescription UntypedClient::getServiceDescription() const noexcept
+{
+    return m_port.getCaProServiceDescription();
+}
+
+void UntypedClient::connect() noexcept
+{
+    m_port.connect();
+}
+
+void UntypedClient::disconnect() noexcept
+{
+    m_port.disconnect();
+}
+
+ConnectionState UntypedClient::getConnectionState() const noexcept
+{
+    return m_port.getConnectionState();
+}
+
+cxx::expected<void*, AllocationError> UntypedClient::loan(const uint32_t userPayloadSize,
+                                                          const uint32_t userPayloadAlignment) noexcept
+{
+    auto maybeRequestHeader = m_port.allocateRequest(userPayloadSize, userPayloadAlignment);
+    if (maybeRequestHeader.has_error())
+    {
+        return cxx::error<AllocationError>(maybeRequestHeader.get_error());
+    }
+    return cxx::success<void*>(maybeRequestHeader.value()->getUserPayload());
+}
+
+void UntypedClient::releaseRequest(void* const requestPayload) noexcept
+{
+    auto requestHeader = RequestHeader::fromUserPayload(requestPayload);
+    if (requestHeader != nullptr)
+    {
+        m_port.freeRequest(requestHeader);
+    }
+}
+
+cxx::expected<ClientSendError> UntypedClient::send(void* const requestPayload) noexcept
+{
+    auto requestHeader = RequestHeader::fromUserPayload(requestPayload);
+    if (requestHeader == nullptr)
+    {
+        LogError() << "Provided request payload is a nullptr, no request is sent.";
+        return cxx::error<ClientSendError>(ClientSendError::INVALID_STATE);
+    }
+    return m_port.sendRequest(requestHeader);
+}
+
+cxx::expected<const void*, ChunkReceiveResult> UntypedClient::take() noexcept
+{
+    auto maybeResponseHeader = m_port.getResponse();
+    if (maybeResponseHeader.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(maybeResponseHeader.get_error());
+    }
+    return cxx::success<const void*>(maybeResponseHeader.value()->getUserPayload());
+}
+
+void UntypedClient::release(const void* const responsePayload) noexcept
+{
+    auto responseHeader = ResponseHeader::fromUserPayload(responsePayload);
+    if (responseHeader != nullptr)
+    {
+        m_port.releaseResponse(responseHeader);
+    }
+}
+
+bool UntypedClient::hasResponses() const noexcept
+{
+    return m_port.hasNewResponses();
+}
+
+bool UntypedClient::hasMissedResponses() noexcept
+{
+    return m_port.hasLostResponsesSinceLastCall();
+}
+
+void UntypedClient::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_port.unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+void UntypedClient::enableState(TriggerHandle&& triggerHandle, const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        if (m_trigger)
+        {
+            LogWarn() << "The client is already attached with either the ClientState::HAS_RESPONSE or "
+                         "ClientEvent::RESPONSE_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ClientState::HAS_RESPONSE. Best practice is to call detach "
+                         "first.";
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+WaitSetIsConditionSatisfiedCallback
+UntypedClient::getCallbackForIsStateConditionSatisfied(const ClientState clientState) const noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        return {*this, &UntypedClient::hasResponses};
+    }
+    return {};
+}
+
+void UntypedClient::disableState(const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+void UntypedClient::enableEvent(TriggerHandle&& triggerHandle, const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        if (m_trigger)
+        {
+            LogWarn() << "The client is already attached with either the ClientState::HAS_RESPONSE or "
+                         "ClientEvent::RESPONSE_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ClientEvent::RESPONSE_RECEIVED. Best practice is to call "
+                         "detach first.";
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void UntypedClient::disableEvent(const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,213 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace popo
+{
+UntypedServer::UntypedServer(const capro::ServiceDescription& service, const ServerOptions& serverOptions) noexcept
+    : m_port(iox::runtime::PoshRuntime::getInstance().getMiddlewareServer(service, serverOptions))
+{
+}
+
+UntypedServer::~UntypedServer() noexcept
+{
+    m_trigger.reset();
+    m_port.destroy();
+}
+
+UniquePortId UntypedServer::getUid() const noexcept
+{
+    return m_port.getUniqueID();
+}
+
+capro::ServiceDescription UntypedServer::getServiceDescription() const noexcept
+{
+    return m_port.getCaProServiceDescription();
+}
+
+void UntypedServer::offer() noexcept
+{
+    m_port.offer();
+}
+
+void UntypedServer::stopOffer() noexcept
+{
+    m_port.stopOffer();
+}
+
+bool UntypedServer::isOffered() const noexcept
+{
+    return m_port.isOffered();
+}
+
+bool UntypedServer::hasClients() const noexcept
+{
+    return m_port.hasClients();
+}
+
+cxx::expected<const void*, ChunkReceiveResult> UntypedServer::take() noexcept
+{
+    auto maybeRequestHeader = m_port.getRequest();
+    if (maybeRequestHeader.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(maybeRequestHeader.get_error());
+    }
+    return cxx::success<const void*>(maybeRequestHeader.value()->getUserPayload());
+}
+
+void UntypedServer::release(const void* const requestPayload) noexcept
+{
+    auto requestHeader = RequestHeader::fromUserPayload(requestPayload);
+    if (requestHeader != nullptr)
+    {
+        m_port.releaseRequest(requestHeader);
+    }
+}
+
+cxx::expected<void*, AllocationError> UntypedServer::loan(const void* const requestPayload,
+                                                          const uint32_t userPayloadSize,
+                                                          const uint32_t userPayloadAlignment) noexcept
+{
+    auto requestHeader = RequestHeader::fromUserPayload(requestPayload);
+    if (requestHeader == nullptr)
+    {
+        LogError() << "Provided request payload is a nullptr, no response can be loaned.";
+        return cxx::error<AllocationError>(AllocationError::INVALID_STATE);
+    }
+
+    auto maybeResponseHeader = m_port.allocateResponse(requestHeader, userPayloadSize, userPayloadAlignment);
+    if (maybeResponseHeader.has_error())
+    {
+        return cxx::error<AllocationError>(maybeResponseHeader.get_error());
+    }
+    return cxx::success<void*>(maybeResponseHeader.value()->getUserPayload());
+}
+
+void UntypedServer::releaseResponse(void* const responsePayload) noexcept
+{
+    auto responseHeader = ResponseHeader::fromUserPayload(responsePayload);
+    if (responseHeader != nullptr)
+    {
+        m_port.freeResponse(responseHeader);
+    }
+}
+
+cxx::expected<ServerSendError> UntypedServer::send(void* const responsePayload) noexcept
+{
+    auto responseHeader = ResponseHeader::fromUserPayload(responsePayload);
+    if (responseHeader == nullptr)
+    {
+        LogError() << "Provided response payload is a nullptr, no response is sent.";
+        return cxx::error<ServerSendError>(ServerSendError::INVALID_STATE);
+    }
+    return m_port.sendResponse(responseHeader);
+}
+
+bool UntypedServer::hasRequests() const noexcept
+{
+    return m_port.hasNewRequests();
+}
+
+bool UntypedServer::hasMissedRequests() noexcept
+{
+    return m_port.hasLostRequestsSinceLastCall();
+}
+
+void UntypedServer::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_port.unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+void UntypedServer::enableState(TriggerHandle&& triggerHandle, const ServerState serverState) noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        if (m_trigger)
+        {
+            LogWarn() << "The server is already attached with either the ServerState::HAS_REQUEST or "
+                         "ServerEvent::REQUEST_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ServerState::HAS_REQUEST. Best practice is to call detach "
+                         "first.";
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+WaitSetIsConditionSatisfiedCallback
+UntypedServer::getCallbackForIsStateConditionSatisfied(const ServerState serverState) const noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        return {*this, &UntypedServer::hasRequests};
+    }
+    return {};
+}
+
+void UntypedServer::disableState(const ServerState serverState) noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+void UntypedServer::enableEvent(TriggerHandle&& triggerHandle, const ServerEvent serverEvent) noexcept
+{
+    switch (serverEvent)
+    {
+    case ServerEvent::REQUEST_RECEIVED:
+        if (m_trigger)
+        {
+            LogWarn() << "The server is already attached with either the ServerState::HAS_REQUEST or "
+                         "ServerEvent::REQUEST_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ServerEvent::REQUEST_RECEIVED. Best practice is to call "
+                         "detach first.";
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void UntypedServer::disableEvent(const ServerEvent serverEvent) noexcept
+{
+    switch (serverEvent)
+    {
+    case ServerEvent::REQUEST_RECEIVED:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -30,10 +30,12 @@ namespace roudi
 {
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OwnerShip ownership) noexcept
+                                               const posix::OwnerShip ownership,
+                                               const posix::MappingOptions& mappingOptions) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_ownership(ownership)
+    , m_mappingOptions(mappingOptions)
 {
 }
 
@@ -53,7 +55,13 @@ cxx::expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(c
         return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE);
     }
 
-    posix::SharedMemoryObject::create(m_shmName, size, m_accessMode, m_ownership, nullptr)
+    posix::SharedMemoryObject::create(m_shmName,
+                                      size,
+                                      m_accessMode,
+                                      m_ownership,
+                                      posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                      static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                      m_mappingOptions)
         .and_then([this](auto& sharedMemoryObject) {
             sharedMemoryObject.finalizeAllocation();
             m_shmObject.emplace(std::move(sharedMemoryObject));
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -69,6 +71,9 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         return cxx::error<RouDiMemoryManagerError>(RouDiMemoryManagerError::NO_MEMORY_PROVIDER_PRESENT);
     }
 
+    // the zero initialization of large segments dominates the startup of RouDi, the duration is reported to help
+    // with the choice of the zero initialization strategy
+    const auto start = std::chrono::steady_clock::now();
     for (auto memoryProvider : m_memoryProvider)
     {
         auto result = memoryProvider->create();
@@ -80,6 +85,10 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         }
     }
 
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LogInfo() << "Created the shared memory in " << duration.count() << " ms";
+
     for (auto memoryProvider : m_memoryProvider)
     {
         memoryProvider->announceMemoryAvailable();
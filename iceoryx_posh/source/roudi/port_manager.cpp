@@ -122,6 +122,10 @@ void PortManager::doDiscovery() noexcept
 
     handleSubscriberPorts();
 
+    handleServerPorts();
+
+    handleClientPorts();
+
     handleApplications();
 
     handleInterfaces();
@@ -131,6 +135,75 @@ void PortManager::doDiscovery() noexcept
     handleConditionVariables();
 }
 
+void PortManager::handleDiscoveryRequests() noexcept
+{
+    auto& discoveryRequestQueue = m_portPool->discoveryRequestQueue();
+    while (auto request = discoveryRequestQueue.m_requests.pop())
+    {
+        auto basePortData = request->get();
+
+        // a port could have been destroyed by the cyclic discovery while its request was pending, only ports which
+        // are still in the pool are handled
+        auto publisherPortData = m_portPool->getPublisherPortData(basePortData);
+        if (publisherPortData != nullptr)
+        {
+            // reset before the discovery to not miss a request which is done in the meantime; the exchange
+            // synchronizes with the request, hence the discovery sees the port state the request was done for
+            publisherPortData->m_isDiscoveryRequested.exchange(false, std::memory_order_acq_rel);
+            PublisherPortRouDiType publisherPort(publisherPortData);
+            doDiscoveryForPublisherPort(publisherPort);
+            if (publisherPort.toBeDestroyed())
+            {
+                destroyPublisherPort(publisherPortData);
+            }
+            continue;
+        }
+
+        auto subscriberPortData = m_portPool->getSubscriberPortData(basePortData);
+        if (subscriberPortData != nullptr)
+        {
+            subscriberPortData->m_isDiscoveryRequested.exchange(false, std::memory_order_acq_rel);
+            SubscriberPortType subscriberPort(subscriberPortData);
+            doDiscoveryForSubscriberPort(subscriberPort);
+            if (subscriberPort.toBeDestroyed())
+            {
+                destroySubscriberPort(subscriberPortData);
+            }
+            continue;
+        }
+
+        auto serverPortData = m_portPool->getServerPortData(basePortData);
+        if (serverPortData != nullptr)
+        {
+            serverPortData->m_isDiscoveryRequested.exchange(false, std::memory_order_acq_rel);
+            popo::ServerPortRouDi serverPort(serverPortData);
+            doDiscoveryForServerPort(serverPort);
+            if (serverPort.toBeDestroyed())
+            {
+                destroyServerPort(serverPortData);
+            }
+            continue;
+        }
+
+        auto clientPortData = m_portPool->getClientPortData(basePortData);
+        if (clientPortData != nullptr)
+        {
+            clientPortData->m_isDiscoveryRequested.exchange(false, std::memory_order_acq_rel);
+            popo::ClientPortRouDi clientPort(clientPortData);
+            doDiscoveryForClientPort(clientPort);
+            if (clientPort.toBeDestroyed())
+            {
+                destroyClientPort(clientPortData);
+            }
+        }
+    }
+}
+
+popo::ConditionVariableData& PortManager::discoveryRequestConditionVariable() noexcept
+{
+    return m_portPool->discoveryRequestQueue().m_conditionVariableData;
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
@@ -219,6 +292,81 @@ void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPor
     });
 }
 
+void PortManager::handleClientPorts() noexcept
+{
+    // get requests for change of connection state of clients
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(clientPortData);
+
+        doDiscoveryForClientPort(clientPort);
+
+        // check if we have to destroy this client port
+        if (clientPort.toBeDestroyed())
+        {
+            destroyClientPort(clientPortData);
+        }
+    }
+}
+
+void PortManager::doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept
+{
+    clientPort.tryGetCaProMessage().and_then([this, &clientPort](auto caproMessage) {
+        if ((capro::CaproMessageType::CONNECT == caproMessage.m_type)
+            || (capro::CaproMessageType::DISCONNECT == caproMessage.m_type))
+        {
+            if (!this->sendToMatchingServerPorts(caproMessage, clientPort))
+            {
+                LogDebug() << "capro::CONNECT/DISCONNECT, no matching server!!";
+                capro::CaproMessage nackMessage(capro::CaproMessageType::NACK,
+                                                clientPort.getCaProServiceDescription());
+                auto returnMessage = clientPort.dispatchCaProMessageAndGetPossibleResponse(nackMessage);
+                // No response on NACK messages
+                cxx::Ensures(!returnMessage.has_value());
+            }
+        }
+        else
+        {
+            // protocol error
+            errorHandler(
+                Error::kPORT_MANAGER__HANDLE_CLIENT_PORTS_INVALID_CAPRO_MESSAGE, nullptr, iox::ErrorLevel::MODERATE);
+        }
+    });
+}
+
+void PortManager::handleServerPorts() noexcept
+{
+    // get the changes of server port offer state
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+
+        doDiscoveryForServerPort(serverPort);
+
+        // check if we have to destroy this server port
+        if (serverPort.toBeDestroyed())
+        {
+            destroyServerPort(serverPortData);
+        }
+    }
+}
+
+void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept
+{
+    serverPort.tryGetCaProMessage().and_then([this, &serverPort](auto caproMessage) {
+        if ((capro::CaproMessageType::OFFER == caproMessage.m_type)
+            || (capro::CaproMessageType::STOP_OFFER == caproMessage.m_type))
+        {
+            this->sendToAllMatchingClientPorts(caproMessage, serverPort);
+        }
+        else
+        {
+            // protocol error
+            errorHandler(
+                Error::kPORT_MANAGER__HANDLE_SERVER_PORTS_INVALID_CAPRO_MESSAGE, nullptr, iox::ErrorLevel::MODERATE);
+        }
+    });
+}
 
 void PortManager::handleInterfaces() noexcept
 {
@@ -266,23 +414,17 @@ void PortManager::handleInterfaces() noexcept
             }
         }
         // also forward services from service registry
-        auto serviceMap = m_serviceRegistry.getServiceMap();
-
         caproMessage.m_subType = capro::CaproMessageSubType::SERVICE;
 
-        for (auto const& x : serviceMap)
-        {
-            for (auto& instance : x.second.instanceSet)
-            {
-                caproMessage.m_serviceDescription = capro::ServiceDescription(x.first, instance, capro::AnyEventString);
+        m_serviceRegistry.forEach([&](const capro::IdString_t& service, const capro::IdString_t& instance) {
+            caproMessage.m_serviceDescription = capro::ServiceDescription(service, instance, capro::AnyEventString);
 
-                for (auto& interfacePortData : interfacePortsForInitialForwarding)
-                {
-                    auto interfacePort = popo::InterfacePort(interfacePortData);
-                    interfacePort.dispatchCaProMessage(caproMessage);
-                }
+            for (auto& interfacePortData : interfacePortsForInitialForwarding)
+            {
+                auto interfacePort = popo::InterfacePort(interfacePortData);
+                interfacePort.dispatchCaProMessage(caproMessage);
             }
-        }
+        });
     }
 }
 
@@ -432,6 +574,106 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
     }
 }
 
+bool PortManager::sendToMatchingServerPorts(const capro::CaproMessage& message,
+                                            popo::ClientPortRouDi& clientSource) noexcept
+{
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+        if (clientSource.getCaProServiceDescription() == serverPort.getCaProServiceDescription())
+        {
+            auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
+            // a client is connected to one server at most, only the server which acknowledges the message is the
+            // one it is connected to; a NACK of one of the other servers is not forwarded
+            if (serverResponse.has_value() && (capro::CaproMessageType::ACK == serverResponse->m_type))
+            {
+                auto returnMessage = clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value());
+
+                // ACK is sent back to the client port, no further response from this one expected
+                cxx::Ensures(!returnMessage.has_value());
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void PortManager::connectToOfferingServerPort(popo::ClientPortRouDi& clientPort,
+                                              popo::ServerPortRouDi& stoppedServer) noexcept
+{
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+        if ((serverPort.getUniqueID() == stoppedServer.getUniqueID())
+            || (clientPort.getCaProServiceDescription() != serverPort.getCaProServiceDescription())
+            || !popo::ServerPortUser(serverPortData).isOffered())
+        {
+            continue;
+        }
+
+        // the offer is replayed to the client which reacts with a CONNECT like on a new offer
+        capro::CaproMessage offerMessage(capro::CaproMessageType::OFFER,
+                                         serverPort.getCaProServiceDescription(),
+                                         capro::CaproMessageSubType::SERVICE);
+        auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(offerMessage);
+        if (clientResponse.has_value())
+        {
+            auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
+            if (serverResponse.has_value())
+            {
+                auto returnMessage = clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value());
+
+                // ACK or NACK are sent back to the client port, no further response from this one expected
+                cxx::Ensures(!returnMessage.has_value());
+            }
+        }
+
+        if (ConnectionState::CONNECTED == clientPort.getConnectionState())
+        {
+            return;
+        }
+    }
+}
+
+void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
+                                               popo::ServerPortRouDi& serverSource) noexcept
+{
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(clientPortData);
+        if (clientPort.getCaProServiceDescription() == serverSource.getCaProServiceDescription())
+        {
+            const auto previousConnectionState = clientPort.getConnectionState();
+            auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
+
+            // a client which lost its server connects to another server which still offers the service
+            if ((capro::CaproMessageType::STOP_OFFER == message.m_type)
+                && (ConnectionState::CONNECTED == previousConnectionState)
+                && (ConnectionState::WAIT_FOR_OFFER == clientPort.getConnectionState()))
+            {
+                connectToOfferingServerPort(clientPort, serverSource);
+            }
+
+            // if the clients react on the change, process it immediately on server side
+            if (clientResponse.has_value())
+            {
+                // we only expect reaction on OFFER
+                cxx::Expects(capro::CaproMessageType::OFFER == message.m_type);
+
+                auto serverResponse = serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
+                if (serverResponse.has_value())
+                {
+                    // send response to client port
+                    auto returnMessage = clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value());
+
+                    // ACK or NACK are sent back to the client port, no further response from this one expected
+                    cxx::Ensures(!returnMessage.has_value());
+                }
+            }
+        }
+    }
+}
+
 void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept
 {
     for (auto interfacePortData : m_portPool->getInterfacePortDataList())
@@ -495,6 +737,24 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
         }
     }
 
+    for (auto port : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi client(port);
+        if (runtimeName == client.getRuntimeName())
+        {
+            destroyClientPort(port);
+        }
+    }
+
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi server(port);
+        if (runtimeName == server.getRuntimeName())
+        {
+            destroyServerPort(port);
+        }
+    }
+
     for (auto port : m_portPool->getInterfacePortDataList())
     {
         popo::InterfacePort interface(port);
@@ -586,6 +846,50 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     LogDebug() << "Destroyed subscriber port";
 }
 
+void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    // create temporary client ports to orderly shut this client down
+    popo::ClientPortRouDi clientPortRoudi(clientPortData);
+    popo::ClientPortUser clientPortUser(clientPortData);
+
+    clientPortRoudi.releaseAllChunks();
+    clientPortUser.disconnect();
+
+    // process DISCONNECT for this client in RouDi, the server must not deliver responses to the client anymore
+    clientPortRoudi.tryGetCaProMessage().and_then([this, &clientPortRoudi](auto caproMessage) {
+        cxx::Ensures(caproMessage.m_type == capro::CaproMessageType::DISCONNECT);
+
+        this->sendToMatchingServerPorts(caproMessage, clientPortRoudi);
+    });
+
+    // delete client port from list after DISCONNECT was processed
+    m_portPool->removeClientPort(clientPortData);
+
+    LogDebug() << "Destroyed client port";
+}
+
+void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    // create temporary server ports to orderly shut this server down
+    popo::ServerPortRouDi serverPortRoudi(serverPortData);
+    popo::ServerPortUser serverPortUser(serverPortData);
+
+    serverPortRoudi.releaseAllChunks();
+    serverPortUser.stopOffer();
+
+    // process STOP_OFFER for this server in RouDi, the clients must not deliver requests to the server anymore
+    serverPortRoudi.tryGetCaProMessage().and_then([this, &serverPortRoudi](auto caproMessage) {
+        cxx::Ensures(caproMessage.m_type == capro::CaproMessageType::STOP_OFFER);
+
+        this->sendToAllMatchingClientPorts(caproMessage, serverPortRoudi);
+    });
+
+    // delete server port from list after STOP_OFFER was processed
+    m_portPool->removeServerPort(serverPortData);
+
+    LogDebug() << "Destroyed server port";
+}
+
 runtime::IpcMessage PortManager::findService(const capro::ServiceDescription& service) noexcept
 {
     // send find to all interfaces
@@ -677,6 +981,43 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
     return maybeSubscriberPortData;
 }
 
+cxx::expected<popo::ClientPortData*, PortPoolError>
+PortManager::acquireClientPortData(const capro::ServiceDescription& service,
+                                   const popo::ClientOptions& clientOptions,
+                                   const RuntimeName_t& runtimeName,
+                                   mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeClientPortData = m_portPool->addClientPort(
+        service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo);
+    if (!maybeClientPortData.has_error())
+    {
+        // we do discovery here for trying to connect to a server if connect on create is desired
+        popo::ClientPortRouDi clientPort(maybeClientPortData.value());
+        doDiscoveryForClientPort(clientPort);
+    }
+
+    return maybeClientPortData;
+}
+
+cxx::expected<popo::ServerPortData*, PortPoolError>
+PortManager::acquireServerPortData(const capro::ServiceDescription& service,
+                                   const popo::ServerOptions& serverOptions,
+                                   const RuntimeName_t& runtimeName,
+                                   mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeServerPortData = m_portPool->addServerPort(
+        service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo);
+    if (!maybeServerPortData.has_error())
+    {
+        // we do discovery here for trying to connect the waiting clients if offer on create is desired
+        popo::ServerPortRouDi serverPort(maybeServerPortData.value());
+        doDiscoveryForServerPort(serverPort);
+    }
+
+    return maybeServerPortData;
+}
 
 /// @todo return a cxx::expected
 popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces interface,
@@ -711,7 +1052,10 @@ popo::ApplicationPortData* PortManager::acquireApplicationPortData(const Runtime
 void PortManager::addEntryToServiceRegistry(const capro::IdString_t& service,
                                             const capro::IdString_t& instance) noexcept
 {
-    m_serviceRegistry.add(service, instance);
+    m_serviceRegistry.add(service, instance).or_else([&](auto&) {
+        LogWarn() << "Could not add the service " << service << " with the instance " << instance
+                  << " to the service registry since its capacity is exhausted";
+    });
     m_portPool->serviceRegistryChangeCounter()->fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -135,6 +135,32 @@ std::atomic<uint64_t>* PortPool::serviceRegistryChangeCounter() noexcept
     return &m_portPoolData->m_serviceRegistryChangeCounter;
 }
 
+popo::DiscoveryRequestQueueData& PortPool::discoveryRequestQueue() noexcept
+{
+    return m_portPoolData->m_discoveryRequestQueue;
+}
+
+PublisherPortRouDiType::MemberType_t*
+PortPool::getPublisherPortData(const popo::BasePortData* const basePortData) noexcept
+{
+    return m_portPoolData->m_publisherPortMembers.get(basePortData);
+}
+
+SubscriberPortType::MemberType_t* PortPool::getSubscriberPortData(const popo::BasePortData* const basePortData) noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.get(basePortData);
+}
+
+popo::ClientPortData* PortPool::getClientPortData(const popo::BasePortData* const basePortData) noexcept
+{
+    return m_portPoolData->m_clientPortMembers.get(basePortData);
+}
+
+popo::ServerPortData* PortPool::getServerPortData(const popo::BasePortData* const basePortData) noexcept
+{
+    return m_portPoolData->m_serverPortMembers.get(basePortData);
+}
+
 cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
@@ -145,6 +171,16 @@ cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSub
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getClientPortDataList() noexcept
+{
+    return m_portPoolData->m_clientPortMembers.content();
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList() noexcept
+{
+    return m_portPoolData->m_serverPortMembers.content();
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            mepoo::MemoryManager* const memoryManager,
@@ -156,6 +192,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        publisherPortData->m_discoveryRequestQueue = &m_portPoolData->m_discoveryRequestQueue;
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -175,6 +212,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        subscriberPortData->m_discoveryRequestQueue = &m_portPoolData->m_discoveryRequestQueue;
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -185,6 +223,48 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     }
 }
 
+cxx::expected<popo::ClientPortData*, PortPoolError>
+PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
+                        mepoo::MemoryManager* const memoryManager,
+                        const RuntimeName_t& runtimeName,
+                        const popo::ClientOptions& clientOptions,
+                        const mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    if (m_portPoolData->m_clientPortMembers.hasFreeSpace())
+    {
+        auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
+            serviceDescription, runtimeName, memoryManager, clientOptions, memoryInfo);
+        clientPortData->m_discoveryRequestQueue = &m_portPoolData->m_discoveryRequestQueue;
+        return cxx::success<popo::ClientPortData*>(clientPortData);
+    }
+    else
+    {
+        errorHandler(Error::kPORT_POOL__CLIENTLIST_OVERFLOW, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::CLIENT_PORT_LIST_FULL);
+    }
+}
+
+cxx::expected<popo::ServerPortData*, PortPoolError>
+PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
+                        mepoo::MemoryManager* const memoryManager,
+                        const RuntimeName_t& runtimeName,
+                        const popo::ServerOptions& serverOptions,
+                        const mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    if (m_portPoolData->m_serverPortMembers.hasFreeSpace())
+    {
+        auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
+            serviceDescription, runtimeName, memoryManager, serverOptions, memoryInfo);
+        serverPortData->m_discoveryRequestQueue = &m_portPoolData->m_discoveryRequestQueue;
+        return cxx::success<popo::ServerPortData*>(serverPortData);
+    }
+    else
+    {
+        errorHandler(Error::kPORT_POOL__SERVERLIST_OVERFLOW, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::SERVER_PORT_LIST_FULL);
+    }
+}
+
 void PortPool::removePublisherPort(PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
     m_portPoolData->m_publisherPortMembers.erase(portData);
@@ -195,5 +275,15 @@ void PortPool::removeSubscriberPort(SubscriberPortType::MemberType_t* const port
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
+void PortPool::removeClientPort(popo::ClientPortData* const portData) noexcept
+{
+    m_portPoolData->m_clientPortMembers.erase(portData);
+}
+
+void PortPool::removeServerPort(popo::ServerPortData* const portData) noexcept
+{
+    m_portPoolData->m_serverPortMembers.erase(portData);
+}
+
 } // namespace roudi
 } // namespace iox
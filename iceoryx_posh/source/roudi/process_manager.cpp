@@ -470,32 +470,68 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
     searchForProcessAndThen(
         name,
         [&](Process& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (!maybeSubscriber.has_error())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeSubscriber.value());
+            runtime::IpcMessage sendBuffer;
+            acquireSubscriberPortForProcess(process, service, subscriberOptions, portConfigInfo)
+                .and_then([&](auto offset) {
+                    // send SubscriberPort to app as a serialized relative pointer
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                })
+                .or_else([&](auto error) {
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(error);
+                });
+            process.sendViaIpcChannel(sendBuffer);
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested a SubscriberPort."; });
+}
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process.sendViaIpcChannel(sendBuffer);
+void ProcessManager::addClientForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ClientOptions& clientOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    searchForProcessAndThen(
+        name,
+        [&](Process& process) {
+            runtime::IpcMessage sendBuffer;
+            acquireClientPortForProcess(process, service, clientOptions, portConfigInfo)
+                .and_then([&](auto offset) {
+                    // send ClientPort to app as a serialized relative pointer
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
+                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                })
+                .or_else([&](auto error) {
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(error);
+                });
+            process.sendViaIpcChannel(sendBuffer);
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested a ClientPort."; });
+}
 
-                LogDebug() << "Created new SubscriberPort for application " << name;
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process.sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create SubscriberPort for application " << name;
-            }
+void ProcessManager::addServerForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ServerOptions& serverOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    searchForProcessAndThen(
+        name,
+        [&](Process& process) {
+            runtime::IpcMessage sendBuffer;
+            acquireServerPortForProcess(process, service, serverOptions, portConfigInfo)
+                .and_then([&](auto offset) {
+                    // send ServerPort to app as a serialized relative pointer
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
+                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                })
+                .or_else([&](auto error) {
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(error);
+                });
+            process.sendViaIpcChannel(sendBuffer);
         },
-        [&]() { LogWarn() << "Unknown application " << name << " requested a SubscriberPort."; });
+        [&]() { LogWarn() << "Unknown application " << name << " requested a ServerPort."; });
 }
 
 void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
@@ -505,48 +541,190 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
 {
     searchForProcessAndThen(
         name,
-        [&](Process& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+        [&](Process& process) {
+            runtime::IpcMessage sendBuffer;
+            acquirePublisherPortForProcess(process, service, publisherOptions, portConfigInfo)
+                .and_then([&](auto offset) {
+                    // send PublisherPort to app as a serialized relative pointer
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                })
+                .or_else([&](auto error) {
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(error);
+                });
+            process.sendViaIpcChannel(sendBuffer);
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested a PublisherPort."; });
+}
 
-            if (!segmentInfo.m_memoryManager.has_value())
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name,
+                                        const std::vector<runtime::PortRequest>& portRequests) noexcept
+{
+    searchForProcessAndThen(
+        name,
+        [&](Process& process) {
+            // every request has its own element in the response with the same content as the response to a single
+            // CREATE_PUBLISHER or CREATE_SUBSCRIBER request, the order is the one of the requests
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK);
+            for (const auto& portRequest : portRequests)
             {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process.sendViaIpcChannel(sendBuffer);
-                return;
+                cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType> maybeOffset =
+                    cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::NOTYPE);
+                runtime::IpcMessageType ackType{runtime::IpcMessageType::NOTYPE};
+                switch (portRequest.m_portType)
+                {
+                case runtime::PortRequest::PortType::PUBLISHER:
+                    maybeOffset = acquirePublisherPortForProcess(process,
+                                                                 portRequest.m_service,
+                                                                 portRequest.m_publisherOptions,
+                                                                 portRequest.m_portConfigInfo);
+                    ackType = runtime::IpcMessageType::CREATE_PUBLISHER_ACK;
+                    break;
+                case runtime::PortRequest::PortType::SUBSCRIBER:
+                    maybeOffset = acquireSubscriberPortForProcess(process,
+                                                                  portRequest.m_service,
+                                                                  portRequest.m_subscriberOptions,
+                                                                  portRequest.m_portConfigInfo);
+                    ackType = runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK;
+                    break;
+                default:
+                    LogError() << "Application " << name << " requested a port with an invalid type";
+                    break;
+                }
+
+                maybeOffset
+                    .and_then([&](auto offset) {
+                        sendBuffer << cxx::Serialization::create(runtime::IpcMessageTypeToString(ackType),
+                                                                 cxx::convert::toString(offset),
+                                                                 cxx::convert::toString(m_mgmtSegmentId))
+                                          .toString();
+                    })
+                    .or_else([&](auto error) {
+                        sendBuffer << cxx::Serialization::create(
+                                          runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR),
+                                          runtime::IpcMessageErrorTypeToString(error))
+                                          .toString();
+                    });
             }
+            process.sendViaIpcChannel(sendBuffer);
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested ports."; });
+}
 
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquirePublisherPortForProcess(Process& process,
+                                               const capro::ServiceDescription& service,
+                                               const popo::PublisherOptions& publisherOptions,
+                                               const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(
+        process.getUser(), portConfigInfo.memoryInfo.numaNode);
 
-            if (!maybePublisher.has_error())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybePublisher.value());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process.sendViaIpcChannel(sendBuffer);
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
 
-                LogDebug() << "Created new PublisherPort for application " << name;
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString( // map error codes
-                    (maybePublisher.get_error() == PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS
-                         ? runtime::IpcMessageErrorType::NO_UNIQUE_CREATED
-                         : runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL));
-                process.sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create PublisherPort for application " << name;
-            }
-        },
-        [&]() { LogWarn() << "Unknown application " << name << " requested a PublisherPort."; });
+    if (maybePublisher.has_error())
+    {
+        LogError() << "Could not create PublisherPort for application " << process.getName();
+        // map error codes
+        return cxx::error<runtime::IpcMessageErrorType>(
+            (maybePublisher.get_error() == PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS
+                 ? runtime::IpcMessageErrorType::NO_UNIQUE_CREATED
+                 : runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL));
+    }
+
+    LogDebug() << "Created new PublisherPort for application " << process.getName();
+    return cxx::success<rp::BaseRelativePointer::offset_t>(
+        rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybePublisher.value()));
+}
+
+cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireSubscriberPortForProcess(Process& process,
+                                                const capro::ServiceDescription& service,
+                                                const popo::SubscriberOptions& subscriberOptions,
+                                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeSubscriber =
+        m_portManager.acquireSubscriberPortData(service, subscriberOptions, process.getName(), portConfigInfo);
+
+    if (maybeSubscriber.has_error())
+    {
+        LogError() << "Could not create SubscriberPort for application " << process.getName();
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    LogDebug() << "Created new SubscriberPort for application " << process.getName();
+    return cxx::success<rp::BaseRelativePointer::offset_t>(
+        rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeSubscriber.value()));
+}
+
+cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireClientPortForProcess(Process& process,
+                                            const capro::ServiceDescription& service,
+                                            const popo::ClientOptions& clientOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(
+        process.getUser(), portConfigInfo.memoryInfo.numaNode);
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeClient = m_portManager.acquireClientPortData(
+        service, clientOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeClient.has_error())
+    {
+        LogError() << "Could not create ClientPort for application " << process.getName();
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ClientPort for application " << process.getName();
+    return cxx::success<rp::BaseRelativePointer::offset_t>(
+        rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeClient.value()));
+}
+
+cxx::expected<rp::BaseRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireServerPortForProcess(Process& process,
+                                            const capro::ServiceDescription& service,
+                                            const popo::ServerOptions& serverOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(
+        process.getUser(), portConfigInfo.memoryInfo.numaNode);
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeServer = m_portManager.acquireServerPortData(
+        service, serverOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeServer.has_error())
+    {
+        LogError() << "Could not create ServerPort for application " << process.getName();
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ServerPort for application " << process.getName();
+    return cxx::success<rp::BaseRelativePointer::offset_t>(
+        rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeServer.value()));
 }
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
@@ -678,5 +856,10 @@ void ProcessManager::discoveryUpdate() noexcept
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::handleDiscoveryRequests() noexcept
+{
+    m_portManager.handleDiscoveryRequests();
+}
+
 } // namespace roudi
 } // namespace iox
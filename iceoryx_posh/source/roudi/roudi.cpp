@@ -17,10 +17,13 @@
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
+#include "iceoryx_posh/internal/runtime/port_request.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
@@ -149,13 +152,22 @@ void RouDi::cyclicUpdateHook()
 
 void RouDi::monitorAndDiscoveryUpdate()
 {
+    popo::ConditionListener discoveryRequestListener(m_portManager->discoveryRequestConditionVariable());
+
     while (m_runMonitoringAndDiscoveryThread)
     {
         m_prcMgr->run();
 
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        // the cyclic discovery of all ports is the safety net, in between only the ports which requested a discovery
+        // are handled as soon as they request it
+        cxx::DeadlineTimer nextCycle(DISCOVERY_INTERVAL);
+        while (m_runMonitoringAndDiscoveryThread && !nextCycle.hasExpired())
+        {
+            discoveryRequestListener.timedWait(nextCycle.remainingTime());
+            m_prcMgr->handleDiscoveryRequests();
+        }
     }
 }
 
@@ -224,7 +236,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_PUBLISHER:
     {
-        if (message.getNumberOfElements() != 8)
+        if (message.getNumberOfElements() != 11)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER\" from \"" << runtimeName
                        << "\"received!";
@@ -232,7 +244,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(7));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(10));
 
             popo::PublisherOptions options;
             uint64_t historyCapacity{};
@@ -263,6 +275,33 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.subscriberTooSlowPolicy = static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
 
+            uint64_t maxBlockingTimeInNanoseconds{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(7).c_str(), maxBlockingTimeInNanoseconds))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(7).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.maxBlockingTime = units::Duration::fromNanoseconds(maxBlockingTimeInNanoseconds);
+
+            uint32_t chunkCacheSize{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(8).c_str(), chunkCacheSize))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(8).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.chunkCacheSize = chunkCacheSize;
+
+            uint64_t publishTimestamp{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(9).c_str(), publishTimestamp))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(9).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.publishTimestamp = (0U == publishTimestamp) ? false : true;
+
             m_prcMgr->addPublisherForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
@@ -270,7 +309,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_SUBSCRIBER:
     {
-        if (message.getNumberOfElements() != 9)
+        if (message.getNumberOfElements() != 11)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SUBSCRIBER\" from \"" << runtimeName
                        << "\"received!";
@@ -278,7 +317,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(8));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(10));
 
 
             popo::SubscriberOptions options;
@@ -318,11 +357,123 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.queueFullPolicy = static_cast<popo::QueueFullPolicy>(queueFullPolicy);
 
+            uint64_t decimationFactor{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(8).c_str(), decimationFactor))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
+                           << message.getElementAtIndex(8).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.decimationFactor = decimationFactor;
+
+            uint64_t minDeliveryIntervalInNanoseconds{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(9).c_str(), minDeliveryIntervalInNanoseconds))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
+                           << message.getElementAtIndex(9).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.minDeliveryInterval = units::Duration::fromNanoseconds(minDeliveryIntervalInNanoseconds);
+
             m_prcMgr->addSubscriberForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        if (message.getNumberOfElements() != 7)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_CLIENT\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(6));
+
+            popo::ClientOptions options;
+            uint64_t responseQueueCapacity;
+            if (!cxx::convert::fromString(message.getElementAtIndex(3).c_str(), responseQueueCapacity))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_CLIENT\"! '"
+                           << message.getElementAtIndex(3).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.responseQueueCapacity = responseQueueCapacity;
+            options.nodeName = NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(4));
+
+            uint32_t connectOnCreate;
+            if (!cxx::convert::fromString(message.getElementAtIndex(5).c_str(), connectOnCreate))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_CLIENT\"! '"
+                           << message.getElementAtIndex(5).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.connectOnCreate = (0U == connectOnCreate ? false : true);
+
+            m_prcMgr->addClientForProcess(
+                runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        if (message.getNumberOfElements() != 7)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SERVER\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(6));
+
+            popo::ServerOptions options;
+            uint64_t requestQueueCapacity;
+            if (!cxx::convert::fromString(message.getElementAtIndex(3).c_str(), requestQueueCapacity))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SERVER\"! '"
+                           << message.getElementAtIndex(3).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.requestQueueCapacity = requestQueueCapacity;
+            options.nodeName = NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(4));
+
+            uint32_t offerOnCreate;
+            if (!cxx::convert::fromString(message.getElementAtIndex(5).c_str(), offerOnCreate))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SERVER\"! '"
+                           << message.getElementAtIndex(5).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.offerOnCreate = (0U == offerOnCreate ? false : true);
+
+            m_prcMgr->addServerForProcess(
+                runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        if (message.getNumberOfElements() < 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            std::vector<runtime::PortRequest> portRequests;
+            portRequests.reserve(message.getNumberOfElements() - 2U);
+            for (uint32_t i = 2U; i < message.getNumberOfElements(); ++i)
+            {
+                portRequests.emplace_back(cxx::Serialization(message.getElementAtIndex(i)));
+            }
+
+            m_prcMgr->addPortsForProcess(runtimeName, portRequests);
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
     {
         if (message.getNumberOfElements() != 2)
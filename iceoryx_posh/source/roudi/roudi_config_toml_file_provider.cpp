@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/file_reader/file_reader.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
 #include "iceoryx_hoofs/platform/getopt.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
@@ -142,10 +143,75 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
             }
             mempoolConfig.addMemPool({*chunkSize, *chunkCount});
         }
+
+        iox::posix::MappingOptions mappingOptions;
+        auto pageType = segment->get_as<std::string>("page-type").value_or("default");
+        if (pageType == "default")
+        {
+            mappingOptions.pageType = iox::posix::PageType::DEFAULT;
+        }
+        else if (pageType == "transparent-huge-pages")
+        {
+            mappingOptions.pageType = iox::posix::PageType::TRANSPARENT_HUGE_PAGES;
+        }
+        else if (pageType == "huge-pages-2MB")
+        {
+            mappingOptions.pageType = iox::posix::PageType::HUGE_PAGES_2MB;
+        }
+        else if (pageType == "huge-pages-1GB")
+        {
+            mappingOptions.pageType = iox::posix::PageType::HUGE_PAGES_1GB;
+        }
+        else
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_PAGE_TYPE);
+        }
+        if (iox::posix::hugePageSize(mappingOptions.pageType) != 0U && reader != writer)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_HUGE_PAGES_AND_SEPARATE_READER_GROUP);
+        }
+        mappingOptions.prefault = segment->get_as<bool>("prefault").value_or(false);
+        mappingOptions.lockInMemory = segment->get_as<bool>("lock-in-memory").value_or(false);
+
+        auto zeroInitialization = segment->get_as<std::string>("zero-initialization").value_or("memset");
+        if (zeroInitialization == "memset")
+        {
+            mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::MEMSET;
+        }
+        else if (zeroInitialization == "parallel-memset")
+        {
+            mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::PARALLEL_MEMSET;
+        }
+        else if (zeroInitialization == "skip")
+        {
+            mappingOptions.zeroInitialization = iox::posix::ZeroInitialization::SKIP;
+        }
+        else
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_ZERO_INITIALIZATION);
+        }
+
+        if (segment->contains("numa-node"))
+        {
+            // cpptoml throws when a negative value is requested as unsigned type, therefore the range is checked here
+            auto numaNode = segment->get_as<int64_t>("numa-node");
+            if (!numaNode || *numaNode < 0 || *numaNode >= iox::posix::MAX_NUMBER_OF_NUMA_NODES)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_NUMA_NODE);
+            }
+            mappingOptions.numaNode = static_cast<uint32_t>(*numaNode);
+        }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             mappingOptions});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
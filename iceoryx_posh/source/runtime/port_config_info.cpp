@@ -28,12 +28,12 @@ PortConfigInfo::PortConfigInfo(uint32_t portType, uint32_t deviceId, uint32_t me
 
 PortConfigInfo::PortConfigInfo(const cxx::Serialization& serialization)
 {
-    serialization.extract(portType, memoryInfo.deviceId, memoryInfo.memoryType);
+    serialization.extract(portType, memoryInfo.deviceId, memoryInfo.memoryType, memoryInfo.numaNode);
 }
 
 PortConfigInfo::operator cxx::Serialization() const noexcept
 {
-    return cxx::Serialization::create(portType, memoryInfo.deviceId, memoryInfo.memoryType);
+    return cxx::Serialization::create(portType, memoryInfo.deviceId, memoryInfo.memoryType, memoryInfo.numaNode);
 }
 } // namespace runtime
 } // namespace iox
@@ -0,0 +1,139 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/port_request.hpp"
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <string>
+
+namespace iox
+{
+namespace runtime
+{
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::PublisherOptions& publisherOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : m_portType(PortType::PUBLISHER)
+    , m_service(service)
+    , m_publisherOptions(publisherOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::SubscriberOptions& subscriberOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : m_portType(PortType::SUBSCRIBER)
+    , m_service(service)
+    , m_subscriberOptions(subscriberOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest::PortRequest(const cxx::Serialization& serialized) noexcept
+{
+    uint8_t portType{0U};
+    std::string service;
+    std::string portConfigInfo;
+    bool isValid{false};
+
+    if (serialized.getNth(0U, portType))
+    {
+        if (portType == cxx::enumTypeAsUnderlyingType(PortType::PUBLISHER))
+        {
+            uint8_t subscriberTooSlowPolicy{0U};
+            uint64_t maxBlockingTimeInNanoseconds{0U};
+            isValid = serialized.extract(portType,
+                                         service,
+                                         m_publisherOptions.historyCapacity,
+                                         m_publisherOptions.nodeName,
+                                         m_publisherOptions.offerOnCreate,
+                                         subscriberTooSlowPolicy,
+                                         maxBlockingTimeInNanoseconds,
+                                         m_publisherOptions.chunkCacheSize,
+                                         m_publisherOptions.publishTimestamp,
+                                         portConfigInfo);
+            m_publisherOptions.subscriberTooSlowPolicy =
+                static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
+            m_publisherOptions.maxBlockingTime = units::Duration::fromNanoseconds(maxBlockingTimeInNanoseconds);
+        }
+        else if (portType == cxx::enumTypeAsUnderlyingType(PortType::SUBSCRIBER))
+        {
+            uint8_t queueFullPolicy{0U};
+            uint64_t minDeliveryIntervalInNanoseconds{0U};
+            isValid = serialized.extract(portType,
+                                         service,
+                                         m_subscriberOptions.historyRequest,
+                                         m_subscriberOptions.queueCapacity,
+                                         m_subscriberOptions.nodeName,
+                                         m_subscriberOptions.subscribeOnCreate,
+                                         queueFullPolicy,
+                                         m_subscriberOptions.decimationFactor,
+                                         minDeliveryIntervalInNanoseconds,
+                                         portConfigInfo);
+            m_subscriberOptions.queueFullPolicy = static_cast<popo::QueueFullPolicy>(queueFullPolicy);
+            m_subscriberOptions.minDeliveryInterval =
+                units::Duration::fromNanoseconds(minDeliveryIntervalInNanoseconds);
+        }
+    }
+
+    if (!isValid)
+    {
+        LogError() << "unable to create PortRequest from serialized string " << serialized;
+        return;
+    }
+
+    m_portType = static_cast<PortType>(portType);
+    m_service = capro::ServiceDescription(cxx::Serialization(service));
+    m_portConfigInfo = PortConfigInfo(cxx::Serialization(portConfigInfo));
+}
+
+PortRequest::operator cxx::Serialization() const noexcept
+{
+    switch (m_portType)
+    {
+    case PortType::PUBLISHER:
+        return cxx::Serialization::create(
+            cxx::enumTypeAsUnderlyingType(m_portType),
+            static_cast<cxx::Serialization>(m_service),
+            m_publisherOptions.historyCapacity,
+            m_publisherOptions.nodeName,
+            m_publisherOptions.offerOnCreate,
+            static_cast<uint8_t>(cxx::enumTypeAsUnderlyingType(m_publisherOptions.subscriberTooSlowPolicy)),
+            m_publisherOptions.maxBlockingTime.toNanoseconds(),
+            m_publisherOptions.chunkCacheSize,
+            m_publisherOptions.publishTimestamp,
+            static_cast<cxx::Serialization>(m_portConfigInfo));
+    case PortType::SUBSCRIBER:
+        return cxx::Serialization::create(
+            cxx::enumTypeAsUnderlyingType(m_portType),
+            static_cast<cxx::Serialization>(m_service),
+            m_subscriberOptions.historyRequest,
+            m_subscriberOptions.queueCapacity,
+            m_subscriberOptions.nodeName,
+            m_subscriberOptions.subscribeOnCreate,
+            static_cast<uint8_t>(cxx::enumTypeAsUnderlyingType(m_subscriberOptions.queueFullPolicy)),
+            m_subscriberOptions.decimationFactor,
+            m_subscriberOptions.minDeliveryInterval.toNanoseconds(),
+            static_cast<cxx::Serialization>(m_portConfigInfo));
+    default:
+        return cxx::Serialization::create(cxx::enumTypeAsUnderlyingType(m_portType));
+    }
+}
+} // namespace runtime
+} // namespace iox
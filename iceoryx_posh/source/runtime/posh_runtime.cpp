@@ -174,9 +174,8 @@ const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noex
     }
 }
 
-PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                                                         const popo::PublisherOptions& publisherOptions,
-                                                                         const PortConfigInfo& portConfigInfo) noexcept
+popo::PublisherOptions
+PoshRuntime::adjustedPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -195,14 +194,45 @@ PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const c
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+PortConfigInfo PoshRuntime::adjustedPortConfigInfo(const PortConfigInfo& portConfigInfo) const noexcept
+{
+    auto config = portConfigInfo;
+    if (config.memoryInfo.numaNode == posix::ANY_NUMA_NODE)
+    {
+        config.memoryInfo.numaNode = m_numaNode;
+    }
+    return config;
+}
+
+void PoshRuntime::preparePublisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    preparePort(
+        PortRequest(service, adjustedPublisherOptions(publisherOptions), adjustedPortConfigInfo(portConfigInfo)));
+}
+
+PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                                                         const popo::PublisherOptions& publisherOptions,
+                                                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = adjustedPublisherOptions(publisherOptions);
+    auto config = adjustedPortConfigInfo(portConfigInfo);
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyCapacity)
                << options.nodeName << cxx::convert::toString(options.offerOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+               << cxx::convert::toString(options.maxBlockingTime.toNanoseconds())
+               << cxx::convert::toString(options.chunkCacheSize)
+               << cxx::convert::toString(options.publishTimestamp)
+               << static_cast<cxx::Serialization>(config).toString();
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+    auto maybePublisher = requestPublisherFromRoudi(sendBuffer, PortRequest(service, options, config));
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.get_error())
@@ -243,10 +273,11 @@ PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const c
 }
 
 cxx::expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntime::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntime::requestPublisherFromRoudi(const IpcMessage& sendBuffer, const PortRequest& portRequest) noexcept
 {
     IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    if ((takePreparedPort(portRequest, receiveBuffer) || sendRequestToRouDi(sendBuffer, receiveBuffer))
+        && (3U == receiveBuffer.getNumberOfElements()))
     {
         std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
 
@@ -280,10 +311,204 @@ PoshRuntime::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-SubscriberPortUserType::MemberType_t*
-PoshRuntime::getMiddlewareSubscriber(const capro::ServiceDescription& service,
-                                     const popo::SubscriberOptions& subscriberOptions,
-                                     const PortConfigInfo& portConfigInfo) noexcept
+popo::ClientPortData* PoshRuntime::getMiddlewareClient(const capro::ServiceDescription& service,
+                                                       const popo::ClientOptions& clientOptions,
+                                                       const PortConfigInfo& portConfigInfo) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = popo::ClientChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        LogWarn() << "Requested response queue capacity " << options.responseQueueCapacity
+                  << " exceeds the maximum possible one for this client"
+                  << ", limiting from " << clientOptions.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.responseQueueCapacity)
+    {
+        LogWarn() << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                  << " the capacity is set to 1";
+        options.responseQueueCapacity = 1U;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
+               << static_cast<cxx::Serialization>(service).toString()
+               << cxx::convert::toString(options.responseQueueCapacity) << options.nodeName
+               << cxx::convert::toString(options.connectOnCreate)
+               << static_cast<cxx::Serialization>(adjustedPortConfigInfo(portConfigInfo)).toString();
+
+    auto maybeClient = requestClientFromRoudi(sendBuffer);
+    if (maybeClient.has_error())
+    {
+        switch (maybeClient.get_error())
+        {
+        case IpcMessageErrorType::CLIENT_LIST_FULL:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created since we are out of memory for clients.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_CLIENT_LIST_FULL, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. Request client got wrong IPC channel response.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+                         nullptr,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                         "user. Try using another user or adapt RouDi's config.";
+            errorHandler(Error::kPOSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        default:
+            LogWarn() << "Undefined behavior occurred while creating service '"
+                      << service.operator cxx::Serialization().toString() << "'.";
+            errorHandler(
+                Error::kPOSH__RUNTIME_CLIENT_PORT_CREATION_UNDEFINED_BEHAVIOR, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        }
+        return nullptr;
+    }
+    return maybeClient.value();
+}
+
+cxx::expected<popo::ClientPortData*, IpcMessageErrorType>
+PoshRuntime::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    {
+        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+
+        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_CLIENT_ACK)
+        {
+            rp::BaseRelativePointer::id_t segmentId{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
+            rp::BaseRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
+            auto ptr = rp::BaseRelativePointer::getPtr(segmentId, offset);
+            return cxx::success<popo::ClientPortData*>(reinterpret_cast<popo::ClientPortData*>(ptr));
+        }
+    }
+    else if ((receiveBuffer.getNumberOfElements() == 2U)
+             && (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) == IpcMessageType::ERROR))
+    {
+        LogError() << "Request client received no valid client port from RouDi.";
+        return cxx::error<IpcMessageErrorType>(
+            stringToIpcMessageErrorType(receiveBuffer.getElementAtIndex(1U).c_str()));
+    }
+
+    LogError() << "Request client got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
+}
+
+popo::ServerPortData* PoshRuntime::getMiddlewareServer(const capro::ServiceDescription& service,
+                                                       const popo::ServerOptions& serverOptions,
+                                                       const PortConfigInfo& portConfigInfo) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = popo::ServerChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        LogWarn() << "Requested request queue capacity " << options.requestQueueCapacity
+                  << " exceeds the maximum possible one for this server"
+                  << ", limiting from " << serverOptions.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.requestQueueCapacity)
+    {
+        LogWarn() << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                  << " the capacity is set to 1";
+        options.requestQueueCapacity = 1U;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
+               << static_cast<cxx::Serialization>(service).toString()
+               << cxx::convert::toString(options.requestQueueCapacity) << options.nodeName
+               << cxx::convert::toString(options.offerOnCreate)
+               << static_cast<cxx::Serialization>(adjustedPortConfigInfo(portConfigInfo)).toString();
+
+    auto maybeServer = requestServerFromRoudi(sendBuffer);
+    if (maybeServer.has_error())
+    {
+        switch (maybeServer.get_error())
+        {
+        case IpcMessageErrorType::SERVER_LIST_FULL:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created since we are out of memory for servers.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_SERVER_LIST_FULL, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. Request server got wrong IPC channel response.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+                         nullptr,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                         "user. Try using another user or adapt RouDi's config.";
+            errorHandler(Error::kPOSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        default:
+            LogWarn() << "Undefined behavior occurred while creating service '"
+                      << service.operator cxx::Serialization().toString() << "'.";
+            errorHandler(
+                Error::kPOSH__RUNTIME_SERVER_PORT_CREATION_UNDEFINED_BEHAVIOR, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        }
+        return nullptr;
+    }
+    return maybeServer.value();
+}
+
+cxx::expected<popo::ServerPortData*, IpcMessageErrorType>
+PoshRuntime::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    {
+        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+
+        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SERVER_ACK)
+        {
+            rp::BaseRelativePointer::id_t segmentId{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
+            rp::BaseRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
+            auto ptr = rp::BaseRelativePointer::getPtr(segmentId, offset);
+            return cxx::success<popo::ServerPortData*>(reinterpret_cast<popo::ServerPortData*>(ptr));
+        }
+    }
+    else if ((receiveBuffer.getNumberOfElements() == 2U)
+             && (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) == IpcMessageType::ERROR))
+    {
+        LogError() << "Request server received no valid server port from RouDi.";
+        return cxx::error<IpcMessageErrorType>(
+            stringToIpcMessageErrorType(receiveBuffer.getElementAtIndex(1U).c_str()));
+    }
+
+    LogError() << "Request server got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+}
+
+popo::SubscriberOptions
+PoshRuntime::adjustedSubscriberOptions(const popo::SubscriberOptions& subscriberOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -302,20 +527,46 @@ PoshRuntime::getMiddlewareSubscriber(const capro::ServiceDescription& service,
         options.queueCapacity = 1U;
     }
 
+    if (0U == options.decimationFactor)
+    {
+        LogWarn() << "Requested decimation factor of 0 doesn't make sense, the factor is set to 1 to deliver every"
+                  << " sample";
+        options.decimationFactor = 1U;
+    }
+
     if (options.nodeName.empty())
     {
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+void PoshRuntime::prepareSubscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    preparePort(PortRequest(service, adjustedSubscriberOptions(subscriberOptions), portConfigInfo));
+}
+
+SubscriberPortUserType::MemberType_t*
+PoshRuntime::getMiddlewareSubscriber(const capro::ServiceDescription& service,
+                                     const popo::SubscriberOptions& subscriberOptions,
+                                     const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = adjustedSubscriberOptions(subscriberOptions);
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyRequest)
                << cxx::convert::toString(options.queueCapacity) << options.nodeName
                << cxx::convert::toString(options.subscribeOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.queueFullPolicy))
+               << cxx::convert::toString(options.decimationFactor)
+               << cxx::convert::toString(options.minDeliveryInterval.toNanoseconds())
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer, PortRequest(service, options, portConfigInfo));
 
     if (maybeSubscriber.has_error())
     {
@@ -346,10 +597,11 @@ PoshRuntime::getMiddlewareSubscriber(const capro::ServiceDescription& service,
 }
 
 cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntime::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntime::requestSubscriberFromRoudi(const IpcMessage& sendBuffer, const PortRequest& portRequest) noexcept
 {
     IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    if ((takePreparedPort(portRequest, receiveBuffer) || sendRequestToRouDi(sendBuffer, receiveBuffer))
+        && (3U == receiveBuffer.getNumberOfElements()))
     {
         std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
 
@@ -383,6 +635,126 @@ PoshRuntime::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
+void PoshRuntime::preparePort(const PortRequest& portRequest) noexcept
+{
+    if (!m_isCreatePortsSupported.load(std::memory_order_relaxed))
+    {
+        // the port is requested separately when it is acquired
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_preparedPortsMutex);
+    m_preparedPortRequests.emplace_back(static_cast<cxx::Serialization>(portRequest).toString());
+}
+
+bool PoshRuntime::takePreparedPort(const PortRequest& portRequest, IpcMessage& answer) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_preparedPortsMutex);
+    if (!m_preparedPortRequests.empty())
+    {
+        requestPreparedPortsFromRoudi();
+    }
+
+    // identical requests are handed out in the order in which they were prepared
+    const auto serializedPortRequest = static_cast<cxx::Serialization>(portRequest).toString();
+    auto preparedPort = m_preparedPorts.lower_bound(serializedPortRequest);
+    if (preparedPort == m_preparedPorts.end() || preparedPort->first != serializedPortRequest)
+    {
+        return false;
+    }
+
+    // the response to a prepared port has the same elements as the response to a single request
+    cxx::Serialization response(preparedPort->second);
+    m_preparedPorts.erase(preparedPort);
+    std::string element;
+    for (uint32_t i = 0U; response.getNth(i, element); ++i)
+    {
+        answer << element;
+    }
+
+    return true;
+}
+
+void PoshRuntime::requestPreparedPortsFromRoudi() noexcept
+{
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+    auto firstPortRequest = m_preparedPortRequests.cbegin();
+    for (auto portRequest = m_preparedPortRequests.cbegin(); portRequest != m_preparedPortRequests.cend();
+         ++portRequest)
+    {
+        // an older RouDi receives only messages of the legacy size and answers with MESSAGE_NOT_SUPPORTED only when
+        // it received the whole message, therefore the batches are limited to this size until RouDi acknowledged one
+        const uint32_t maxMessageSize = m_isCreatePortsAcknowledged.load(std::memory_order_relaxed)
+                                            ? ROUDI_MESSAGE_SIZE
+                                            : LEGACY_ROUDI_MESSAGE_SIZE;
+        // one character for the separator and one for the terminating null character
+        const bool exceedsMessageSize = sendBuffer.getMessage().size() + portRequest->size() + 2U > maxMessageSize;
+        if (exceedsMessageSize && portRequest != firstPortRequest)
+        {
+            sendCreatePortsRequestToRouDi(sendBuffer, firstPortRequest, portRequest);
+            sendBuffer.clearMessage();
+            sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+            firstPortRequest = portRequest;
+        }
+        sendBuffer << *portRequest;
+    }
+    sendCreatePortsRequestToRouDi(sendBuffer, firstPortRequest, m_preparedPortRequests.cend());
+
+    m_preparedPortRequests.clear();
+}
+
+void PoshRuntime::sendCreatePortsRequestToRouDi(const IpcMessage& sendBuffer,
+                                                std::vector<std::string>::const_iterator firstPortRequest,
+                                                std::vector<std::string>::const_iterator endOfPortRequests) noexcept
+{
+    if (!m_isCreatePortsSupported.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    IpcMessage receiveBuffer;
+    if (!sendRequestToRouDi(sendBuffer, receiveBuffer))
+    {
+        // without an answer there are no prepared ports, the acquisition of each of these ports requests it separately
+        LogWarn() << "Request of prepared ports could not be sent to RouDi, the prepared ports are requested "
+                     "separately";
+        return;
+    }
+
+    const auto numberOfPortRequests = static_cast<uint32_t>(std::distance(firstPortRequest, endOfPortRequests));
+    if ((numberOfPortRequests + 1U == receiveBuffer.getNumberOfElements())
+        && (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) == IpcMessageType::CREATE_PORTS_ACK))
+    {
+        uint32_t index{1U};
+        for (auto portRequest = firstPortRequest; portRequest != endOfPortRequests; ++portRequest)
+        {
+            m_preparedPorts.emplace(*portRequest, receiveBuffer.getElementAtIndex(index));
+            ++index;
+        }
+        m_isCreatePortsAcknowledged.store(true, std::memory_order_relaxed);
+    }
+    else if (receiveBuffer.getNumberOfElements() == 1U
+             && stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+                    == IpcMessageType::MESSAGE_NOT_SUPPORTED)
+    {
+        LogWarn() << "RouDi does not support the creation of multiple ports with one request, the prepared ports are "
+                     "requested separately";
+        m_isCreatePortsSupported.store(false, std::memory_order_relaxed);
+    }
+    else
+    {
+        // RouDi might have created the ports nevertheless, requesting them again would leak the created ones; the
+        // acquisition of each of these ports fails with the wrong response error instead
+        LogError() << "Request of prepared ports got wrong response from IPC channel :'" << receiveBuffer.getMessage()
+                   << "'";
+        for (auto portRequest = firstPortRequest; portRequest != endOfPortRequests; ++portRequest)
+        {
+            m_preparedPorts.emplace(*portRequest, std::string());
+        }
+    }
+}
+
 popo::InterfacePortData* PoshRuntime::getMiddlewareInterface(const capro::Interfaces interface,
                                                              const NodeName_t& nodeName) noexcept
 {
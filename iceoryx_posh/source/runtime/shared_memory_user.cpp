@@ -68,7 +68,9 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
                                           segment.m_size,
                                           accessMode,
                                           posix::OwnerShip::OPEN_EXISTING,
-                                          posix::SharedMemoryObject::NO_ADDRESS_HINT)
+                                          posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                          static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                          segment.m_mappingOptions)
             .and_then([this, &segment](auto& sharedMemoryObject) {
                 if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
                 {
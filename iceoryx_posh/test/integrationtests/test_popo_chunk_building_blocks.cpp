@@ -59,6 +59,7 @@ struct ChunkDistributorConfig
 struct ChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL / 3;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
 };
 
 using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
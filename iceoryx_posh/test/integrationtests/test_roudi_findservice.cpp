@@ -375,7 +375,7 @@ TEST_F(RoudiFindService_test, findServiceMaxInstances)
     for (size_t i = 0; i < noOfInstances; i++)
     {
         // Service & Instance string is kept short , to reduce the response size in find service request ,
-        // (message queue has a limit of 512)
+        // (the message size is limited by APP_MESSAGE_SIZE)
         std::string instance = "i" + iox::cxx::convert::toString(i);
         senderRuntime->offerService({"s", IdString_t(iox::cxx::TruncateToCapacity, instance)});
         instanceContainerExp.push_back(IdString_t(iox::cxx::TruncateToCapacity, instance));
@@ -56,13 +56,18 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD4(tryAllocateChainedChunk,
+                 iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
+                     const uint32_t, const uint32_t, const uint32_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD2(sendChunks, void(iox::mepoo::ChunkHeader* const* const, const uint32_t));
     MOCK_METHOD0(tryGetPreviousChunk, iox::cxx::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
     MOCK_CONST_METHOD0(isOffered, bool());
     MOCK_CONST_METHOD0(hasSubscribers, bool());
+    MOCK_CONST_METHOD0(getAccumulatedBlockingTime, iox::units::Duration());
 
     operator bool() const
     {
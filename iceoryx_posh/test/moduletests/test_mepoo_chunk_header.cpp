@@ -45,12 +45,14 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(sut.chunkSize(), Eq(CHUNK_SIZE));
 
     // deliberately used a magic number to make the test fail when CHUNK_HEADER_VERSION changes
-    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(1U));
+    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(3U));
 
     EXPECT_THAT(sut.originId(), Eq(iox::UniquePortId(iox::popo::InvalidId)));
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_THAT(sut.publishTimestamp(), Eq(ChunkHeader::NO_PUBLISH_TIMESTAMP));
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -205,6 +207,33 @@ TEST(ChunkHeader_test, FromUserPayloadFunctionCalledWithConstParamReturnsConstTy
     EXPECT_TRUE(isConstReturn);
 }
 
+TEST(ChunkHeader_test, FromUserHeaderFunctionCalledWithNullptrReturnsNullptr)
+{
+    constexpr void* USER_HEADER{nullptr};
+    auto chunkHeader = ChunkHeader::fromUserHeader(USER_HEADER);
+    EXPECT_THAT(chunkHeader, Eq(nullptr));
+}
+
+TEST(ChunkHeader_test, FromUserHeaderFunctionReturnsChunkHeaderOfUserHeader)
+{
+    alignas(ChunkHeader) static uint8_t storage[1024 * 1024];
+    constexpr uint32_t CHUNK_SIZE{753U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U};
+    constexpr uint32_t USER_HEADER_SIZE{16U};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{8U};
+
+    auto chunkSettingsResult = ChunkSettings::create(
+        USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    iox::cxx::unique_ptr<ChunkHeader> sut{new (storage) ChunkHeader(CHUNK_SIZE, chunkSettings),
+                                          [](ChunkHeader*) {}};
+
+    EXPECT_THAT(ChunkHeader::fromUserHeader(sut->userHeader()), Eq(sut.get()));
+    EXPECT_THAT(ChunkHeader::fromUserHeader(static_cast<const void*>(sut->userHeader())), Eq(sut.get()));
+}
+
 TEST(ChunkHeader_test, UsedChunkSizeIsSizeOfChunkHeaderWhenUserPayloadIsZero)
 {
     constexpr uint32_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
@@ -233,6 +262,66 @@ TEST(ChunkHeader_test, UsedChunkSizeIsSizeOfChunkHeaderPlusOneWhenUserPayloadIsO
     EXPECT_THAT(sut.usedSizeOfChunk(), Eq(sizeof(ChunkHeader) + USER_PAYLOAD_SIZE));
 }
 
+TEST(ChunkHeader_test, ChunkHeaderIsNotChainedByDefault)
+{
+    constexpr uint32_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U};
+
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    ChunkHeader sut{CHUNK_SIZE, chunkSettings};
+    const ChunkHeader& constSut = sut;
+
+    EXPECT_THAT(sut.nextChainedChunk(), Eq(nullptr));
+    EXPECT_THAT(constSut.nextChainedChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.chainedUserPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+}
+
+TEST(ChunkHeader_test, UserPayloadPartsOfNotChainedChunkIsTheUserPayload)
+{
+    constexpr uint32_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U};
+
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    ChunkHeader sut{CHUNK_SIZE, chunkSettings};
+    const ChunkHeader& constSut = sut;
+
+    UserPayloadPart parts[2];
+    ASSERT_THAT(sut.userPayloadParts(parts, 2U), Eq(1U));
+    EXPECT_THAT(parts[0].data, Eq(sut.userPayload()));
+    EXPECT_THAT(parts[0].size, Eq(USER_PAYLOAD_SIZE));
+
+    ConstUserPayloadPart constParts[2];
+    ASSERT_THAT(constSut.userPayloadParts(constParts, 2U), Eq(1U));
+    EXPECT_THAT(constParts[0].data, Eq(constSut.userPayload()));
+    EXPECT_THAT(constParts[0].size, Eq(USER_PAYLOAD_SIZE));
+}
+
+TEST(ChunkHeader_test, CopyToChainedUserPayloadOfNotChainedChunkIsLimitedToTheUserPayloadSize)
+{
+    constexpr uint32_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
+    constexpr uint32_t USER_PAYLOAD_SIZE{4U};
+
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    alignas(ChunkHeader) uint8_t storage[CHUNK_SIZE];
+    auto sut = new (storage) ChunkHeader(CHUNK_SIZE, chunkSettings);
+
+    const uint8_t source[]{1U, 2U, 3U, 4U, 5U, 6U};
+    EXPECT_THAT(sut->copyToChainedUserPayload(source, sizeof(source)), Eq(USER_PAYLOAD_SIZE));
+
+    uint8_t destination[]{0U, 0U, 0U, 0U, 0U, 0U};
+    EXPECT_THAT(sut->copyFromChainedUserPayload(destination, sizeof(destination)), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(destination, ElementsAre(1U, 2U, 3U, 4U, 0U, 0U));
+}
+
 TEST(ChunkHeader_test, ConstructorTerminatesWhenUserPayloadSizeExceedsChunkSize)
 {
     constexpr uint32_t CHUNK_SIZE{128U};
@@ -323,6 +323,180 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromBestFittingMemPool)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({64, 10});
+    mempoolconf.addMemPool({128, 10});
+    mempoolconf.addMemPool({256, 10});
+    mempoolconf.addMemPool({512, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t userPayloadSize : {0U, 32U, 33U, 64U, 65U, 128U, 129U, 256U, 257U, 512U})
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        chunkStore.push_back(sut->getChunk(chunkSettingsResult.value()));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(4).m_usedChunks, Eq(2U));
+}
+
+TEST_F(MemoryManager_test, emptyMemPoolResultsInAcquiringChunksFromNextLargerMemPoolWhenFallbackIsEnabled)
+{
+    constexpr uint32_t ChunkCount{100};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.addMemPool({128, ChunkCount});
+    mempoolconf.addMemPool({256, ChunkCount});
+    mempoolconf.m_fallbackToLargerMemPool = true;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+    }
+    chunkStore.push_back(sut->getChunk(chunkSettings_64));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(2).m_chunkSize));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_numFallbackChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_numFallbackChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkFailsWhenAllFallbackMemPoolsAreExhausted)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.m_fallbackToLargerMemPool = true;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < 2 * ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32), Eq(false));
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_numFallbackChunks, Eq(ChunkCount));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheAcquiresChunksInBatch)
+{
+    constexpr uint32_t ChunkCount{100};
+    constexpr uint32_t CacheSize{8};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{CacheSize};
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    chunkStore.push_back(sut->getChunk(chunkSettings_64, chunkCache));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(1).m_chunkSize));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CacheSize));
+    EXPECT_THAT(chunkCache.m_size, Eq(CacheSize - 1U));
+
+    for (uint32_t i = 1U; i < CacheSize; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CacheSize));
+    EXPECT_THAT(chunkCache.m_size, Eq(0U));
+
+    chunkStore.clear();
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, releaseChunkCacheReturnsCachedChunks)
+{
+    constexpr uint32_t CacheSize{8};
+
+    mempoolconf.addMemPool({32, 100});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{CacheSize};
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+        EXPECT_THAT(chunk, Eq(true));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CacheSize - 1U));
+
+    sut->releaseChunkCache(chunkCache);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(chunkCache.m_size, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheFromOtherMemPoolReturnsPreviouslyCachedChunks)
+{
+    constexpr uint32_t CacheSize{8};
+
+    mempoolconf.addMemPool({32, 100});
+    mempoolconf.addMemPool({64, 100});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{CacheSize};
+    auto chunk32 = sut->getChunk(chunkSettings_32, chunkCache);
+    auto chunk64 = sut->getChunk(chunkSettings_64, chunkCache);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CacheSize));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheFromExhaustedMemPoolFails)
+{
+    constexpr uint32_t ChunkCount{10};
+    constexpr uint32_t CacheSize{4};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{CacheSize};
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < ChunkCount; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32, chunkCache), Eq(false));
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     constexpr uint32_t ChunkCount{100};
@@ -390,6 +564,197 @@ TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
     EXPECT_THAT(sut->getChunk(chunkSettings), Eq(true));
 }
 
+TEST_F(MemoryManager_test, getChainedChunkWhichFitsIntoMemPoolIsNotChained)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto sharedChunk = sut->getChainedChunk(chunkSettings_128);
+    ASSERT_THAT(sharedChunk, Eq(true));
+
+    EXPECT_THAT(sharedChunk.getChunkHeader()->nextChainedChunk(), Eq(nullptr));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkSplitsUserPayloadStartingWithTheLargestMemPool)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{2U * 128U + 20U};
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    {
+        auto sharedChunk = sut->getChainedChunk(chunkSettingsResult.value());
+        ASSERT_THAT(sharedChunk, Eq(true));
+
+        auto chunkHeader = sharedChunk.getChunkHeader();
+        EXPECT_THAT(chunkHeader->chainedUserPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+
+        iox::mepoo::UserPayloadPart parts[4];
+        ASSERT_THAT(chunkHeader->userPayloadParts(parts, 4U), Eq(3U));
+        EXPECT_THAT(parts[0].data, Eq(chunkHeader->userPayload()));
+        EXPECT_THAT(parts[0].size, Eq(128U));
+        EXPECT_THAT(parts[1].size, Eq(128U));
+        EXPECT_THAT(parts[2].size, Eq(20U));
+
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(2U));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkFallsBackToSmallerMemPoolWhenLargestMemPoolIsExhausted)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 1});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{200U};
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    auto sharedChunk = sut->getChainedChunk(chunkSettingsResult.value());
+    ASSERT_THAT(sharedChunk, Eq(true));
+
+    EXPECT_THAT(sharedChunk.getChunkHeader()->chainedUserPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(3U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkWithUserHeaderHasUserHeaderOnlyInFirstChunk)
+{
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{300U};
+    constexpr uint32_t USER_HEADER_SIZE{8U};
+    auto chunkSettingsResult = ChunkSettings::create(
+        USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, alignof(uint64_t));
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    auto sharedChunk = sut->getChainedChunk(chunkSettingsResult.value());
+    ASSERT_THAT(sharedChunk, Eq(true));
+
+    auto chunkHeader = sharedChunk.getChunkHeader();
+    EXPECT_THAT(chunkHeader->userHeaderSize(), Eq(USER_HEADER_SIZE));
+    EXPECT_THAT(chunkHeader->chainedUserPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    for (auto chainedChunk = chunkHeader->nextChainedChunk(); chainedChunk != nullptr;
+         chainedChunk = chainedChunk->nextChainedChunk())
+    {
+        EXPECT_THAT(chainedChunk->userHeaderSize(), Eq(0U));
+        EXPECT_THAT(chainedChunk->usedSizeOfChunk(), Le(chainedChunk->chunkSize()));
+    }
+    EXPECT_THAT(chunkHeader->usedSizeOfChunk(), Le(chunkHeader->chunkSize()));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkPreservesDataWhichIsCopiedIntoTheChain)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<uint8_t> source(333U);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>(i);
+    }
+
+    auto chunkSettingsResult = ChunkSettings::create(static_cast<uint32_t>(source.size()), 1U);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    auto sharedChunk = sut->getChainedChunk(chunkSettingsResult.value());
+    ASSERT_THAT(sharedChunk, Eq(true));
+
+    auto chunkHeader = sharedChunk.getChunkHeader();
+    EXPECT_THAT(chunkHeader->copyToChainedUserPayload(source.data(), source.size()), Eq(source.size()));
+
+    std::vector<uint8_t> destination(source.size() + 10U, 0U);
+    EXPECT_THAT(chunkHeader->copyFromChainedUserPayload(destination.data(), destination.size()), Eq(source.size()));
+    destination.resize(source.size());
+    EXPECT_THAT(destination, Eq(source));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkFailsAndReleasesThePartialChainWhenMemPoolsAreExhausted)
+{
+    mempoolconf.addMemPool({32, 2});
+    mempoolconf.addMemPool({128, 1});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{300U};
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    EXPECT_THAT(sut->getChainedChunk(chunkSettingsResult.value()), Eq(false));
+
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkWhichCannotBeCompletedLeavesTheSmallerMemPoolsAvailable)
+{
+    constexpr uint32_t SMALL_CHUNK_COUNT{4U};
+    mempoolconf.addMemPool({32, SMALL_CHUNK_COUNT});
+    mempoolconf.addMemPool({128, 1});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    // the error is reported while the chain is acquired, the used chunks at this point show whether the smaller
+    // mempools were drained by the chain
+    iox::cxx::optional<uint32_t> usedSmallChunksWhenChainFailed;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            usedSmallChunksWhenChainFailed.emplace(sut->getMemPoolInfo(0).m_usedChunks);
+        });
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{128U + (SMALL_CHUNK_COUNT + 1U) * 32U};
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    EXPECT_THAT(sut->getChainedChunk(chunkSettingsResult.value()), Eq(false));
+
+    ASSERT_THAT(usedSmallChunksWhenChainFailed.has_value(), Eq(true));
+    EXPECT_THAT(usedSmallChunksWhenChainFailed.value(), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChainedChunkFailsWhenTheChainExceedsTheMaximumNumberOfChainedChunks)
+{
+    mempoolconf.addMemPool({32, 2U * iox::mepoo::MemoryManager::MAX_NUMBER_OF_CHAINED_CHUNKS});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{(iox::mepoo::MemoryManager::MAX_NUMBER_OF_CHAINED_CHUNKS + 1U) * 32U};
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    EXPECT_THAT(sut->getChainedChunk(chunkSettingsResult.value()), Eq(false));
+
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
 {
     mempoolconf.addMemPool({32, 0});
@@ -210,6 +210,50 @@ TEST_F(MemPool_test, getMinFreeWithSecondGetChunk)
     }
 }
 
+TEST_F(MemPool_test, getChunkIndicesAcquiresMultipleChunks)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS_TO_ACQUIRE{8U};
+    FreeListIndex_t chunkIndices[NUMBER_OF_CHUNKS_TO_ACQUIRE];
+
+    EXPECT_THAT(sut.getChunkIndices(chunkIndices, NUMBER_OF_CHUNKS_TO_ACQUIRE), Eq(NUMBER_OF_CHUNKS_TO_ACQUIRE));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS_TO_ACQUIRE));
+    EXPECT_THAT(sut.getMinFree(), Eq(NumberOfChunks - NUMBER_OF_CHUNKS_TO_ACQUIRE));
+
+    for (auto chunkIndex : chunkIndices)
+    {
+        auto chunk = reinterpret_cast<uint8_t*>(sut.getChunkFromIndex(chunkIndex));
+        EXPECT_THAT(chunk, Eq(m_rawMemory + chunkIndex * ChunkSize));
+    }
+}
+
+TEST_F(MemPool_test, getChunkIndicesWhenAlmostFullAcquiresRemainingChunks)
+{
+    for (uint32_t i = 0; i < NumberOfChunks - 2U; ++i)
+    {
+        sut.getChunk();
+    }
+
+    FreeListIndex_t chunkIndices[4U];
+    EXPECT_THAT(sut.getChunkIndices(chunkIndices, 4U), Eq(2U));
+    EXPECT_THAT(sut.getChunkIndices(chunkIndices, 4U), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NumberOfChunks));
+}
+
+TEST_F(MemPool_test, freeChunkIndicesReleasesChunks)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS_TO_ACQUIRE{8U};
+    FreeListIndex_t chunkIndices[NUMBER_OF_CHUNKS_TO_ACQUIRE];
+    ASSERT_THAT(sut.getChunkIndices(chunkIndices, NUMBER_OF_CHUNKS_TO_ACQUIRE), Eq(NUMBER_OF_CHUNKS_TO_ACQUIRE));
+
+    sut.freeChunkIndices(chunkIndices, NUMBER_OF_CHUNKS_TO_ACQUIRE);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    for (uint32_t i = 0; i < NumberOfChunks; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, allocator, allocator); }, ".*");
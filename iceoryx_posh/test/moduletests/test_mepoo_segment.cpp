@@ -67,7 +67,8 @@ class MePooSegment_test : public Test
                                 const AccessMode accessMode,
                                 const OwnerShip ownerShip,
                                 const void* baseAddressHint,
-                                const mode_t permissions)
+                                const mode_t permissions,
+                                const iox::posix::MappingOptions& = iox::posix::MappingOptions())
             : m_memorySizeInBytes(memorySizeInBytes)
             , m_baseAddressHint(const_cast<void*>(baseAddressHint))
         {
@@ -209,4 +210,60 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetMemoryManager))
     EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(ExplicitHugePagesWithSeparateReaderGroupCausesError))
+{
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.pageType = iox::posix::PageType::HUGE_PAGES_2MB;
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              m_managementAllocator,
+                                                              {"iox_roudi_test1"},
+                                                              {"iox_roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              mappingOptions};
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(ExplicitHugePagesSegmentIsAssignedToTheWriterGroup))
+{
+    iox::posix::MappingOptions mappingOptions;
+    mappingOptions.pageType = iox::posix::PageType::HUGE_PAGES_2MB;
+    const auto group = iox::posix::PosixGroup::getGroupOfCurrentProcess();
+
+    // the test requires a mounted hugetlbfs with reserved huge pages and is skipped otherwise
+    if (SharedMemoryObject::create(MePooSegment<>::getSharedMemoryName(group, mappingOptions),
+                                   MemoryManager::requiredChunkMemorySize(mepooConfig),
+                                   AccessMode::READ_WRITE,
+                                   OwnerShip::MINE,
+                                   SharedMemoryObject::NO_ADDRESS_HINT,
+                                   static_cast<mode_t>(S_IRUSR | S_IWUSR),
+                                   mappingOptions)
+            .has_error())
+    {
+        return;
+    }
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    MePooSegment<> sut2{mepooConfig, m_managementAllocator, group, group, iox::mepoo::MemoryInfo(), mappingOptions};
+
+    EXPECT_FALSE(detectedError.has_value());
+    struct stat fileStatus;
+    ASSERT_THAT(fstat(sut2.getSharedMemoryObject().getFileHandle(), &fileStatus), Eq(0));
+    EXPECT_THAT(fileStatus.st_gid, Eq(group.getID()));
+    EXPECT_THAT(fileStatus.st_mode & static_cast<mode_t>(S_IRWXU | S_IRWXG | S_IRWXO),
+                Eq(static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP)));
+}
+
 } // namespace
@@ -40,7 +40,8 @@ class MePooSegmentMock
                      Allocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const MappingOptions& mappingOptions IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
@@ -98,6 +99,23 @@ class SegmentManager_test : public Test
         return config;
     }
 
+    SegmentConfig getSegmentConfigWithNumaNodes()
+    {
+        MappingOptions mappingOptionsNode0;
+        mappingOptionsNode0.numaNode = 0U;
+        MappingOptions mappingOptionsNode1;
+        mappingOptionsNode1.numaNode = 1U;
+        MePooConfig mepooConfigNode1 = getMempoolConfig();
+        mepooConfigNode1.addMemPool({512, 3});
+
+        SegmentConfig config;
+        config.m_sharedMemorySegments.push_back(
+            {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), mappingOptionsNode0});
+        config.m_sharedMemorySegments.push_back(
+            {"iox_roudi_test1", "iox_roudi_test2", mepooConfigNode1, MemoryInfo(), mappingOptionsNode1});
+        return config;
+    }
+
     SegmentConfig getSegmentConfigWithMaximumNumberOfSegements()
     {
         SegmentConfig config;
@@ -174,6 +192,46 @@ TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getMemoryManagerForUse
     EXPECT_FALSE(sut.getSegmentInformationWithWriteAccessForUser({"no_user"}).m_memoryManager.has_value());
 }
 
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getSegmentMappingsForWriteUserWithSegmentPerNumaNode))
+{
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodes();
+    SegmentManager<> sut{segmentConfig, &allocator};
+
+    auto mapping = sut.getSegmentMappings({"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2u));
+    EXPECT_TRUE(mapping[0].m_isWritable);
+    EXPECT_TRUE(mapping[1].m_isWritable);
+    EXPECT_THAT(mapping[0].m_sharedMemoryName, Ne(mapping[1].m_sharedMemoryName));
+    EXPECT_THAT(mapping[0].m_mappingOptions.numaNode, Eq(0U));
+    EXPECT_THAT(mapping[1].m_mappingOptions.numaNode, Eq(1U));
+}
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getMemoryManagerForUserPrefersSegmentOnRequestedNumaNode))
+{
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodes();
+    SegmentManager<> sut{segmentConfig, &allocator};
+
+    auto memoryManagerNode0 = sut.getSegmentInformationWithWriteAccessForUser({"iox_roudi_test2"}, 0U).m_memoryManager;
+    auto memoryManagerNode1 = sut.getSegmentInformationWithWriteAccessForUser({"iox_roudi_test2"}, 1U).m_memoryManager;
+    ASSERT_TRUE(memoryManagerNode0.has_value());
+    ASSERT_TRUE(memoryManagerNode1.has_value());
+    EXPECT_THAT(memoryManagerNode0.value().get().getNumberOfMemPools(), Eq(2u));
+    EXPECT_THAT(memoryManagerNode1.value().get().getNumberOfMemPools(), Eq(3u));
+}
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getMemoryManagerForUserFallsBackForOtherNumaNode))
+{
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodes();
+    SegmentManager<> sut{segmentConfig, &allocator};
+
+    auto memoryManagerAnyNode = sut.getSegmentInformationWithWriteAccessForUser({"iox_roudi_test2"}).m_memoryManager;
+    auto memoryManagerNode2 = sut.getSegmentInformationWithWriteAccessForUser({"iox_roudi_test2"}, 2U).m_memoryManager;
+    ASSERT_TRUE(memoryManagerAnyNode.has_value());
+    ASSERT_TRUE(memoryManagerNode2.has_value());
+    EXPECT_THAT(memoryManagerAnyNode.value().get().getNumberOfMemPools(), Eq(2u));
+    EXPECT_THAT(memoryManagerNode2.value().get().getNumberOfMemPools(), Eq(2u));
+}
+
 TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(addingMoreThanOneWriterGroupFails))
 {
     auto errorHandlerCalled{false};
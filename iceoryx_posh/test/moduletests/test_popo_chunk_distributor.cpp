@@ -22,11 +22,15 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -76,8 +80,9 @@ class ChunkDistributor_test : public Test
     static constexpr uint32_t MAX_NUMBER_QUEUES = 128U;
     char memory[MEMORY_SIZE];
     iox::posix::Allocator allocator{memory, MEMORY_SIZE};
-    MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, 20U, allocator, allocator};
-    MemPool chunkMgmtPool{128U, 20U, allocator, allocator};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{128U};
+    MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+    MemPool chunkMgmtPool{128U, NUMBER_OF_CHUNKS, allocator, allocator};
 
     struct ChunkDistributorConfig
     {
@@ -88,6 +93,7 @@ class ChunkDistributor_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_NUMBER_QUEUES;
+        static constexpr bool HAS_SINGLE_PRODUCER = false;
     };
 
     using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, PolicyType>;
@@ -106,9 +112,10 @@ class ChunkDistributor_test : public Test
     }
 
     std::shared_ptr<ChunkDistributorData_t>
-    getChunkDistributorData(const SubscriberTooSlowPolicy policy = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA)
+    getChunkDistributorData(const SubscriberTooSlowPolicy policy = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA,
+                            const iox::units::Duration maxBlockingTime = iox::units::Duration::fromNanoseconds(0U))
     {
-        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
+        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE, maxBlockingTime);
     }
 
     static constexpr int64_t TIMEOUT_IN_MS = 100;
@@ -553,6 +560,86 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesKeepsOrderAndUpdatesHistory)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i + 1U));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesEveryQueueOnce)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    // a waiting listener is woken up by the first notification, further ones would only post the semaphore again if
+    // the listener announced to wait again
+    condVar.m_isListenerWaiting.store(true);
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS);
+
+    EXPECT_TRUE(condVar.isNotificationActive(0U));
+    auto semaphoreValue = condVar.m_semaphore.getValue();
+    ASSERT_FALSE(semaphoreValue.has_error());
+    EXPECT_THAT(semaphoreValue.value(), Eq(1));
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToSingleQueueBlocksWhenOptionsAreSetToBlocking)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    std::atomic_bool wasBatchDelivered{false};
+    std::thread t1([&] {
+        SharedChunk chunks[2U]{this->allocateChunk(155U), this->allocateChunk(152U)};
+        sut.deliverToAllStoredQueues(chunks, 2U);
+        wasBatchDelivered = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+
+    t1.join(); // join needs to be before the load to ensure the wasBatchDelivered store happens before the read
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(true));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
 {
     auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
@@ -647,4 +734,381 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueWhileDeliveringUnblocksDelivery)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingAndRemovingOtherQueueWhileDeliveryIsBlockedDoesNotWaitForBlockingQueue)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(1U);
+    auto otherQueueData = this->getChunkQueueData();
+
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    // the blocked sender must not prevent the update of the queues, otherwise this would wait until the consumer of
+    // the blocking queue pops a chunk
+    EXPECT_FALSE(sut.tryAddQueue(otherQueueData.get(), 0U).has_error());
+    EXPECT_FALSE(sut.tryRemoveQueue(otherQueueData.get()).has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = blockingQueue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    maybeSharedChunk = blockingQueue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesQueueSnapshotsOfTerminatedSender)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+
+    // simulate a sender which terminated while reading the active queue snapshot
+    sutData->m_queueSnapshotReaders[sutData->m_activeQueueSnapshot.load()].fetch_add(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.cleanup();
+
+    // without the cleanup, removing would wait forever for the reader of the previous snapshot
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueModificationDiscardsSnapshotReaderOfTerminatedSenderAfterTimeout)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    // simulate a sender which terminated while reading the active queue snapshot and is not yet cleaned up
+    sutData->m_queueSnapshotReaders[sutData->m_activeQueueSnapshot.load()].fetch_add(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_FALSE(detectedError.has_value());
+
+    // the update of the snapshot of the terminated sender gives up waiting for it
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOPO__CHUNK_DISTRIBUTOR_QUEUE_SNAPSHOT_NOT_RELEASED_BY_SENDER));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueAddedWhileDeliveringReceivesEveryChunkAfterItsHistory)
+{
+    // concurrent modifications of the queues require the ThreadSafePolicy
+    if (!std::is_same<TypeParam, ThreadSafePolicy>::value)
+    {
+        return;
+    }
+
+    constexpr uint32_t NUMBER_OF_SENT_CHUNKS{100U};
+    constexpr uint32_t NUMBER_OF_QUEUES{8U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+    }
+
+    std::atomic<uint32_t> numberOfSentChunks{0U};
+    std::thread sender([&] {
+        for (uint32_t i = 0U; i < NUMBER_OF_SENT_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+            numberOfSentChunks.store(i + 1U);
+            std::this_thread::yield();
+        }
+    });
+
+    // the queues are spread over the delivery to hit a chunk which is in flight
+    for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        while (numberOfSentChunks.load() < i * NUMBER_OF_SENT_CHUNKS / NUMBER_OF_QUEUES)
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_FALSE(sut.tryAddQueue(queueData[i].get(), this->HISTORY_SIZE).has_error());
+    }
+    sender.join();
+
+    for (auto& queue : queueData)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queuePopper(queue.get());
+        auto maybeSharedChunk = queuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        auto expectedValue = this->getSharedChunkValue(*maybeSharedChunk) + 1U;
+        for (maybeSharedChunk = queuePopper.tryPop(); maybeSharedChunk.has_value();
+             maybeSharedChunk = queuePopper.tryPop())
+        {
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+            ++expectedValue;
+        }
+        EXPECT_THAT(expectedValue, Eq(NUMBER_OF_SENT_CHUNKS));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToBlockingQueueGivesUpAfterMaxBlockingTime)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER,
+                                                 iox::units::Duration::fromMilliseconds(this->TIMEOUT_IN_MS));
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+    EXPECT_THAT(sut.getAccumulatedBlockingTime().toNanoseconds(), Eq(0U));
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+
+    EXPECT_THAT(sut.getAccumulatedBlockingTime().toMilliseconds(), Ge(static_cast<uint64_t>(this->TIMEOUT_IN_MS)));
+    EXPECT_THAT(queue.hasLostChunks(), Eq(true));
+    EXPECT_THAT(queue.size(), Eq(1U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueGivesUpOnceAfterMaxBlockingTime)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER,
+                                                 iox::units::Duration::fromMilliseconds(this->TIMEOUT_IN_MS));
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS);
+
+    // the maximum blocking time applies to the whole batch, the chunks after the timeout are dropped without waiting
+    EXPECT_THAT(sut.getAccumulatedBlockingTime().toMilliseconds(), Ge(static_cast<uint64_t>(this->TIMEOUT_IN_MS)));
+    EXPECT_THAT(sut.getAccumulatedBlockingTime().toMilliseconds(),
+                Lt(static_cast<uint64_t>(2 * this->TIMEOUT_IN_MS)));
+    EXPECT_THAT(queue.hasLostChunks(), Eq(true));
+    EXPECT_THAT(queue.size(), Eq(1U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryAccumulatesBlockingTime)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(true));
+
+    t1.join();
+    EXPECT_THAT(sut.getAccumulatedBlockingTime().toMilliseconds(),
+                Ge(static_cast<uint64_t>(this->TIMEOUT_IN_MS) / 2U));
+    EXPECT_THAT(queue.hasLostChunks(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DecimationDeliversOnlyEveryNthChunkAndCountsTheSkippedOnes)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_decimationFactor = 3U;
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{7U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    for (uint32_t expectedValue : {0U, 3U, 6U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+    EXPECT_THAT(queueData->m_deliveryFilterState->m_numberOfSkippedChunks.load(), Eq(4U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, SkippedChunkDoesNotNotifyTheConsumer)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    auto queueData = this->getChunkQueueData();
+    queueData->m_decimationFactor = 2U;
+    // the next offered chunk is the second one and therefore skipped
+    queueData->m_deliveryFilterState->m_numberOfOfferedChunks.store(1U);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    EXPECT_FALSE(condVar.isNotificationActive(0U));
+    EXPECT_THAT(queue.size(), Eq(0U));
+    EXPECT_THAT(queueData->m_deliveryFilterState->m_numberOfSkippedChunks.load(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, MinDeliveryIntervalSkipsChunksWhichAreDeliveredTooEarly)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_minDeliveryIntervalInNanoseconds = iox::units::Duration::fromHours(1U).toNanoseconds();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(3U));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1U));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+    EXPECT_THAT(queueData->m_deliveryFilterState->m_numberOfSkippedChunks.load(), Eq(2U));
+}
+
+TYPED_TEST(ChunkDistributor_test, MinDeliveryIntervalDeliversChunkAfterTheIntervalElapsed)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_minDeliveryIntervalInNanoseconds =
+        iox::units::Duration::fromMilliseconds(this->TIMEOUT_IN_MS).toNanoseconds();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+
+    EXPECT_THAT(queue.size(), Eq(2U));
+    EXPECT_THAT(queueData->m_deliveryFilterState->m_numberOfSkippedChunks.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DecimationIsAppliedToEveryChunkOfABatch)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto decimatedQueueData = this->getChunkQueueData();
+    decimatedQueueData->m_decimationFactor = 2U;
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> decimatedQueue(decimatedQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(decimatedQueueData.get()).has_error());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{
+        this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U), this->allocateChunk(4U)};
+    sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS);
+
+    for (uint32_t expectedValue : {1U, 3U})
+    {
+        auto maybeSharedChunk = decimatedQueue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+    EXPECT_THAT(decimatedQueue.tryPop().has_value(), Eq(false));
+    EXPECT_THAT(decimatedQueueData->m_deliveryFilterState->m_numberOfSkippedChunks.load(), Eq(2U));
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+}
+
 } // namespace
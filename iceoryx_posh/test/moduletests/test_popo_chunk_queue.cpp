@@ -69,10 +69,27 @@ class ChunkQueue_testBase
     static constexpr uint32_t RESIZED_CAPACITY{5U};
 };
 
-template <typename PolicyType, iox::cxx::VariantQueueTypes VariantQueueType>
+/// @brief the queue of the DefaultChunkQueueConfig depends on the communication policy of the build, the configs
+/// with an explicit number of producers ensure that both queues are tested
+struct MultiProducerChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
+};
+
+struct SingleProducerChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = true;
+};
+
+template <typename PolicyType,
+          iox::cxx::VariantQueueTypes VariantQueueType,
+          typename ChunkQueueConfig = MultiProducerChunkQueueConfig>
 struct TypeDefinitions
 {
     using PolicyType_t = PolicyType;
+    using ChunkQueueConfig_t = ChunkQueueConfig;
     static const iox::cxx::VariantQueueTypes variantQueueType{VariantQueueType};
 };
 
@@ -80,7 +97,13 @@ using ChunkQueueSubjects =
     Types<TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
           TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
           TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
-          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>>;
+          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>>;
 
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
@@ -95,7 +118,8 @@ class ChunkQueue_test : public Test, public ChunkQueue_testBase
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, typename TestTypes::PolicyType_t>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
     iox::cxx::VariantQueueTypes m_variantQueueType{TestTypes::variantQueueType};
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, m_variantQueueType};
@@ -237,22 +261,66 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PopFromBlockingQueueNotifiesBlockedSender)
+{
+    typename TestFixture::ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PUBLISHER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&chunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&chunkData};
+
+    pusher.push(this->allocateChunk());
+    chunkData.m_numberOfBlockedSenders.store(1U);
+
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    auto hasBeenNotified = chunkData.m_spaceAvailableSemaphore.tryWait();
+    ASSERT_FALSE(hasBeenNotified.has_error());
+    EXPECT_THAT(*hasBeenNotified, Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PopFromBlockingQueueWithoutBlockedSenderDoesNotNotify)
+{
+    typename TestFixture::ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PUBLISHER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&chunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&chunkData};
+
+    pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    auto hasBeenNotified = chunkData.m_spaceAvailableSemaphore.tryWait();
+    ASSERT_FALSE(hasBeenNotified.has_error());
+    EXPECT_THAT(*hasBeenNotified, Eq(false));
+}
+
+template <typename PolicyType, typename ChunkQueueConfig>
+struct QueueDefinitions
+{
+    using PolicyType_t = PolicyType;
+    using ChunkQueueConfig_t = ChunkQueueConfig;
+};
+
+using ChunkQueueOverflowTestSubjects = Types<QueueDefinitions<ThreadSafePolicy, MultiProducerChunkQueueConfig>,
+                                             QueueDefinitions<SingleThreadedPolicy, MultiProducerChunkQueueConfig>,
+                                             QueueDefinitions<ThreadSafePolicy, SingleProducerChunkQueueConfig>,
+                                             QueueDefinitions<SingleThreadedPolicy, SingleProducerChunkQueueConfig>>;
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
-using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+using ChunkQueueFiFoTestSubjects = ChunkQueueOverflowTestSubjects;
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 TYPED_TEST_CASE(ChunkQueueFiFo_test, ChunkQueueFiFoTestSubjects);
 #pragma GCC diagnostic pop
 
-template <typename PolicyType>
+template <typename TestTypes>
 class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
 {
   public:
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
                                  iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
@@ -270,13 +338,45 @@ TYPED_TEST(ChunkQueueFiFo_test, Capacity)
     EXPECT_THAT(this->m_popper.getCurrentCapacity(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
 }
 
-/// @note API currently not supported
+/// @note API currently not supported by the FiFo of the VariantQueue
 TYPED_TEST(ChunkQueueFiFo_test, DISABLED_SetCapacity)
 {
     this->m_popper.setCapacity(this->RESIZED_CAPACITY);
     EXPECT_THAT(this->m_popper.getCurrentCapacity(), Eq(this->RESIZED_CAPACITY));
 }
 
+TEST(ChunkQueueSingleProducer_test, SingleProducerConfigUsesTheSpscQueue)
+{
+    using ChunkQueueData_t = ChunkQueueData<SingleProducerChunkQueueConfig, ThreadSafePolicy>;
+    using SpscQueue_t = iox::concurrent::SpscQueue<ShmSafeUnmanagedChunk, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY>;
+    EXPECT_TRUE((std::is_same<ChunkQueueData_t::Queue_t, SpscQueue_t>::value));
+}
+
+TEST(ChunkQueueSingleProducer_test, OverflowBehaviorOfTheRequestedQueueTypeIsKept)
+{
+    using ChunkQueueData_t = ChunkQueueData<SingleProducerChunkQueueConfig, ThreadSafePolicy>;
+    ChunkQueueData_t fifo{QueueFullPolicy::BLOCK_PUBLISHER,
+                          iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueueData_t sofi{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                          iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+
+    EXPECT_THAT(fifo.m_queue.overflowPolicy(), Eq(iox::concurrent::SpscQueueOverflowPolicy::REJECT_NEW_VALUE));
+    EXPECT_THAT(sofi.m_queue.overflowPolicy(), Eq(iox::concurrent::SpscQueueOverflowPolicy::DISCARD_OLDEST_VALUE));
+}
+
+TEST(ChunkQueueSingleProducer_test, SetCapacityOfFiFoIsSupported)
+{
+    using ChunkQueueData_t = ChunkQueueData<SingleProducerChunkQueueConfig, ThreadSafePolicy>;
+    constexpr uint64_t RESIZED_CAPACITY{5U};
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PUBLISHER,
+                               iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+
+    popper.setCapacity(RESIZED_CAPACITY);
+
+    EXPECT_THAT(popper.getCurrentCapacity(), Eq(RESIZED_CAPACITY));
+}
+
 TYPED_TEST(ChunkQueueFiFo_test, PushFull)
 {
     for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
@@ -300,21 +400,22 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
 }
 
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
-using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+using ChunkQueueSoFiSubjects = ChunkQueueOverflowTestSubjects;
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 TYPED_TEST_CASE(ChunkQueueSoFi_test, ChunkQueueSoFiSubjects);
 #pragma GCC diagnostic pop
 
-template <typename PolicyType>
+template <typename TestTypes>
 class ChunkQueueSoFi_test : public Test, public ChunkQueue_testBase
 {
   public:
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
                                  iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
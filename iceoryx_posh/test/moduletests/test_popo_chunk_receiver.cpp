@@ -181,6 +181,62 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueReturnsNoChunkAvailable)
+{
+    const iox::mepoo::ChunkHeader* chunkHeaders[2U];
+    auto result = m_chunkReceiver.tryGetBatch(chunkHeaders, 2U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
+TEST_F(ChunkReceiver_test, getBatchReturnsChunksInOrderAndLimitedToRequestedNumber)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{5U};
+    constexpr uint32_t BATCH_SIZE{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    auto result = m_chunkReceiver.tryGetBatch(chunkHeaders, BATCH_SIZE);
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(BATCH_SIZE));
+    for (uint32_t i = 0U; i < BATCH_SIZE; i++)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+}
+
+TEST_F(ChunkReceiver_test, getBatchWhenHoldingTooManyChunksKeepsChunksInQueue)
+{
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        EXPECT_TRUE(sharedChunk);
+        m_chunkQueuePusher.push(sharedChunk);
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+
+    auto sharedChunk = getChunkFromMemoryManager();
+    EXPECT_TRUE(sharedChunk);
+    m_chunkQueuePusher.push(sharedChunk);
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[1U];
+    auto result = m_chunkReceiver.tryGetBatch(chunkHeaders, 1U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(1U));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     {
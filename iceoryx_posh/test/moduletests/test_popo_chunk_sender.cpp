@@ -34,6 +34,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -93,6 +94,7 @@ class ChunkSender_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+        static constexpr bool HAS_SINGLE_PRODUCER = false;
     };
 
     using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
@@ -377,6 +379,41 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversChunksInOrder)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = (*maybeChunkHeader)->userPayload();
+        new (sample) DummySample();
+        static_cast<DummySample*>(sample)->dummy = i;
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    m_chunkSender.sendBatch(chunkHeaders, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(popRet->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1U]));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
@@ -631,4 +668,119 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, CleanupReleasesCachedChunks)
+{
+    constexpr uint32_t CHUNK_CACHE_SIZE{4U};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::units::Duration::fromNanoseconds(0U),
+                                      CHUNK_CACHE_SIZE};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader = sut.tryAllocate(
+        iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_CACHE_SIZE));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendChainedChunkWithReceiverDeliversTheWholeChain)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{3U * BIG_CHUNK};
+    auto maybeChunkHeader = m_chunkSender.tryAllocateChained(
+        iox::UniquePortId(), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(3U));
+
+    std::vector<uint8_t> data(USER_PAYLOAD_SIZE, 73U);
+    (*maybeChunkHeader)->copyToChainedUserPayload(data.data(), data.size());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    {
+        iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+
+        std::vector<uint8_t> receivedData(USER_PAYLOAD_SIZE, 0U);
+        EXPECT_THAT(popRet->getChunkHeader()->copyFromChainedUserPayload(receivedData.data(), receivedData.size()),
+                    Eq(USER_PAYLOAD_SIZE));
+        EXPECT_THAT(receivedData, Eq(data));
+    }
+
+    m_chunkSender.releaseAll();
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, NoReuseOfLastIfChained)
+{
+    auto maybeChunkHeader = m_chunkSender.tryAllocateChained(
+        iox::UniquePortId(), 2U * BIG_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    auto chunkSmaller = m_chunkSender.tryAllocate(
+        iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(chunkSmaller.has_error());
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(2U));
+    EXPECT_THAT((*chunkSmaller)->nextChainedChunk(), Eq(nullptr));
+}
+
+TEST_F(ChunkSender_test, sendWithoutPublishTimestampOptionDoesNotStampChunk)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Eq(iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP));
+}
+
+TEST_F(ChunkSender_test, sendWithPublishTimestampOptionStampsChunkWithCurrentTime)
+{
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::units::Duration::fromNanoseconds(0U),
+                                      0U,
+                                      true};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto now = []() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<iox::mepoo::DurationNs_t>(
+                                         iox::mepoo::BaseClock_t::now().time_since_epoch())
+                                         .count());
+    };
+
+    auto maybeChunkHeader = sut.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    const uint64_t timeBeforeSend = now();
+    sut.send(*maybeChunkHeader);
+    const uint64_t timeAfterSend = now();
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Ge(timeBeforeSend));
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Le(timeAfterSend));
+
+    sut.releaseAll();
+}
+
 } // namespace
@@ -0,0 +1,329 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using iox::capro::CaproMessage;
+using iox::capro::CaproMessageType;
+
+class ClientServerPort_test : public Test
+{
+  protected:
+    ClientServerPort_test()
+    {
+        m_mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    /// @brief runs the discovery between a client and the server like the PortManager of RouDi does it
+    void connect(ClientPortRouDi& clientRouDi)
+    {
+        auto connectMessage = clientRouDi.tryGetCaProMessage();
+        ASSERT_TRUE(connectMessage.has_value());
+        ASSERT_THAT(connectMessage->m_type, Eq(CaproMessageType::CONNECT));
+
+        auto response = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(*connectMessage);
+        ASSERT_TRUE(response.has_value());
+        clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*response);
+    }
+
+    void offerServer()
+    {
+        m_serverUser.offer();
+        auto offerMessage = m_serverRouDi.tryGetCaProMessage();
+        ASSERT_TRUE(offerMessage.has_value());
+        ASSERT_THAT(offerMessage->m_type, Eq(CaproMessageType::OFFER));
+    }
+
+    RequestHeader* sendRequest(ClientPortUser& clientUser, const uint64_t value, const int64_t sequenceNumber)
+    {
+        auto allocateResult = clientUser.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+        EXPECT_FALSE(allocateResult.has_error());
+        auto requestHeader = allocateResult.value();
+        requestHeader->setSequenceNumber(sequenceNumber);
+        *static_cast<uint64_t*>(requestHeader->getUserPayload()) = value;
+        EXPECT_FALSE(clientUser.sendRequest(requestHeader).has_error());
+        return requestHeader;
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20U;
+    static constexpr uint32_t CHUNK_SIZE = 256U;
+
+    iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0); },
+                                          [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    const iox::capro::ServiceDescription m_service{"Ping", "Pong", "Service"};
+    ClientOptions m_clientOptions;
+    ServerOptions m_serverOptions;
+
+    ServerPortData m_serverPortData{m_service, "server", &m_memoryManager, m_serverOptions};
+    ServerPortRouDi m_serverRouDi{&m_serverPortData};
+    ServerPortUser m_serverUser{&m_serverPortData};
+
+    ClientPortData m_clientPortData{m_service, "client", &m_memoryManager, m_clientOptions};
+    ClientPortRouDi m_clientRouDi{&m_clientPortData};
+    ClientPortUser m_clientUser{&m_clientPortData};
+};
+
+TEST_F(ClientServerPort_test, ClientIsConnectedAfterServerAcknowledgedTheConnectRequest)
+{
+    offerServer();
+
+    connect(m_clientRouDi);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    EXPECT_TRUE(m_serverUser.hasClients());
+}
+
+TEST_F(ClientServerPort_test, ClientWaitsForOfferWhenServerIsNotOffered)
+{
+    connect(m_clientRouDi);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+    EXPECT_FALSE(m_serverUser.hasClients());
+}
+
+TEST_F(ClientServerPort_test, ClientWhichWaitsForOfferConnectsWhenServerIsOffered)
+{
+    connect(m_clientRouDi);
+    m_serverUser.offer();
+    auto offerMessage = m_serverRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(offerMessage.has_value());
+
+    auto connectMessage = m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*offerMessage);
+    ASSERT_TRUE(connectMessage.has_value());
+    EXPECT_THAT(connectMessage->m_type, Eq(CaproMessageType::CONNECT));
+    auto response = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(*connectMessage);
+    ASSERT_TRUE(response.has_value());
+    m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*response);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+}
+
+TEST_F(ClientServerPort_test, ServerReceivesRequestWithPayloadAndClientId)
+{
+    offerServer();
+    connect(m_clientRouDi);
+
+    sendRequest(m_clientUser, 42U, 73);
+
+    auto getRequestResult = m_serverUser.getRequest();
+    ASSERT_FALSE(getRequestResult.has_error());
+    auto requestHeader = getRequestResult.value();
+    EXPECT_THAT(*static_cast<const uint64_t*>(requestHeader->getUserPayload()), Eq(42U));
+    EXPECT_THAT(requestHeader->getSequenceNumber(), Eq(73));
+    EXPECT_THAT(requestHeader->getClientId(), Eq(m_clientPortData.m_uniqueId));
+    m_serverUser.releaseRequest(requestHeader);
+}
+
+TEST_F(ClientServerPort_test, ResponseIsRoutedBackToTheRequestingClient)
+{
+    ClientPortData otherClientPortData{m_service, "otherClient", &m_memoryManager, m_clientOptions};
+    ClientPortRouDi otherClientRouDi{&otherClientPortData};
+    ClientPortUser otherClientUser{&otherClientPortData};
+    offerServer();
+    connect(m_clientRouDi);
+    connect(otherClientRouDi);
+
+    sendRequest(otherClientUser, 13U, 37);
+    auto requestHeader = m_serverUser.getRequest().value();
+    auto responseHeader = m_serverUser.allocateResponse(requestHeader, sizeof(uint64_t), alignof(uint64_t)).value();
+    *static_cast<uint64_t*>(responseHeader->getUserPayload()) = 2U * 13U;
+    EXPECT_FALSE(m_serverUser.sendResponse(responseHeader).has_error());
+    m_serverUser.releaseRequest(requestHeader);
+
+    EXPECT_FALSE(m_clientUser.hasNewResponses());
+    auto getResponseResult = otherClientUser.getResponse();
+    ASSERT_FALSE(getResponseResult.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>(getResponseResult.value()->getUserPayload()), Eq(2U * 13U));
+    EXPECT_THAT(getResponseResult.value()->getSequenceNumber(), Eq(37));
+    otherClientUser.releaseResponse(getResponseResult.value());
+}
+
+TEST_F(ClientServerPort_test, GetResponseWithoutResponseReturnsNoChunkAvailable)
+{
+    auto getResponseResult = m_clientUser.getResponse();
+
+    ASSERT_TRUE(getResponseResult.has_error());
+    EXPECT_THAT(getResponseResult.get_error(), Eq(ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ClientServerPort_test, SendingRequestWithoutConnectionFailsAndReleasesTheRequest)
+{
+    auto requestHeader = m_clientUser.allocateRequest(sizeof(uint64_t)).value();
+
+    auto sendResult = m_clientUser.sendRequest(requestHeader);
+
+    ASSERT_TRUE(sendResult.has_error());
+    EXPECT_THAT(sendResult.get_error(), Eq(ClientSendError::NOT_CONNECTED));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerPort_test, FreeRequestReleasesTheChunk)
+{
+    auto requestHeader = m_clientUser.allocateRequest(sizeof(uint64_t)).value();
+    EXPECT_THAT(usedChunks(), Eq(1U));
+
+    m_clientUser.freeRequest(requestHeader);
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerPort_test, SendingResponseToDisconnectedClientFails)
+{
+    offerServer();
+    connect(m_clientRouDi);
+    sendRequest(m_clientUser, 42U, 0);
+    auto requestHeader = m_serverUser.getRequest().value();
+
+    m_clientUser.disconnect();
+    auto disconnectMessage = m_clientRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(disconnectMessage.has_value());
+    EXPECT_THAT(disconnectMessage->m_type, Eq(CaproMessageType::DISCONNECT));
+    auto response = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(*disconnectMessage);
+    m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*response);
+
+    const auto usedChunksBeforeResponse = usedChunks();
+    auto responseHeader = m_serverUser.allocateResponse(requestHeader, sizeof(uint64_t)).value();
+    auto sendResult = m_serverUser.sendResponse(responseHeader);
+    m_serverUser.releaseRequest(requestHeader);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::NOT_CONNECTED));
+    ASSERT_TRUE(sendResult.has_error());
+    EXPECT_THAT(sendResult.get_error(), Eq(ServerSendError::CLIENT_NOT_AVAILABLE));
+    EXPECT_THAT(usedChunks(), Eq(usedChunksBeforeResponse));
+}
+
+TEST_F(ClientServerPort_test, ClientWaitsForOfferWhenServerStopsOffer)
+{
+    offerServer();
+    connect(m_clientRouDi);
+
+    m_serverUser.stopOffer();
+    auto stopOfferMessage = m_serverRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(stopOfferMessage.has_value());
+    EXPECT_THAT(stopOfferMessage->m_type, Eq(CaproMessageType::STOP_OFFER));
+    m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*stopOfferMessage);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+    EXPECT_FALSE(m_serverUser.hasClients());
+}
+
+TEST_F(ClientServerPort_test, ClientStaysConnectedWhenAnotherServerOfTheServiceStopsOffer)
+{
+    ServerPortData otherServerPortData{m_service, "otherServer", &m_memoryManager, m_serverOptions};
+    ServerPortRouDi otherServerRouDi{&otherServerPortData};
+    ServerPortUser otherServerUser{&otherServerPortData};
+    offerServer();
+    connect(m_clientRouDi);
+
+    otherServerUser.offer();
+    auto offerMessage = otherServerRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(offerMessage.has_value());
+    EXPECT_FALSE(m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*offerMessage).has_value());
+
+    otherServerUser.stopOffer();
+    auto stopOfferMessage = otherServerRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(stopOfferMessage.has_value());
+    ASSERT_THAT(stopOfferMessage->m_type, Eq(CaproMessageType::STOP_OFFER));
+    EXPECT_FALSE(m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*stopOfferMessage).has_value());
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    sendRequest(m_clientUser, 42U, 0);
+    auto requestHeader = m_serverUser.getRequest();
+    ASSERT_FALSE(requestHeader.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>(requestHeader.value()->getUserPayload()), Eq(42U));
+    m_serverUser.releaseRequest(requestHeader.value());
+}
+
+TEST_F(ClientServerPort_test, ClientConnectsToRemainingServerWhenConnectedServerStopsOffer)
+{
+    ServerPortData otherServerPortData{m_service, "otherServer", &m_memoryManager, m_serverOptions};
+    ServerPortRouDi otherServerRouDi{&otherServerPortData};
+    ServerPortUser otherServerUser{&otherServerPortData};
+    offerServer();
+    connect(m_clientRouDi);
+    otherServerUser.offer();
+    auto offerMessage = otherServerRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(offerMessage.has_value());
+
+    m_serverUser.stopOffer();
+    auto stopOfferMessage = m_serverRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(stopOfferMessage.has_value());
+    m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*stopOfferMessage);
+    EXPECT_THAT(m_clientRouDi.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+
+    // the PortManager replays the offer of the server which still offers the service
+    auto connectMessage = m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*offerMessage);
+    ASSERT_TRUE(connectMessage.has_value());
+    ASSERT_THAT(connectMessage->m_type, Eq(CaproMessageType::CONNECT));
+    auto response = otherServerRouDi.dispatchCaProMessageAndGetPossibleResponse(*connectMessage);
+    ASSERT_TRUE(response.has_value());
+    m_clientRouDi.dispatchCaProMessageAndGetPossibleResponse(*response);
+
+    EXPECT_THAT(m_clientUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    EXPECT_TRUE(otherServerUser.hasClients());
+    sendRequest(m_clientUser, 73U, 0);
+    auto requestHeader = otherServerUser.getRequest();
+    ASSERT_FALSE(requestHeader.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>(requestHeader.value()->getUserPayload()), Eq(73U));
+    otherServerUser.releaseRequest(requestHeader.value());
+}
+
+TEST_F(ClientServerPort_test, ConditionVariableOfClientIsNotifiedByResponse)
+{
+    ConditionVariableData conditionVariableData{"client"};
+    offerServer();
+    connect(m_clientRouDi);
+    m_clientUser.setConditionVariable(conditionVariableData, 0U);
+
+    sendRequest(m_clientUser, 42U, 0);
+    auto requestHeader = m_serverUser.getRequest().value();
+    auto responseHeader = m_serverUser.allocateResponse(requestHeader, sizeof(uint64_t)).value();
+    EXPECT_FALSE(m_serverUser.sendResponse(responseHeader).has_error());
+    m_serverUser.releaseRequest(requestHeader);
+
+    EXPECT_TRUE(ConditionListener(conditionVariableData).wasNotified());
+    m_clientUser.releaseResponse(m_clientUser.getResponse().value());
+}
+
+} // namespace
@@ -127,10 +127,11 @@ TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThread
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(sut.isNotificationActive(i));
     }
+    EXPECT_FALSE(sut.hasActiveNotifications());
 }
 
 TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeName)
@@ -140,10 +141,11 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(m_condVarData.isNotificationActive(i));
     }
+    EXPECT_FALSE(m_condVarData.hasActiveNotifications());
 }
 
 TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
@@ -155,15 +157,38 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_TRUE(m_condVarData.isNotificationActive(i));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_FALSE(m_condVarData.isNotificationActive(i));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, NotifyDoesNotPostSemaphoreWhenListenerIsNotWaiting)
+{
+    m_signaler.notify();
+    m_signaler.notify();
+
+    auto semaphoreValue = m_condVarData.m_semaphore.getValue();
+    ASSERT_FALSE(semaphoreValue.has_error());
+    EXPECT_THAT(semaphoreValue.value(), Eq(0));
+    EXPECT_TRUE(m_condVarData.hasActiveNotifications());
+}
+
+TEST_F(ConditionVariable_test, NotifyPostsSemaphoreOnceWhenListenerIsWaiting)
+{
+    m_condVarData.m_isListenerWaiting.store(true);
+    m_signaler.notify();
+    m_signaler.notify();
+
+    auto semaphoreValue = m_condVarData.m_semaphore.getValue();
+    ASSERT_FALSE(semaphoreValue.has_error());
+    EXPECT_THAT(semaphoreValue.value(), Eq(1));
+    EXPECT_FALSE(m_condVarData.m_isListenerWaiting.load());
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ConditionListener sut(m_condVarData);
@@ -399,10 +424,7 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
-        {
-            EXPECT_THAT(notification, Eq(false));
-        }
+        EXPECT_FALSE(m_condVarData.hasActiveNotifications());
     });
 
     IOX_DISCARD_RESULT(threadSetupSemaphore.wait());
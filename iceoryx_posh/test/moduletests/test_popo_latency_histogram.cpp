@@ -0,0 +1,148 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::popo::LatencyHistogram;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram sut;
+};
+
+TEST_F(LatencyHistogram_test, EveryLatencyIsCountedInTheBucketWithTheNextUpperBound)
+{
+    for (uint64_t latency = 0U; latency < 100000U; ++latency)
+    {
+        const auto index = LatencyHistogram::bucketIndex(latency);
+        ASSERT_THAT(index, Lt(LatencyHistogram::NUMBER_OF_BUCKETS));
+        ASSERT_THAT(LatencyHistogram::bucketUpperBound(index), Ge(latency));
+        if (index > 0U)
+        {
+            ASSERT_THAT(LatencyHistogram::bucketUpperBound(index - 1U), Lt(latency));
+        }
+    }
+}
+
+TEST_F(LatencyHistogram_test, UpperBoundOfBucketDeviatesAtMostBySubBucketResolution)
+{
+    for (uint64_t latency = 1U; latency < (1ULL << LatencyHistogram::MAX_EXPONENT); latency = latency * 3U + 1U)
+    {
+        const auto upperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(latency));
+        EXPECT_THAT(upperBound - latency, Le(latency / LatencyHistogram::NUMBER_OF_SUB_BUCKETS));
+    }
+}
+
+TEST_F(LatencyHistogram_test, LatenciesBeyondTheRangeAreCountedInTheLastBucket)
+{
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1ULL << LatencyHistogram::MAX_EXPONENT),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(LatencyHistogram_test, StatisticsOfEmptyHistogramAreZero)
+{
+    auto statistics = sut.statistics();
+
+    EXPECT_THAT(statistics.numberOfSamples, Eq(0U));
+    EXPECT_THAT(statistics.p50InNanoseconds, Eq(0U));
+    EXPECT_THAT(statistics.p99InNanoseconds, Eq(0U));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, StatisticsOfSingleLatencyAreThisLatency)
+{
+    constexpr uint64_t LATENCY{12345U};
+    sut.record(LATENCY);
+
+    auto statistics = sut.statistics();
+
+    EXPECT_THAT(statistics.numberOfSamples, Eq(1U));
+    EXPECT_THAT(statistics.p50InNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(statistics.p99InNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(LATENCY));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreWithinTheSubBucketResolution)
+{
+    constexpr uint64_t NUMBER_OF_SAMPLES{1000U};
+    constexpr uint64_t LATENCY_STEP{1000U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        sut.record(i * LATENCY_STEP);
+    }
+
+    auto statistics = sut.statistics();
+
+    constexpr uint64_t EXPECTED_P50{500U * LATENCY_STEP};
+    constexpr uint64_t EXPECTED_P99{990U * LATENCY_STEP};
+    constexpr uint64_t MAX_DEVIATION_OF_P50{EXPECTED_P50 / LatencyHistogram::NUMBER_OF_SUB_BUCKETS};
+    EXPECT_THAT(statistics.numberOfSamples, Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(statistics.p50InNanoseconds, Ge(EXPECTED_P50));
+    EXPECT_THAT(statistics.p50InNanoseconds, Le(EXPECTED_P50 + MAX_DEVIATION_OF_P50));
+    EXPECT_THAT(statistics.p99InNanoseconds, Ge(EXPECTED_P99));
+    EXPECT_THAT(statistics.p99InNanoseconds, Le(NUMBER_OF_SAMPLES * LATENCY_STEP));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(NUMBER_OF_SAMPLES * LATENCY_STEP));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesInTheLastBucketAreBoundedByTheMaximum)
+{
+    constexpr uint64_t HUGE_LATENCY{(1ULL << LatencyHistogram::MAX_EXPONENT) * 3U};
+    sut.record(HUGE_LATENCY);
+
+    auto statistics = sut.statistics();
+
+    EXPECT_THAT(statistics.p99InNanoseconds, Eq(HUGE_LATENCY));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(HUGE_LATENCY));
+}
+
+TEST_F(LatencyHistogram_test, ConcurrentlyRecordedLatenciesAreAllCounted)
+{
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t NUMBER_OF_SAMPLES_PER_THREAD{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES_PER_THREAD; ++i)
+            {
+                sut.record(t * NUMBER_OF_SAMPLES_PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto statistics = sut.statistics();
+
+    EXPECT_THAT(statistics.numberOfSamples, Eq(NUMBER_OF_THREADS * NUMBER_OF_SAMPLES_PER_THREAD));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(NUMBER_OF_THREADS * NUMBER_OF_SAMPLES_PER_THREAD - 1U));
+}
+
+} // namespace
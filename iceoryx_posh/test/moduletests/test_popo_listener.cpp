@@ -134,8 +134,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const uint64_t numberOfWorkers = 0U) noexcept
+        : Listener(data, numberOfWorkers)
     {
     }
 };
@@ -1162,4 +1162,119 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
-} // namespace
\ No newline at end of file
+//////////////////////////////////
+// BEGIN worker pool
+//////////////////////////////////
+TEST_F(Listener_test, HasNoWorkersByDefault)
+{
+    EXPECT_THAT(m_sut->numberOfWorkers(), Eq(0U));
+}
+
+TEST_F(Listener_test, NumberOfWorkersIsLimitedToMaximum)
+{
+    m_sut.emplace(m_condVarData, iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER + 1U);
+
+    EXPECT_THAT(m_sut->numberOfWorkers(), Eq(iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER));
+}
+
+TIMING_TEST_F(Listener_test, CallbackIsCalledByWorkerAfterNotify, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, 2U);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+});
+
+TIMING_TEST_F(Listener_test, BlockedCallbackDoesNotDelayCallbackOfEventOnOtherWorker, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, 2U);
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    constexpr uint64_t NUMBER_OF_TRIGGER_UNBLOCKS = 10U;
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_source == &bar);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(NUMBER_OF_TRIGGER_UNBLOCKS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+});
+
+TIMING_TEST_F(Listener_test, TriggerWhileInCallbackOnWorkerLeadsToAnotherCallback, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, 2U);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    constexpr uint64_t NUMBER_OF_RETRIGGERS = 10U;
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_RETRIGGERS; ++i)
+    {
+        fuu.triggerStoepsel();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(NUMBER_OF_RETRIGGERS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // the notifications during the callback are collected in one further callback
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 2U);
+});
+
+TIMING_TEST_F(Listener_test, TriggeringAllEventsWithMaximumNumberOfWorkersCallsAllCallbacksOnce, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER);
+    std::vector<SimpleEventClass> events(iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER);
+
+    AttachEvent<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER - 1U>::doIt(*m_sut, events, SimpleEvent::StoepselBachelorParty);
+
+    for (auto& e : events)
+    {
+        e.triggerStoepsel();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; ++i)
+    {
+        TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[i].m_source == &events[i]);
+        TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[i].m_count == 1U);
+    }
+});
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+} // namespace
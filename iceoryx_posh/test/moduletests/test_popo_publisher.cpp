@@ -262,6 +262,72 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchLoansDefaultInitializedSamples)
+{
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(secondChunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().size(), 2U);
+    EXPECT_EQ(result.value()[0].getChunkHeader(), chunkMock.chunkHeader());
+    EXPECT_EQ(result.value()[1].getChunkHeader(), secondChunkMock.chunkHeader());
+    EXPECT_EQ(result.value()[1]->val, DummyData::defaultVal());
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchReleasesAlreadyLoanedSamplesOnError)
+{
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(
+            ByMove(iox::cxx::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchFailsWhenMoreSamplesThanAllowedInParallelAreRequested)
+{
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllChunksInOrderWithOneCall)
+{
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(secondChunkMock.chunkHeader()))));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) {
+            sentChunkHeaders.assign(chunkHeaders, chunkHeaders + numberOfChunks);
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    sut.loanBatch(2U).and_then([&](auto& samples) { sut.publishBatch(std::move(samples)); });
+    // ===== Verify ===== //
+    ASSERT_EQ(sentChunkHeaders.size(), 2U);
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], secondChunkMock.chunkHeader());
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
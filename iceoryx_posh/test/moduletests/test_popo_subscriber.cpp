@@ -169,6 +169,46 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchCallsCallbackWithSampleForEveryTakenChunk)
+{
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks(_, 5U))
+        .WillOnce(Invoke([&](const iox::mepoo::ChunkHeader** const chunkHeaders, const uint32_t) {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::cxx::success<uint32_t>(2U);
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeBatch(
+        5U, [&](iox::popo::Sample<const DummyData>&& sample) { userPayloads.push_back(sample.get()); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    ASSERT_EQ(userPayloads.size(), 2U);
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeAllForwardsErrorOfBaseSubscriberWithoutCallingCallback)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks(_, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY))
+        .WillOnce(Return(ByMove(iox::cxx::error<iox::popo::ChunkReceiveResult>(
+            iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    // ===== Test ===== //
+    bool wasCallbackCalled{false};
+    auto result = sut.takeAll([&](iox::popo::Sample<const DummyData>&&) { wasCallbackCalled = true; });
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_FALSE(wasCallbackCalled);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     // ===== Setup ===== //
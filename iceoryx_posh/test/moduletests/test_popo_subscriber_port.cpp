@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
@@ -28,6 +30,7 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
 #include "test.hpp"
 
 #include <memory>
@@ -524,4 +527,95 @@ TEST_F(SubscriberPortMultiProducer_test, InvalidMessageResultsInError)
     ASSERT_THAT(receivedError, Eq(iox::Error::kPOPO__CAPRO_PROTOCOL_ERROR));
 }
 
+class SubscriberPortQueueLatency_test : public Test
+{
+  protected:
+    SubscriberPortQueueLatency_test()
+    {
+        m_mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        m_memoryManager.configureMemoryManager(m_mempoolConfig, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    /// @brief sends the chunks like the publisher port would do, without the need for a discovery by RouDi
+    void sendChunks(const bool publishTimestamp, const uint32_t numberOfChunks)
+    {
+        iox::popo::PublisherOptions publisherOptions;
+        publisherOptions.publishTimestamp = publishTimestamp;
+        iox::popo::PublisherPortData publisherPortData{
+            SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION, "myApp", &m_memoryManager, publisherOptions};
+        iox::popo::ChunkSender<iox::popo::PublisherPortData::ChunkSenderData_t> chunkSender{
+            &publisherPortData.m_chunkSenderData};
+        ASSERT_FALSE(chunkSender.tryAddQueue(&m_subscriberPortData.m_chunkReceiverData).has_error());
+
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            auto maybeChunkHeader = chunkSender.tryAllocate(publisherPortData.m_uniqueId,
+                                                            sizeof(uint64_t),
+                                                            alignof(uint64_t),
+                                                            iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                            iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+            ASSERT_FALSE(maybeChunkHeader.has_error());
+            chunkSender.send(maybeChunkHeader.value());
+        }
+        chunkSender.releaseAll();
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUMBER_OF_CHUNKS = 20U;
+    static constexpr uint32_t CHUNK_SIZE = 128U;
+
+    iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0); },
+                                          [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolConfig;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    iox::popo::SubscriberPortData m_subscriberPortData{SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
+                                                       "myApp",
+                                                       iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                       iox::popo::SubscriberOptions()};
+    iox::popo::SubscriberPortUser m_sutUserSide{&m_subscriberPortData};
+};
+
+TEST_F(SubscriberPortQueueLatency_test, ChunksWithoutPublishTimestampAreNotRecorded)
+{
+    sendChunks(false, 1U);
+
+    auto maybeChunkHeader = m_sutUserSide.tryGetChunk();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_sutUserSide.releaseChunk(maybeChunkHeader.value());
+
+    EXPECT_THAT(m_subscriberPortData.m_queueLatencyHistogram.statistics().numberOfSamples, Eq(0U));
+}
+
+TEST_F(SubscriberPortQueueLatency_test, TryGetChunkRecordsLatencyOfChunkWithPublishTimestamp)
+{
+    sendChunks(true, 1U);
+
+    auto maybeChunkHeader = m_sutUserSide.tryGetChunk();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.value()->publishTimestamp(), Ne(iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP));
+    m_sutUserSide.releaseChunk(maybeChunkHeader.value());
+
+    EXPECT_THAT(m_subscriberPortData.m_queueLatencyHistogram.statistics().numberOfSamples, Eq(1U));
+}
+
+TEST_F(SubscriberPortQueueLatency_test, TryGetChunksRecordsLatencyOfEveryChunkWithPublishTimestamp)
+{
+    constexpr uint32_t NUMBER_OF_SENT_CHUNKS{3U};
+    sendChunks(true, NUMBER_OF_SENT_CHUNKS);
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_SENT_CHUNKS];
+    auto maybeNumberOfChunks = m_sutUserSide.tryGetChunks(chunkHeaders, NUMBER_OF_SENT_CHUNKS);
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    ASSERT_THAT(maybeNumberOfChunks.value(), Eq(NUMBER_OF_SENT_CHUNKS));
+    for (auto chunkHeader : chunkHeaders)
+    {
+        m_sutUserSide.releaseChunk(chunkHeader);
+    }
+
+    EXPECT_THAT(m_subscriberPortData.m_queueLatencyHistogram.statistics().numberOfSamples, Eq(NUMBER_OF_SENT_CHUNKS));
+}
+
 } // namespace
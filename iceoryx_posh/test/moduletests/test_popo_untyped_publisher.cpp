@@ -133,6 +133,42 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanBatchReleasesAlreadyLoanedChunksIfPortCannotSatisfyAllocationRequest)
+{
+    constexpr uint32_t ALLOCATION_SIZE = 17U;
+    EXPECT_CALL(portMock, tryAllocateChunk(ALLOCATION_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(
+            ByMove(iox::cxx::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader())).Times(1);
+    // ===== Test ===== //
+    void* userPayloads[2U];
+    auto result = sut.loanBatch(userPayloads, 2U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithOneCallViaUnderlyingPort)
+{
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    void* userPayloads[2U]{chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) {
+            sentChunkHeaders.assign(chunkHeaders, chunkHeaders + numberOfChunks);
+        }));
+    // ===== Test ===== //
+    sut.publishBatch(userPayloads, 2U);
+    // ===== Verify ===== //
+    ASSERT_EQ(sentChunkHeaders.size(), 2U);
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], secondChunkMock.chunkHeader());
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -139,6 +139,26 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeAllCallsCallbackWithUserPayloadForEveryTakenChunk)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks(_, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY))
+        .WillOnce(Invoke([&](const iox::mepoo::ChunkHeader** const chunkHeaders, const uint32_t) {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            return iox::cxx::success<uint32_t>(1U);
+        }));
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeAll([&](const void* userPayload) { userPayloads.push_back(userPayload); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 1U);
+    ASSERT_EQ(userPayloads.size(), 1U);
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+    sut.release(userPayloads[0]);
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     // ===== Setup ===== //
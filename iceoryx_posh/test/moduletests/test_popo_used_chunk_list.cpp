@@ -119,6 +119,35 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, MultipleChunksCanBeAddedAtOnce)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{
+        getChunkFromMemoryManager(), getChunkFromMemoryManager(), getChunkFromMemoryManager()};
+
+    EXPECT_TRUE(sut.insert(chunks, NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY - NUMBER_OF_CHUNKS));
+
+    SharedChunk chunk;
+    for (auto& insertedChunk : chunks)
+    {
+        EXPECT_TRUE(sut.remove(insertedChunk.getChunkHeader(), chunk));
+    }
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(UsedChunkList_test, AddingMoreChunksAtOnceThanFreeSpaceAddsNone)
+{
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY - 1U,
+                         [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+
+    SharedChunk chunks[2U]{getChunkFromMemoryManager(), getChunkFromMemoryManager()};
+    EXPECT_FALSE(sut.insert(chunks, 2U));
+    EXPECT_THAT(sut.freeSpace(), Eq(1U));
+    EXPECT_TRUE(sut.insert(chunks, 1U));
+    EXPECT_THAT(sut.freeSpace(), Eq(0U));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     auto chunk = getChunkFromMemoryManager();
@@ -223,6 +252,37 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, InterleavedInsertionAndRemovalAlwaysRemovesTheRequestedChunk)
+{
+    constexpr uint32_t NUMBER_OF_ROUNDS{20U};
+    std::vector<SharedChunk> chunksInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        EXPECT_TRUE(sut.insert(chunk));
+        chunksInUse.emplace_back(std::move(chunk));
+    });
+
+    // remove a chunk from a varying position and replace it with a new one to shift the entries of the hash table
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        const auto index = (round * 7U) % USED_CHUNK_LIST_CAPACITY;
+        SharedChunk removedChunk;
+        ASSERT_TRUE(sut.remove(chunksInUse[index].getChunkHeader(), removedChunk));
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse[index].getChunkHeader()));
+
+        chunksInUse[index] = getChunkFromMemoryManager();
+        EXPECT_TRUE(sut.insert(chunksInUse[index]));
+    }
+
+    for (auto& chunk : chunksInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunk.getChunkHeader()));
+    }
+
+    checkIfEmpty();
+}
+
 TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 {
     auto chunk = getChunkFromMemoryManager();
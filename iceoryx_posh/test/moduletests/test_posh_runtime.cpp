@@ -465,6 +465,33 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithQueueCapacityZeroClampsQueue
     EXPECT_EQ(1U, subscriberPort->m_chunkReceiverData.m_queue.capacity());
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithDecimationFactorZeroClampsDecimationFactorTo1)
+{
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.decimationFactor = 0U;
+
+    auto subscriberPort = m_runtime->getMiddlewareSubscriber(
+        iox::capro::ServiceDescription(34U, 4U, 5U), subscriberOptions, iox::runtime::PortConfigInfo(11U, 22U, 33U));
+
+    ASSERT_NE(nullptr, subscriberPort);
+    EXPECT_EQ(1U, subscriberPort->m_chunkReceiverData.m_decimationFactor);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewareSubscriberTransfersDecimationAndMinDeliveryIntervalToTheReceiverQueue)
+{
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.decimationFactor = 10U;
+    subscriberOptions.minDeliveryInterval = iox::units::Duration::fromMilliseconds(100U);
+
+    auto subscriberPort = m_runtime->getMiddlewareSubscriber(
+        iox::capro::ServiceDescription(34U, 4U, 6U), subscriberOptions, iox::runtime::PortConfigInfo(11U, 22U, 33U));
+
+    ASSERT_NE(nullptr, subscriberPort);
+    EXPECT_EQ(10U, subscriberPort->m_chunkReceiverData.m_decimationFactor);
+    EXPECT_EQ(subscriberOptions.minDeliveryInterval.toNanoseconds(),
+              subscriberPort->m_chunkReceiverData.m_minDeliveryIntervalInNanoseconds);
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareSubscriberDefaultArgs)
 {
     auto subscriberPort = m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U));
@@ -555,6 +582,104 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithQueueFullPolicySetToBlockPub
                 Eq(iox::popo::QueueFullPolicy::BLOCK_PUBLISHER));
 }
 
+TEST_F(PoshRuntime_test, PreparedPublisherIsReturnedByGetMiddlewarePublisher)
+{
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 13U;
+    publisherOptions.nodeName = m_nodeName;
+    m_runtime->preparePublisher(
+        iox::capro::ServiceDescription(99U, 1U, 20U), publisherOptions, iox::runtime::PortConfigInfo(11U, 22U, 33U));
+
+    const auto publisherPort = m_runtime->getMiddlewarePublisher(
+        iox::capro::ServiceDescription(99U, 1U, 20U), publisherOptions, iox::runtime::PortConfigInfo(11U, 22U, 33U));
+
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(iox::capro::ServiceDescription(99U, 1U, 20U), publisherPort->m_serviceDescription);
+    EXPECT_EQ(publisherOptions.historyCapacity, publisherPort->m_chunkSenderData.m_historyCapacity);
+}
+
+TEST_F(PoshRuntime_test, PreparedSubscriberIsReturnedByGetMiddlewareSubscriber)
+{
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 13U;
+    subscriberOptions.queueCapacity = 42U;
+    subscriberOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PUBLISHER;
+    m_runtime->prepareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U), subscriberOptions);
+
+    const auto subscriberPort =
+        m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U), subscriberOptions);
+
+    ASSERT_NE(nullptr, subscriberPort);
+    EXPECT_EQ(iox::capro::ServiceDescription(99U, 1U, 20U), subscriberPort->m_serviceDescription);
+    EXPECT_EQ(subscriberOptions.historyRequest, subscriberPort->m_historyRequest);
+    EXPECT_EQ(subscriberOptions.queueCapacity, subscriberPort->m_chunkReceiverData.m_queue.capacity());
+    EXPECT_THAT(subscriberPort->m_chunkReceiverData.m_queueFullPolicy,
+                Eq(iox::popo::QueueFullPolicy::BLOCK_PUBLISHER));
+}
+
+TEST_F(PoshRuntime_test, PreparedPortIsReturnedOnlyOnce)
+{
+    m_runtime->prepareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U));
+
+    const auto subscriberPort1 = m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U));
+    const auto subscriberPort2 = m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription(99U, 1U, 20U));
+
+    ASSERT_NE(nullptr, subscriberPort1);
+    ASSERT_NE(nullptr, subscriberPort2);
+    EXPECT_NE(subscriberPort1, subscriberPort2);
+}
+
+TEST_F(PoshRuntime_test, PreparedPortsWhichDoNotFitIntoOneMessageAreAllCreated)
+{
+    constexpr uint16_t NUMBER_OF_PORTS{64U};
+    for (uint16_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        m_runtime->preparePublisher(iox::capro::ServiceDescription(i, 1U, 20U));
+        m_runtime->prepareSubscriber(iox::capro::ServiceDescription(i, 1U, 20U));
+    }
+
+    for (uint16_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const auto publisherPort = m_runtime->getMiddlewarePublisher(iox::capro::ServiceDescription(i, 1U, 20U));
+        const auto subscriberPort = m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription(i, 1U, 20U));
+        ASSERT_NE(nullptr, publisherPort);
+        ASSERT_NE(nullptr, subscriberPort);
+        EXPECT_EQ(iox::capro::ServiceDescription(i, 1U, 20U), publisherPort->m_serviceDescription);
+        EXPECT_EQ(iox::capro::ServiceDescription(i, 1U, 20U), subscriberPort->m_serviceDescription);
+    }
+}
+
+TEST_F(PoshRuntime_test, PreparedPublisherWithSameServiceDescriptionAndOneToManyPolicyFails)
+{
+    auto publisherDuplicateDetected{false};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&publisherDuplicateDetected](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            if (error == iox::Error::kPOSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE)
+            {
+                publisherDuplicateDetected = true;
+            }
+        });
+
+    auto sameServiceDescription = iox::capro::ServiceDescription(99U, 1U, 20U);
+    m_runtime->preparePublisher(sameServiceDescription);
+    m_runtime->preparePublisher(sameServiceDescription);
+
+    const auto publisherPort1 = m_runtime->getMiddlewarePublisher(sameServiceDescription);
+    const auto publisherPort2 = m_runtime->getMiddlewarePublisher(sameServiceDescription);
+
+    ASSERT_NE(nullptr, publisherPort1);
+
+    if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        ASSERT_EQ(nullptr, publisherPort2);
+        EXPECT_TRUE(publisherDuplicateDetected);
+    }
+    else if (std::is_same<iox::build::CommunicationPolicy, iox::build::ManyToManyPolicy>::value)
+    {
+        ASSERT_NE(nullptr, publisherPort2);
+    }
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableIsSuccessful)
 {
     auto conditionVariable = m_runtime->getMiddlewareConditionVariable();
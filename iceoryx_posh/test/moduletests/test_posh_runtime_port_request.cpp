@@ -0,0 +1,117 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/port_request.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+using namespace iox;
+
+class PoshRuntimePortRequest_test : public Test
+{
+  public:
+    PortRequest transmit(const PortRequest& portRequest)
+    {
+        IpcMessage sendBuffer;
+        sendBuffer << static_cast<cxx::Serialization>(portRequest).toString();
+        EXPECT_TRUE(sendBuffer.isValid());
+        return PortRequest(cxx::Serialization(sendBuffer.getElementAtIndex(0U)));
+    }
+
+    const capro::ServiceDescription m_service{"Radar", "FrontLeft", "Object"};
+    const PortConfigInfo m_portConfigInfo{11U, 22U, 33U};
+};
+
+TEST_F(PoshRuntimePortRequest_test, PublisherRequestIsTransmittedWithSerialization)
+{
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 13U;
+    publisherOptions.nodeName = "Node";
+    publisherOptions.offerOnCreate = false;
+    publisherOptions.subscriberTooSlowPolicy = popo::SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+    publisherOptions.maxBlockingTime = units::Duration::fromMilliseconds(42U);
+    publisherOptions.chunkCacheSize = 7U;
+    publisherOptions.publishTimestamp = true;
+
+    auto sut = transmit(PortRequest(m_service, publisherOptions, m_portConfigInfo));
+
+    ASSERT_THAT(sut.m_portType, Eq(PortRequest::PortType::PUBLISHER));
+    EXPECT_THAT(sut.m_service, Eq(m_service));
+    EXPECT_THAT(sut.m_publisherOptions.historyCapacity, Eq(publisherOptions.historyCapacity));
+    EXPECT_THAT(sut.m_publisherOptions.nodeName, Eq(publisherOptions.nodeName));
+    EXPECT_THAT(sut.m_publisherOptions.offerOnCreate, Eq(publisherOptions.offerOnCreate));
+    EXPECT_THAT(sut.m_publisherOptions.subscriberTooSlowPolicy, Eq(publisherOptions.subscriberTooSlowPolicy));
+    EXPECT_THAT(sut.m_publisherOptions.maxBlockingTime, Eq(publisherOptions.maxBlockingTime));
+    EXPECT_THAT(sut.m_publisherOptions.chunkCacheSize, Eq(publisherOptions.chunkCacheSize));
+    EXPECT_THAT(sut.m_publisherOptions.publishTimestamp, Eq(publisherOptions.publishTimestamp));
+    EXPECT_THAT(sut.m_portConfigInfo.portType, Eq(m_portConfigInfo.portType));
+    EXPECT_THAT(sut.m_portConfigInfo.memoryInfo.deviceId, Eq(m_portConfigInfo.memoryInfo.deviceId));
+    EXPECT_THAT(sut.m_portConfigInfo.memoryInfo.memoryType, Eq(m_portConfigInfo.memoryInfo.memoryType));
+}
+
+TEST_F(PoshRuntimePortRequest_test, SubscriberRequestIsTransmittedWithSerialization)
+{
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 13U;
+    subscriberOptions.queueCapacity = 42U;
+    subscriberOptions.nodeName = "Node";
+    subscriberOptions.subscribeOnCreate = false;
+    subscriberOptions.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PUBLISHER;
+    subscriberOptions.decimationFactor = 5U;
+    subscriberOptions.minDeliveryInterval = units::Duration::fromMilliseconds(73U);
+
+    auto sut = transmit(PortRequest(m_service, subscriberOptions, m_portConfigInfo));
+
+    ASSERT_THAT(sut.m_portType, Eq(PortRequest::PortType::SUBSCRIBER));
+    EXPECT_THAT(sut.m_service, Eq(m_service));
+    EXPECT_THAT(sut.m_subscriberOptions.historyRequest, Eq(subscriberOptions.historyRequest));
+    EXPECT_THAT(sut.m_subscriberOptions.queueCapacity, Eq(subscriberOptions.queueCapacity));
+    EXPECT_THAT(sut.m_subscriberOptions.nodeName, Eq(subscriberOptions.nodeName));
+    EXPECT_THAT(sut.m_subscriberOptions.subscribeOnCreate, Eq(subscriberOptions.subscribeOnCreate));
+    EXPECT_THAT(sut.m_subscriberOptions.queueFullPolicy, Eq(subscriberOptions.queueFullPolicy));
+    EXPECT_THAT(sut.m_subscriberOptions.decimationFactor, Eq(subscriberOptions.decimationFactor));
+    EXPECT_THAT(sut.m_subscriberOptions.minDeliveryInterval, Eq(subscriberOptions.minDeliveryInterval));
+    EXPECT_THAT(sut.m_portConfigInfo.portType, Eq(m_portConfigInfo.portType));
+}
+
+TEST_F(PoshRuntimePortRequest_test, RequestWithInvalidSerializationIsInvalid)
+{
+    PortRequest sut(cxx::Serialization("Hypnotoad"));
+
+    EXPECT_THAT(sut.m_portType, Eq(PortRequest::PortType::INVALID));
+}
+
+TEST_F(PoshRuntimePortRequest_test, RequestWithUnknownPortTypeIsInvalid)
+{
+    PortRequest sut(cxx::Serialization::create(static_cast<uint8_t>(42U), static_cast<cxx::Serialization>(m_service)));
+
+    EXPECT_THAT(sut.m_portType, Eq(PortRequest::PortType::INVALID));
+}
+
+TEST_F(PoshRuntimePortRequest_test, RequestWithMissingElementsIsInvalid)
+{
+    PortRequest sut(cxx::Serialization::create(cxx::enumTypeAsUnderlyingType(PortRequest::PortType::SUBSCRIBER),
+                                               static_cast<cxx::Serialization>(m_service)));
+
+    EXPECT_THAT(sut.m_portType, Eq(PortRequest::PortType::INVALID));
+}
+
+} // namespace
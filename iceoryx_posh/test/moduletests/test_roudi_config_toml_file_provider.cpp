@@ -54,6 +54,31 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseSegmentMappingOptionsIsSuccessful)
+{
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_segment_mapping_options.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+
+    EXPECT_THAT(segments[0].m_mappingOptions.pageType, Eq(iox::posix::PageType::HUGE_PAGES_2MB));
+    EXPECT_TRUE(segments[0].m_mappingOptions.prefault);
+    EXPECT_TRUE(segments[0].m_mappingOptions.lockInMemory);
+    EXPECT_THAT(segments[0].m_mappingOptions.zeroInitialization, Eq(iox::posix::ZeroInitialization::SKIP));
+    EXPECT_THAT(segments[0].m_mappingOptions.numaNode, Eq(1U));
+
+    EXPECT_THAT(segments[1].m_mappingOptions.pageType, Eq(iox::posix::PageType::DEFAULT));
+    EXPECT_FALSE(segments[1].m_mappingOptions.prefault);
+    EXPECT_FALSE(segments[1].m_mappingOptions.lockInMemory);
+    EXPECT_THAT(segments[1].m_mappingOptions.zeroInitialization, Eq(iox::posix::ZeroInitialization::MEMSET));
+    EXPECT_THAT(segments[1].m_mappingOptions.numaNode, Eq(iox::posix::ANY_NUMA_NODE));
+}
+
 /// we require INSTANTIATE_TEST_CASE_P since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -77,7 +102,16 @@ INSTANTIATE_TEST_CASE_P(
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
-                                 "toml_parser_exception.toml"}));
+                                 "toml_parser_exception.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_PAGE_TYPE,
+                                 "roudi_config_error_segment_with_invalid_page_type.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_ZERO_INITIALIZATION,
+                                 "roudi_config_error_segment_with_invalid_zero_initialization.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_NUMA_NODE,
+                                 "roudi_config_error_segment_with_invalid_numa_node.toml"},
+           ParseErrorInputFile_t{
+               iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_HUGE_PAGES_AND_SEPARATE_READER_GROUP,
+               "roudi_config_error_segment_with_huge_pages_and_separate_reader_group.toml"}));
 #pragma GCC diagnostic pop
 
 TEST_P(RoudiConfigTomlFileProvider_test, ParseMalformedInputFileCausesError)
@@ -40,6 +40,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendThroughputData();
     }
+    void sendSubscriberPortsData()
+    {
+        iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData();
+    }
     iox::cxx::optional<PublisherPort>& getPublisherPort()
     {
         return this->m_publisherPort;
@@ -48,6 +52,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::cxx::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -447,6 +455,90 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsLatenciesOnceForEverySubscriberWithPublishTimestamps)
+{
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::capro::ServiceDescription service("1", "2", "3");
+    // the subscribers are connected to multiple publishers which share the queue of the subscriber
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisher1{service, "name3", &memoryManager, iox::popo::PublisherOptions()};
+    iox::popo::PublisherPortData publisher2{service, "name4", &memoryManager, iox::popo::PublisherOptions()};
+    EXPECT_THAT(m_introspectionAccess.addPublisher(publisher1), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addPublisher(publisher2), Eq(true));
+    // the throughput data of the publishers is gathered from the mocked publisher ports
+    DefaultValue<iox::units::Duration>::Set(iox::units::Duration::fromNanoseconds(0U));
+    DefaultValue<iox::UniquePortId>::Set(publisher1.m_uniqueId);
+
+    iox::popo::SubscriberOptions subscriberOptions;
+    iox::popo::SubscriberPortData subscriberWithLatencies{
+        service, "name1", iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, subscriberOptions};
+    iox::popo::SubscriberPortData subscriberWithoutLatencies{
+        service, "name2", iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, subscriberOptions};
+    constexpr uint64_t LATENCY{1000U};
+    subscriberWithLatencies.m_queueLatencyHistogram.record(LATENCY);
+    subscriberWithLatencies.m_queueLatencyHistogram.record(LATENCY);
+
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(subscriberWithLatencies), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(subscriberWithoutLatencies), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_latencyList.size(), Eq(1U));
+    auto& latencyData = chunk->sample()->m_latencyList[0];
+    EXPECT_THAT(latencyData.m_subscriberPortID, Eq(static_cast<uint64_t>(subscriberWithLatencies.m_uniqueId)));
+    EXPECT_THAT(latencyData.m_numberOfSamples, Eq(2U));
+    EXPECT_THAT(latencyData.m_p50LatencyInNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(latencyData.m_p99LatencyInNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(latencyData.m_maxLatencyInNanoseconds, Eq(LATENCY));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+    DefaultValue<iox::units::Duration>::Clear();
+    DefaultValue<iox::UniquePortId>::Clear();
+}
+
+TEST_F(PortIntrospection_test, sendSubscriberPortsDataContainsNumberOfSkippedSamples)
+{
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::capro::ServiceDescription service("1", "2", "3");
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.decimationFactor = 10U;
+    iox::popo::SubscriberPortData subscriber{
+        service, "name1", iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, subscriberOptions};
+    constexpr uint64_t NUMBER_OF_SKIPPED_SAMPLES{9U};
+    subscriber.m_chunkReceiverData.m_deliveryFilterState->m_numberOfSkippedChunks.store(NUMBER_OF_SKIPPED_SAMPLES);
+
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(subscriber), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList[0].numberOfSkippedSamples,
+                Eq(NUMBER_OF_SKIPPED_SAMPLES));
+
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+}
 
 TEST_F(PortIntrospection_test, DISABLED_thread)
 {
@@ -267,6 +267,85 @@ TEST_F(PortManager_test, DoDiscoveryWithSingleShotSubscriberFirst)
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, HandleDiscoveryRequestsConnectsOfferedPublisherAndSubscribedSubscriber)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {1U, 1U, 1U}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    publisher.offer();
+
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({1U, 1U, 1U}, subscriberOptions, "schlomo", PortConfigInfo()).value());
+    ASSERT_TRUE(subscriber);
+    subscriber.subscribe();
+
+    // no doDiscovery() is intentional, the offer and the subscription requested the discovery of the ports
+    m_portManager->handleDiscoveryRequests();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, HandleDiscoveryRequestsDestroysPortWhichRequestedDestruction)
+{
+    iox::RuntimeName_t runtimeName = "test1";
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("run1")};
+
+    iox::popo::PublisherPortData* publisherPortData{nullptr};
+    for (unsigned int i = 0; i < iox::MAX_PUBLISHERS; i++)
+    {
+        auto publisherPortDataResult = m_portManager->acquirePublisherPortData(
+            getUniqueSD(), publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo());
+        ASSERT_FALSE(publisherPortDataResult.has_error());
+        publisherPortData = publisherPortDataResult.value();
+    }
+
+    // no doDiscovery() is intentional, the destruction of the port is requested
+    PublisherPortUser(publisherPortData).destroy();
+    m_portManager->handleDiscoveryRequests();
+
+    auto publisherPortDataResult = m_portManager->acquirePublisherPortData(
+        getUniqueSD(), publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo());
+    EXPECT_FALSE(publisherPortDataResult.has_error());
+}
+
+TEST_F(PortManager_test, HandleDiscoveryRequestsIgnoresRequestOfAlreadyDestroyedPort)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {1U, 1U, 1U}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    publisher.offer();
+    publisher.destroy();
+    // the cyclic discovery destroys the port while its request is still pending
+    m_portManager->doDiscovery();
+    m_portManager->handleDiscoveryRequests();
+
+    // the slot of the destroyed port is reused and the new port must still be able to request its discovery
+    PublisherPortUser newPublisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {1U, 1U, 1U}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    newPublisher.offer();
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({1U, 1U, 1U}, subscriberOptions, "schlomo", PortConfigInfo()).value());
+    subscriber.subscribe();
+    m_portManager->handleDiscoveryRequests();
+
+    EXPECT_TRUE(newPublisher.hasSubscribers());
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithDiscoveryLoopInBetweenCreationOfSubscriberAndPublisher)
 {
     PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
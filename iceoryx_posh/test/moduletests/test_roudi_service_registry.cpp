@@ -49,7 +49,7 @@ class ServiceRegistry_test : public Test
 
 TEST_F(ServiceRegistry_test, SingleAdd)
 {
-    registry.add("a", "b");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
     registry.find(searchResults, "a", AnyInstanceString);
 
     EXPECT_THAT(searchResults.size(), Eq(1));
@@ -58,9 +58,9 @@ TEST_F(ServiceRegistry_test, SingleAdd)
 
 TEST_F(ServiceRegistry_test, SingleMultiAdd)
 {
-    registry.add("a", "b");
-    registry.add("a", "c");
-    registry.add("a", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
     registry.find(searchResults, "a", AnyInstanceString);
 
     EXPECT_THAT(searchResults.size(), Eq(3));
@@ -84,8 +84,8 @@ TEST_F(ServiceRegistry_test, SingleMultiAdd)
 
 TEST_F(ServiceRegistry_test, SingleAddMultiService)
 {
-    registry.add("a", "b");
-    registry.add("c", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("c", "d").has_error());
     registry.find(searchResults, "a", AnyInstanceString);
 
     EXPECT_THAT(searchResults.size(), Eq(1));
@@ -99,9 +99,9 @@ TEST_F(ServiceRegistry_test, SingleAddMultiService)
 
 TEST_F(ServiceRegistry_test, FindSpecificInstance)
 {
-    registry.add("a", "b");
-    registry.add("a", "c");
-    registry.add("a", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
     registry.find(searchResults, "a", "c");
 
     EXPECT_THAT(searchResults.size(), Eq(1));
@@ -110,9 +110,9 @@ TEST_F(ServiceRegistry_test, FindSpecificInstance)
 
 TEST_F(ServiceRegistry_test, FindSpecificNonExistingInstance)
 {
-    registry.add("a", "b");
-    registry.add("a", "c");
-    registry.add("a", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
     registry.find(searchResults, "a", "g");
 
     EXPECT_THAT(searchResults.size(), Eq(0));
@@ -120,9 +120,9 @@ TEST_F(ServiceRegistry_test, FindSpecificNonExistingInstance)
 
 TEST_F(ServiceRegistry_test, RemoveSingle)
 {
-    registry.add("a", "b");
-    registry.add("a", "c");
-    registry.add("a", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
 
     registry.remove("a", "c");
 
@@ -132,9 +132,9 @@ TEST_F(ServiceRegistry_test, RemoveSingle)
 
 TEST_F(ServiceRegistry_test, RemoveSingleFromMultipleServices)
 {
-    registry.add("a", "b");
-    registry.add("b", "c");
-    registry.add("c", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("b", "c").has_error());
+    ASSERT_FALSE(registry.add("c", "d").has_error());
 
     registry.remove("b", "c");
 
@@ -144,9 +144,9 @@ TEST_F(ServiceRegistry_test, RemoveSingleFromMultipleServices)
 
 TEST_F(ServiceRegistry_test, RemoveAll)
 {
-    registry.add("a", "b");
-    registry.add("a", "c");
-    registry.add("a", "d");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
 
     registry.remove("a", "b");
     registry.remove("a", "c");
@@ -156,38 +156,122 @@ TEST_F(ServiceRegistry_test, RemoveAll)
     EXPECT_THAT(searchResults.size(), Eq(0));
 }
 
-TEST_F(ServiceRegistry_test, GetServiceMap)
+TEST_F(ServiceRegistry_test, ForEachVisitsEveryEntryOnce)
 {
-    iox::roudi::ServiceRegistry::serviceMap_t serviceMap;
-
-    registry.add("a", "b");
+    ASSERT_FALSE(registry.add("a", "b").has_error());
     // add same service a, instance c to check if in registry only one entry is created
-    registry.add("a", "c");
-    registry.add("a", "c");
-    registry.add("a", "d");
-    registry.add("e", "f");
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
+    ASSERT_FALSE(registry.add("e", "f").has_error());
 
-    serviceMap = registry.getServiceMap();
+    EXPECT_THAT(registry.size(), Eq(4U));
 
-    bool mapA = false;
+    iox::roudi::ServiceRegistry::InstanceSet_t instancesOfA;
     bool mapE = false;
 
-    for (auto const& x : serviceMap)
-    {
-        if (x.first == iox::cxx::string<100>("a"))
+    registry.forEach([&](const iox::capro::IdString_t& service, const iox::capro::IdString_t& instance) {
+        if (service == iox::cxx::string<100>("a"))
         {
-            ASSERT_THAT(x.second.instanceSet.size(), Eq(3));
-            mapA = true;
-            EXPECT_THAT(x.second.instanceSet[0], Eq(iox::cxx::string<100>("b")));
-            EXPECT_THAT(x.second.instanceSet[1], Eq(iox::cxx::string<100>("c")));
-            EXPECT_THAT(x.second.instanceSet[2], Eq(iox::cxx::string<100>("d")));
+            instancesOfA.push_back(instance);
         }
 
-        if (x.first == iox::cxx::string<100>("e"))
+        if (service == iox::cxx::string<100>("e"))
             mapE = true;
+    });
+
+    ASSERT_THAT(instancesOfA.size(), Eq(3));
+    EXPECT_THAT(instancesOfA[0], Eq(iox::cxx::string<100>("b")));
+    EXPECT_THAT(instancesOfA[1], Eq(iox::cxx::string<100>("c")));
+    EXPECT_THAT(instancesOfA[2], Eq(iox::cxx::string<100>("d")));
+    EXPECT_THAT(mapE, Eq(true));
+}
+
+TEST_F(ServiceRegistry_test, FindWithAnyServiceReturnsMatchingInstanceOnce)
+{
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("c", "b").has_error());
+    ASSERT_FALSE(registry.add("c", "d").has_error());
+
+    registry.find(searchResults, iox::capro::AnyServiceString, "b");
+
+    ASSERT_THAT(searchResults.size(), Eq(1));
+    EXPECT_THAT(searchResults[0], Eq(iox::cxx::string<100>("b")));
+}
+
+TEST_F(ServiceRegistry_test, FindWithWildcardServiceVisitsAllServicesOfInstance)
+{
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("c", "b").has_error());
+    ASSERT_FALSE(registry.add("c", "d").has_error());
+
+    iox::cxx::vector<iox::capro::IdString_t, 3> services;
+    registry.find(iox::cxx::nullopt,
+                  iox::capro::IdString_t("b"),
+                  [&](const iox::capro::IdString_t& service, const iox::capro::IdString_t&) {
+                      services.push_back(service);
+                  });
+
+    ASSERT_THAT(services.size(), Eq(2));
+    EXPECT_THAT(services[0], Eq(iox::cxx::string<100>("a")));
+    EXPECT_THAT(services[1], Eq(iox::cxx::string<100>("c")));
+}
+
+TEST_F(ServiceRegistry_test, FindServiceAfterRemovingFirstAddedInstanceReturnsRemainingInstances)
+{
+    ASSERT_FALSE(registry.add("a", "b").has_error());
+    ASSERT_FALSE(registry.add("a", "c").has_error());
+    ASSERT_FALSE(registry.add("a", "d").has_error());
+
+    registry.remove("a", "b");
+    registry.find(searchResults, "a", AnyInstanceString);
+
+    ASSERT_THAT(searchResults.size(), Eq(2));
+    EXPECT_THAT(searchResults[0], Eq(iox::cxx::string<100>("c")));
+    EXPECT_THAT(searchResults[1], Eq(iox::cxx::string<100>("d")));
+}
+
+TEST_F(ServiceRegistry_test, AddFailsWhenCapacityIsExhausted)
+{
+    iox::roudi::ServiceRegistryImpl<2U> sut;
+    EXPECT_FALSE(sut.add("a", "b").has_error());
+    EXPECT_FALSE(sut.add("a", "c").has_error());
+
+    auto result = sut.add("a", "d");
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::roudi::ServiceRegistryError::SERVICE_REGISTRY_FULL));
+
+    sut.remove("a", "b");
+    EXPECT_FALSE(sut.add("a", "d").has_error());
+    EXPECT_THAT(sut.size(), Eq(2U));
+}
+
+TEST_F(ServiceRegistry_test, AllEntriesRemainFindableWhileAddingAndRemovingManyEntries)
+{
+    constexpr uint32_t NUMBER_OF_ENTRIES{iox::roudi::ServiceRegistry::capacity()};
+    for (uint32_t i = 0U; i < NUMBER_OF_ENTRIES; ++i)
+    {
+        ASSERT_FALSE(registry
+                         .add(iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i % 17U)),
+                              iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i)))
+                         .has_error());
+    }
+    EXPECT_THAT(registry.size(), Eq(NUMBER_OF_ENTRIES));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_ENTRIES; i += 2U)
+    {
+        registry.remove(iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i % 17U)),
+                        iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i)));
     }
 
-    EXPECT_THAT(mapA && mapE, Eq(true));
+    for (uint32_t i = 0U; i < NUMBER_OF_ENTRIES; ++i)
+    {
+        searchResults.clear();
+        registry.find(searchResults,
+                      iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i % 17U)),
+                      iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i)));
+        EXPECT_THAT(searchResults.size(), Eq((i % 2U == 0U) ? 0U : 1U));
+    }
 }
 
 } // namespace
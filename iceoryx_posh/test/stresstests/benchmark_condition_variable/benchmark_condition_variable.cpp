@@ -0,0 +1,98 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+
+using namespace iox::popo;
+
+/// @brief The ConditionListener and ConditionNotifier are the primitives the WaitSet and the Listener are built on.
+/// Two threads play ping pong over two condition variables, the time of a round trip contains two wake ups.
+/// The fan in variants let every notifier of the pinged condition variable notify, to see how the collection of the
+/// notifications scales with the number of attached notifiers.
+void PerformBenchmark(const uint64_t numberOfNotifiers, const uint64_t numberOfRoundTrips)
+{
+    std::unique_ptr<ConditionVariableData> pingData{new ConditionVariableData("ping")};
+    std::unique_ptr<ConditionVariableData> pongData{new ConditionVariableData("pong")};
+
+    std::atomic_bool keepRunning{true};
+    std::thread pongThread([&] {
+        ConditionListener listener(*pingData);
+        ConditionNotifier notifier(*pongData, 0U);
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (!listener.wait().empty())
+            {
+                notifier.notify();
+            }
+        }
+    });
+
+    ConditionListener listener(*pongData);
+    iox::cxx::vector<ConditionNotifier, iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE> notifiers;
+    for (uint64_t i = 0U; i < numberOfNotifiers; ++i)
+    {
+        notifiers.emplace_back(*pingData, i);
+    }
+
+    using Clock_t = std::chrono::steady_clock;
+    int64_t minLatency{std::numeric_limits<int64_t>::max()};
+    int64_t maxLatency{0};
+    int64_t accumulatedLatency{0};
+    for (uint64_t i = 0U; i < numberOfRoundTrips; ++i)
+    {
+        auto start = Clock_t::now();
+        for (auto& notifier : notifiers)
+        {
+            notifier.notify();
+        }
+        listener.wait();
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - start).count();
+
+        minLatency = std::min(minLatency, latency);
+        maxLatency = std::max(maxLatency, latency);
+        accumulatedLatency += latency;
+    }
+
+    keepRunning = false;
+    notifiers[0].notify();
+    pongThread.join();
+
+    std::cout << std::setw(10) << numberOfNotifiers << " notifier(s) | round trip [ns] avg: " << std::setw(8)
+              << accumulatedLatency / static_cast<int64_t>(numberOfRoundTrips) << " min: " << std::setw(8)
+              << minLatency << " max: " << std::setw(10) << maxLatency << std::endl;
+}
+
+int main()
+{
+    constexpr uint64_t NUMBER_OF_ROUND_TRIPS{100000U};
+
+    PerformBenchmark(1U, NUMBER_OF_ROUND_TRIPS);
+    PerformBenchmark(8U, NUMBER_OF_ROUND_TRIPS);
+    PerformBenchmark(iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE, NUMBER_OF_ROUND_TRIPS);
+
+    return 0;
+}
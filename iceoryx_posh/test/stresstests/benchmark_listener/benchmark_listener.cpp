@@ -0,0 +1,112 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using namespace iox::popo;
+
+constexpr uint64_t NUMBER_OF_EVENTS{32U};
+constexpr std::chrono::microseconds CALLBACK_RUNTIME{20};
+constexpr std::chrono::milliseconds MEASUREMENT_DURATION{1000};
+
+std::atomic<uint64_t> g_numberOfCallbacks{0U};
+
+/// @brief the Listener uses the condition variable of the runtime, the benchmark runs without RouDi
+class BenchmarkListener : public Listener
+{
+  public:
+    BenchmarkListener(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkers)
+        : Listener(conditionVariableData, numberOfWorkers)
+    {
+    }
+};
+
+/// @brief simulates the processing of e.g. the samples of a subscriber
+void onEvent(UserTrigger* const)
+{
+    auto end = std::chrono::steady_clock::now() + CALLBACK_RUNTIME;
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+    g_numberOfCallbacks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+/// @brief All events are triggered continuously, the number of executed callbacks shows how the event throughput
+/// scales with the workers of the Listener. Without workers all callbacks are executed by the thread which waits for
+/// the events.
+void PerformBenchmark(const uint64_t numberOfWorkers)
+{
+    std::unique_ptr<ConditionVariableData> conditionVariableData{new ConditionVariableData("listener")};
+    std::unique_ptr<UserTrigger[]> events{new UserTrigger[NUMBER_OF_EVENTS]};
+    uint64_t numberOfCallbacks{0U};
+    {
+        BenchmarkListener listener(*conditionVariableData, numberOfWorkers);
+        for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+        {
+            listener.attachEvent(events[i], createNotificationCallback(onEvent)).or_else([](auto) {
+                std::cerr << "unable to attach event" << std::endl;
+                std::exit(EXIT_FAILURE);
+            });
+        }
+
+        g_numberOfCallbacks.store(0U);
+        auto end = std::chrono::steady_clock::now() + MEASUREMENT_DURATION;
+        while (std::chrono::steady_clock::now() < end)
+        {
+            for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+            {
+                events[i].trigger();
+            }
+            std::this_thread::yield();
+        }
+        numberOfCallbacks = g_numberOfCallbacks.load();
+
+        for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+        {
+            listener.detachEvent(events[i]);
+        }
+    }
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(MEASUREMENT_DURATION).count();
+    std::cout << std::setw(4) << numberOfWorkers << " worker(s) | " << std::setw(10)
+              << static_cast<uint64_t>(static_cast<double>(numberOfCallbacks) / seconds) << " callbacks/s"
+              << std::endl;
+}
+
+int main()
+{
+    std::cout << NUMBER_OF_EVENTS << " events, " << CALLBACK_RUNTIME.count() << " us per callback, "
+              << std::thread::hardware_concurrency() << " cores" << std::endl;
+
+    PerformBenchmark(0U);
+    for (uint64_t numberOfWorkers = 1U; numberOfWorkers <= iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER;
+         numberOfWorkers *= 2U)
+    {
+        PerformBenchmark(numberOfWorkers);
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/platform/wait.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+constexpr uint64_t DEFAULT_NUMBER_OF_PROCESSES{64U};
+constexpr uint64_t DEFAULT_NUMBER_OF_PORTS_PER_PROCESS{4U};
+
+/// @brief creates the runtime and the publishers and subscribers of one application
+void startApplication(const uint64_t processIndex, const uint64_t numberOfPorts, const bool usePreparedPorts)
+{
+    const iox::RuntimeName_t runtimeName{iox::cxx::TruncateToCapacity,
+                                         "iox-bm-startup-" + iox::cxx::convert::toString(processIndex)};
+    auto& runtime = iox::runtime::PoshRuntime::initRuntime(runtimeName);
+
+    auto service = [&](const uint64_t portIndex) {
+        return iox::capro::ServiceDescription{
+            "Startup",
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(processIndex)),
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(portIndex))};
+    };
+
+    if (usePreparedPorts)
+    {
+        for (uint64_t i = 0U; i < numberOfPorts; ++i)
+        {
+            runtime.preparePublisher(service(i));
+            runtime.prepareSubscriber(service(i));
+        }
+    }
+
+    for (uint64_t i = 0U; i < numberOfPorts; ++i)
+    {
+        if (runtime.getMiddlewarePublisher(service(i)) == nullptr
+            || runtime.getMiddlewareSubscriber(service(i)) == nullptr)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/// @brief All applications are started at once, like after the boot of a system, and the time until every
+/// application has registered and created all its ports is measured. RouDi has to be running.
+void PerformBenchmark(const uint64_t numberOfProcesses, const uint64_t numberOfPorts, const bool usePreparedPorts)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfProcesses; ++i)
+    {
+        auto pid = fork();
+        if (pid == -1)
+        {
+            std::cerr << "unable to start application " << i << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        if (pid == 0)
+        {
+            startApplication(i, numberOfPorts, usePreparedPorts);
+            std::exit(EXIT_SUCCESS);
+        }
+    }
+
+    uint64_t numberOfFailedProcesses{0U};
+    for (uint64_t i = 0U; i < numberOfProcesses; ++i)
+    {
+        int status{0};
+        if (wait(&status) == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        {
+            ++numberOfFailedProcesses;
+        }
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << std::setw(9) << (usePreparedPorts ? "prepared" : "separate") << " | " << std::setw(8)
+              << duration.count() << " ms";
+    if (numberOfFailedProcesses != 0U)
+    {
+        std::cout << " | " << numberOfFailedProcesses << " application(s) failed";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfProcesses{DEFAULT_NUMBER_OF_PROCESSES};
+    uint64_t numberOfPorts{DEFAULT_NUMBER_OF_PORTS_PER_PROCESS};
+    if ((argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfProcesses))
+        || (argc > 2 && !iox::cxx::convert::fromString(argv[2], numberOfPorts)) || argc > 3)
+    {
+        std::cerr << "usage: " << argv[0] << " [number of applications] [publishers and subscribers per application]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << numberOfProcesses << " applications with " << numberOfPorts << " publishers and " << numberOfPorts
+              << " subscribers each" << std::endl;
+
+    PerformBenchmark(numberOfProcesses, numberOfPorts, false);
+    PerformBenchmark(numberOfProcesses, numberOfPorts, true);
+
+    return EXIT_SUCCESS;
+}
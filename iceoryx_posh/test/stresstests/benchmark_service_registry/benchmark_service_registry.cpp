@@ -0,0 +1,119 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint32_t NUMBER_OF_SERVICES{100U};
+constexpr uint32_t NUMBER_OF_INSTANCES_PER_SERVICE{100U};
+constexpr uint32_t NUMBER_OF_ENTRIES{NUMBER_OF_SERVICES * NUMBER_OF_INSTANCES_PER_SERVICE};
+
+using ServiceRegistry_t = roudi::ServiceRegistryImpl<NUMBER_OF_ENTRIES>;
+
+template <typename Callable>
+void measure(const char* name, const uint64_t numberOfOperations, const Callable& callable)
+{
+    auto start = std::chrono::steady_clock::now();
+    callable();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << std::setw(40) << name << " : " << std::setw(10)
+              << static_cast<uint64_t>(duration.count()) / numberOfOperations << " ns per operation" << std::endl;
+}
+
+int main()
+{
+    std::vector<capro::IdString_t> services;
+    std::vector<capro::IdString_t> instances;
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        services.emplace_back(cxx::TruncateToCapacity, "RadarService" + std::to_string(i));
+    }
+    for (uint32_t i = 0U; i < NUMBER_OF_INSTANCES_PER_SERVICE; ++i)
+    {
+        instances.emplace_back(cxx::TruncateToCapacity, "FrontLeftInstance" + std::to_string(i));
+    }
+
+    // too large for the stack
+    std::unique_ptr<ServiceRegistry_t> registry{new ServiceRegistry_t()};
+    uint64_t numberOfMatches{0U};
+    auto countMatches = [&](const capro::IdString_t&, const capro::IdString_t&) { ++numberOfMatches; };
+
+    std::cout << "service registry with " << NUMBER_OF_ENTRIES << " entries" << std::endl;
+
+    measure("add", NUMBER_OF_ENTRIES, [&] {
+        for (auto& service : services)
+        {
+            for (auto& instance : instances)
+            {
+                registry->add(service, instance).or_else([](auto&) { std::cerr << "registry full" << std::endl; });
+            }
+        }
+    });
+
+    measure("find service and instance", NUMBER_OF_ENTRIES, [&] {
+        for (auto& service : services)
+        {
+            for (auto& instance : instances)
+            {
+                registry->find(service, instance, countMatches);
+            }
+        }
+    });
+
+    measure("find service and any instance", NUMBER_OF_SERVICES, [&] {
+        for (auto& service : services)
+        {
+            registry->find(service, cxx::nullopt, countMatches);
+        }
+    });
+
+    measure("find any service and instance", NUMBER_OF_INSTANCES_PER_SERVICE, [&] {
+        for (auto& instance : instances)
+        {
+            registry->find(cxx::nullopt, instance, countMatches);
+        }
+    });
+
+    measure("find non existing service", NUMBER_OF_ENTRIES, [&] {
+        for (uint32_t i = 0U; i < NUMBER_OF_ENTRIES; ++i)
+        {
+            registry->find(instances[i % NUMBER_OF_INSTANCES_PER_SERVICE], cxx::nullopt, countMatches);
+        }
+    });
+
+    measure("remove", NUMBER_OF_ENTRIES, [&] {
+        for (auto& service : services)
+        {
+            for (auto& instance : instances)
+            {
+                registry->remove(service, instance);
+            }
+        }
+    });
+
+    std::cout << "matches: " << numberOfMatches << ", remaining entries: " << registry->size() << std::endl;
+
+    return 0;
+}
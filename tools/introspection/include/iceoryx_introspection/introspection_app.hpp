@@ -150,6 +150,9 @@ class IntrospectionApp
     void printPortIntrospectionData(const std::vector<ComposedPublisherPortData>& publisherPortData,
                                     const std::vector<ComposedSubscriberPortData>& subscriberPortData);
 
+    /// @brief Print the queue latency percentiles of the subscribers which received samples with publish timestamps
+    void printSubscriberLatencies(const PortThroughputIntrospectionFieldTopic* throughputData);
+
     /// @brief Prints help to the command line
     void printHelp() noexcept;
 
@@ -23,6 +23,7 @@
 #include "iceoryx_versions.hpp"
 
 #include <chrono>
+#include <cinttypes>
 #include <iomanip>
 #include <poll.h>
 #include <thread>
@@ -343,7 +344,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
-    wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "----------------------------------------------------------------------------");
     wprintw(pad, "--------------------------------\n");
 
     bool needsLineBreak{false};
@@ -435,7 +436,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
-    wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "----------------------------------------------------------------------------");
     wprintw(pad, "---------------------------------------------------\n");
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
@@ -572,6 +573,48 @@ IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* po
     return publisherPortData;
 }
 
+void IntrospectionApp::printSubscriberLatencies(const PortThroughputIntrospectionFieldTopic* throughputData)
+{
+    if (throughputData->m_latencyList.empty())
+    {
+        return;
+    }
+
+    constexpr int32_t portIdWidth{20};
+    constexpr int32_t samplesWidth{12};
+    constexpr int32_t latencyWidth{12};
+    constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+
+    prettyPrint("Subscriber Queue Latencies\n", PrettyOptions::bold);
+
+    wprintw(pad, " %*s |", portIdWidth, "Subscriber Port ID");
+    wprintw(pad, " %*s |", samplesWidth, "Samples");
+    wprintw(pad, " %*s |", latencyWidth, "p50 [us]");
+    wprintw(pad, " %*s |", latencyWidth, "p99 [us]");
+    wprintw(pad, " %*s\n", latencyWidth, "max [us]");
+    wprintw(pad, "----------------------------------------------------------------------------");
+    wprintw(pad, "\n");
+
+    for (const auto& latency : throughputData->m_latencyList)
+    {
+        wprintw(pad, " %*" PRIu64 " |", portIdWidth, latency.m_subscriberPortID);
+        wprintw(pad, " %*" PRIu64 " |", samplesWidth, latency.m_numberOfSamples);
+        wprintw(pad,
+                " %*.1f |",
+                latencyWidth,
+                static_cast<double>(latency.m_p50LatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND);
+        wprintw(pad,
+                " %*.1f |",
+                latencyWidth,
+                static_cast<double>(latency.m_p99LatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND);
+        wprintw(pad,
+                " %*.1f\n",
+                latencyWidth,
+                static_cast<double>(latency.m_maxLatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND);
+    }
+    wprintw(pad, "\n");
+}
+
 std::vector<ComposedSubscriberPortData> IntrospectionApp::composeSubscriberPortData(
     const PortIntrospectionFieldTopic* portData,
     const SubscriberPortChangingIntrospectionFieldTopic* subscriberPortChangingData)
@@ -745,6 +788,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
                     portSample.value().get(), subscriberPortChangingDataSamples.value().get());
 
                 printPortIntrospectionData(composedPublisherPortData, composedSubscriberPortData);
+                printSubscriberLatencies(portThroughputSample.value().get());
             }
             else
             {